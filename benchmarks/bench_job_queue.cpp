@@ -0,0 +1,235 @@
+/**
+ * @file        bench_job_queue.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Push / pop throughput and hand-off latency of the queue backends.
+ *
+ * @details
+ * Each `BM_QueueTransfer` iteration moves `kTasksPerIteration` empty tasks
+ * from P producer threads to C consumer threads through a fresh queue. Only
+ * the transfer is timed (manual time, from the start signal until the last
+ * consumer is done), so thread creation does not pollute the numbers.
+ * Arguments: `{producers, consumers}`.
+ *
+ * `BM_QueuePingPong` bounces one task between two threads through a pair of
+ * queues, with and without a `SpinPolicy`: each round trip is two hand-offs
+ * to a consumer that is either parked or spinning. Spinning needs a spare
+ * CPU; on a single-CPU host it only delays the other thread.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "job_queue.h"
+#include "ring_job_queue.h"
+#include "spin_wait.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Tasks transferred per iteration.
+ */
+constexpr int kTasksPerIteration = 20000;
+
+/**
+ * @brief Tasks moved per `pushTasks()` / `popTasks()` call in the batched variants.
+ */
+constexpr size_t kBatch = 32;
+
+/**
+ * @brief Builds a queue of type `Queue` whose consumers spin with `spin` before blocking.
+ */
+template <typename Queue>
+Queue* makeQueue(const SpinPolicy& spin = SpinPolicy{});
+
+template <>
+JobQueue* makeQueue<JobQueue>(const SpinPolicy& spin)
+{
+    return new JobQueue(0, spin);
+}
+
+template <>
+RingJobQueue* makeQueue<RingJobQueue>(const SpinPolicy& spin)
+{
+    return new RingJobQueue(1024, spin);
+}
+
+/**
+ * @brief Producer body: pushes `count` empty tasks, one by one or in batches.
+ */
+template <bool Batched>
+void produce(IJobQueue& queue, int count)
+{
+    if (!Batched)
+    {
+        for (int i = 0; i < count; ++i)
+            queue.pushTask(Task([] {}));
+        return;
+    }
+
+    std::vector<Task> batch;
+    batch.reserve(kBatch);
+    for (int i = 0; i < count; ++i)
+    {
+        batch.emplace_back([] {});
+        if (batch.size() == kBatch || i + 1 == count)
+        {
+            queue.pushTasks(batch.data(), batch.size());
+            batch.clear();
+        }
+    }
+}
+
+/**
+ * @brief Consumer body: pops until the queue is closed and drained.
+ */
+template <bool Batched>
+void consume(IJobQueue& queue, size_t consumers)
+{
+    if (!Batched)
+    {
+        Task task;
+        while (queue.popTask(task))
+            task();
+        return;
+    }
+
+    std::vector<Task> batch(kBatch);
+    while (const size_t count = queue.popTasks(batch.data(), batch.size(), consumers))
+    {
+        for (size_t i = 0; i < count; ++i)
+            batch[i]();
+    }
+}
+
+/**
+ * @brief P producers -> queue -> C consumers.
+ */
+template <typename Queue, bool Batched>
+void BM_QueueTransfer(benchmark::State& state)
+{
+    const int producers = static_cast<int>(state.range(0));
+    const int consumers = static_cast<int>(state.range(1));
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<Queue> queue(makeQueue<Queue>());
+        std::atomic<bool>      go{false};
+        std::vector<std::thread> threads;
+
+        for (int c = 0; c < consumers; ++c)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    while (!go.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                    consume<Batched>(*queue, static_cast<size_t>(consumers));
+                });
+        }
+
+        std::vector<std::thread> producerThreads;
+        for (int p = 0; p < producers; ++p)
+        {
+            const int share = kTasksPerIteration / producers +
+                              (p < kTasksPerIteration % producers ? 1 : 0);
+            producerThreads.emplace_back(
+                [&, share]
+                {
+                    while (!go.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                    produce<Batched>(*queue, share);
+                });
+        }
+
+        const auto begin = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& thread : producerThreads)
+            thread.join();
+        queue->shutdown();
+        for (auto& thread : threads)
+            thread.join();
+        const auto end = std::chrono::steady_clock::now();
+
+        state.SetIterationTime(std::chrono::duration<double>(end - begin).count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kTasksPerIteration);
+}
+
+/**
+ * @brief One task bounced between the benchmark thread and an echo thread.
+ */
+template <typename Queue, bool Spinning>
+void BM_QueuePingPong(benchmark::State& state)
+{
+    SpinPolicy spin;
+    if (Spinning)
+    {
+        spin.maxSpins = 4096;
+        spin.yields   = 2;
+    }
+    std::unique_ptr<Queue> ping(makeQueue<Queue>(spin));
+    std::unique_ptr<Queue> pong(makeQueue<Queue>(spin));
+
+    std::thread echo(
+        [&]
+        {
+            Task task;
+            while (ping->popTask(task))
+                pong->pushTask(Task([] {}));
+        });
+
+    Task reply;
+    for (auto _ : state)
+    {
+        ping->pushTask(Task([] {}));
+        pong->popTask(reply);
+    }
+
+    ping->shutdown();
+    echo.join();
+}
+
+/**
+ * @brief Producer / consumer combinations: 1..4 of each.
+ */
+void transferArgs(benchmark::internal::Benchmark* bench)
+{
+    for (int producers : {1, 2, 4})
+    {
+        for (int consumers : {1, 2, 4})
+            bench->Args({producers, consumers});
+    }
+    bench->ArgNames({"producers", "consumers"})->UseManualTime()->Unit(benchmark::kMillisecond);
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Benchmarks */
+
+BENCHMARK_TEMPLATE(BM_QueueTransfer, JobQueue, false)->Apply(transferArgs);
+BENCHMARK_TEMPLATE(BM_QueueTransfer, JobQueue, true)->Apply(transferArgs);
+BENCHMARK_TEMPLATE(BM_QueueTransfer, RingJobQueue, false)->Apply(transferArgs);
+BENCHMARK_TEMPLATE(BM_QueueTransfer, RingJobQueue, true)->Apply(transferArgs);
+BENCHMARK_TEMPLATE(BM_QueuePingPong, JobQueue, false);
+BENCHMARK_TEMPLATE(BM_QueuePingPong, JobQueue, true);
+BENCHMARK_TEMPLATE(BM_QueuePingPong, RingJobQueue, false);
+BENCHMARK_TEMPLATE(BM_QueuePingPong, RingJobQueue, true);
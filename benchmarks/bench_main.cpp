@@ -0,0 +1,41 @@
+/**
+ * @file        bench_main.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Entry point of the Google Benchmark suite.
+ *
+ * @details
+ * Same as `BENCHMARK_MAIN()`, except that the logger is silenced first so
+ * that per-job log lines do not end up in the measurements. Every standard
+ * flag is accepted, e.g.:
+ * @code
+ * ./benchmarks --benchmark_filter=JobQueue --benchmark_out=results.json --benchmark_out_format=json
+ * @endcode
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <benchmark/benchmark.h>
+
+/* Project libraries */
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+int main(int argc, char** argv)
+{
+    Logger::set_min_level(Logger::Level::ERROR);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
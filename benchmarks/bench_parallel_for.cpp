@@ -0,0 +1,201 @@
+/**
+ * @file        bench_parallel_for.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief parallelFor / parallelReduce against hand-chunked `IJob` loops.
+ *
+ * @details
+ * Every iteration processes `kIndices` indices whose cost is either uniform
+ * or skewed (the first eighth of the range is `kSkew` times heavier, as in
+ * unevenly dense data). The hand-chunked variants split the range into one
+ * fixed chunk per thread, one `IJob` each, the way loops were written before
+ * `parallelFor`; the adaptive variants let idle workers split the range.
+ *
+ * Arguments: `{threads, skewed}`.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+/* Project libraries */
+
+#include "i_job.h"
+#include "parallel_for.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Indices processed per benchmark iteration.
+ */
+constexpr size_t kIndices = 1 << 14;
+
+/**
+ * @brief Cost multiplier of the heavy eighth of a skewed range.
+ */
+constexpr int kSkew = 16;
+
+/**
+ * @brief Simulated work of one index; returns a value so it cannot be optimized out.
+ */
+std::uint64_t work(size_t index, bool skewed)
+{
+    const int     rounds = (skewed && index < kIndices / 8) ? 32 * kSkew : 32;
+    std::uint64_t x      = index + 1;
+    for (int r = 0; r < rounds; ++r)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return x;
+}
+
+/**
+ * @brief Processes a fixed `[first, last)` chunk, then counts itself done.
+ */
+class ChunkJob : public IJob
+{
+   public:
+    ChunkJob(size_t first, size_t last, bool skewed, std::atomic<std::uint64_t>& sink,
+             std::atomic<int>& done)
+        : first(first), last(last), skewed(skewed), sink(sink), done(done)
+    {
+    }
+
+    void execute() override
+    {
+        std::uint64_t acc = 0;
+        for (size_t i = first; i < last; ++i)
+            acc += work(i, skewed);
+        sink.fetch_add(acc, std::memory_order_relaxed);
+        done.fetch_add(1, std::memory_order_release);
+    }
+
+   private:
+    size_t                      first;
+    size_t                      last;
+    bool                        skewed;
+    std::atomic<std::uint64_t>& sink;
+    std::atomic<int>&           done;
+};
+
+/**
+ * @brief Worker counts and workload shapes used by every benchmark in this file.
+ */
+void loopArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"threads", "skewed"});
+    for (int threads : {1, 2, 4})
+        for (int skewed : {0, 1})
+            bench->Args({threads, skewed});
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Benchmarks */
+
+/**
+ * @brief One fixed chunk per thread, one `IJob` per chunk.
+ */
+void BM_LoopHandChunked(benchmark::State& state)
+{
+    const size_t threads = static_cast<size_t>(state.range(0));
+    const bool   skewed  = state.range(1) != 0;
+    const size_t chunk   = (kIndices + threads - 1) / threads;
+
+    ThreadPool pool;
+    pool.start(threads);
+    std::atomic<std::uint64_t> sink{0};
+    std::atomic<int>           done{0};
+
+    for (auto _ : state)
+    {
+        int jobs = 0;
+        for (size_t first = 0; first < kIndices; first += chunk, ++jobs)
+            pool.enqueue(std::make_unique<ChunkJob>(first, std::min(first + chunk, kIndices),
+                                                    skewed, sink, done));
+        while (done.load(std::memory_order_acquire) < jobs)
+            std::this_thread::yield();
+        done.store(0, std::memory_order_relaxed);
+    }
+    pool.shutdown();
+
+    benchmark::DoNotOptimize(sink.load());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kIndices));
+}
+BENCHMARK(BM_LoopHandChunked)->Apply(loopArgs)->UseRealTime();
+
+/**
+ * @brief `parallelFor` with the automatic grain.
+ */
+void BM_LoopParallelFor(benchmark::State& state)
+{
+    const bool skewed = state.range(1) != 0;
+
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::atomic<std::uint64_t> sink{0};
+
+    for (auto _ : state)
+    {
+        parallelFor(pool, 0, kIndices,
+                    [&sink, skewed](size_t first, size_t last)
+                    {
+                        std::uint64_t acc = 0;
+                        for (size_t i = first; i < last; ++i)
+                            acc += work(i, skewed);
+                        sink.fetch_add(acc, std::memory_order_relaxed);
+                    });
+    }
+    pool.shutdown();
+
+    benchmark::DoNotOptimize(sink.load());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kIndices));
+}
+BENCHMARK(BM_LoopParallelFor)->Apply(loopArgs)->UseRealTime();
+
+/**
+ * @brief `parallelReduce` of the same workload (no shared accumulator).
+ */
+void BM_LoopParallelReduce(benchmark::State& state)
+{
+    const bool skewed = state.range(1) != 0;
+
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        const std::uint64_t total = parallelReduce(
+            pool, 0, kIndices, std::uint64_t{0},
+            [skewed](size_t first, size_t last, std::uint64_t acc)
+            {
+                for (size_t i = first; i < last; ++i)
+                    acc += work(i, skewed);
+                return acc;
+            },
+            [](std::uint64_t a, std::uint64_t b) { return a + b; });
+        benchmark::DoNotOptimize(total);
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kIndices));
+}
+BENCHMARK(BM_LoopParallelReduce)->Apply(loopArgs)->UseRealTime();
@@ -0,0 +1,160 @@
+/**
+ * @file        bench_strand.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Per-key serialization: mutexes inside the jobs against KeyedStrands.
+ *
+ * @details
+ * Every iteration applies `kOperations` updates spread round-robin over
+ * `keys` accounts. The mutex variant posts each update as a plain pool job
+ * that locks its account's mutex; the strand variant posts it to the
+ * account's strand and touches the account without any lock. With few
+ * keys the mutex variant has workers blocking on each other, while the
+ * strands run the updates of one account back to back on one worker.
+ *
+ * Arguments: `threads`, `keys`.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "strand.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Updates applied per iteration.
+ */
+constexpr int kOperations = 4000;
+
+/**
+ * @brief Per-key state touched by every update.
+ */
+struct Account
+{
+    std::mutex                    mtx;
+    std::array<std::uint64_t, 16> ledger{};
+};
+
+/**
+ * @brief One update: a short pass over the account's ledger.
+ */
+void apply(Account& account, int operation)
+{
+    for (auto& entry : account.ledger)
+        entry = entry * 31 + static_cast<std::uint64_t>(operation);
+}
+
+/**
+ * @brief Spins (yielding) until `done` reaches `expected`, then resets it.
+ */
+void waitAndReset(std::atomic<int>& done, int expected)
+{
+    while (done.load(std::memory_order_acquire) < expected)
+        std::this_thread::yield();
+    done.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Worker counts × key counts used by every benchmark in this file.
+ */
+void strandArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"threads", "keys"});
+    for (int threads : {1, 2, 4})
+    {
+        for (int keys : {4, 256})
+            bench->Args({threads, keys});
+    }
+    bench->UseRealTime();
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Benchmarks */
+
+/**
+ * @brief Plain pool jobs, each locking its account.
+ */
+void BM_KeyedMutexJobs(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::vector<Account> accounts(static_cast<size_t>(state.range(1)));
+    std::atomic<int>     done{0};
+
+    for (auto _ : state)
+    {
+        for (int op = 0; op < kOperations; ++op)
+        {
+            Account& account = accounts[static_cast<size_t>(op) % accounts.size()];
+            pool.post(
+                [&account, &done, op]
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(account.mtx);
+                        apply(account, op);
+                    }
+                    done.fetch_add(1, std::memory_order_release);
+                });
+        }
+        waitAndReset(done, kOperations);
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * kOperations);
+}
+BENCHMARK(BM_KeyedMutexJobs)->Apply(strandArgs);
+
+/**
+ * @brief The same updates through `KeyedStrands`, without locks.
+ */
+void BM_KeyedStrands(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::vector<Account> accounts(static_cast<size_t>(state.range(1)));
+    std::atomic<int>     done{0};
+    {
+        KeyedStrands<size_t> strands(pool);
+
+        for (auto _ : state)
+        {
+            for (int op = 0; op < kOperations; ++op)
+            {
+                const size_t key = static_cast<size_t>(op) % accounts.size();
+                strands.post(key,
+                             [&accounts, &done, key, op]
+                             {
+                                 apply(accounts[key], op);
+                                 done.fetch_add(1, std::memory_order_release);
+                             });
+            }
+            waitAndReset(done, kOperations);
+        }
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * kOperations);
+}
+BENCHMARK(BM_KeyedStrands)->Apply(strandArgs);
@@ -0,0 +1,279 @@
+/**
+ * @file        bench_task_graph.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief TaskGraph against dependencies chained by hand inside `IJob::execute()`.
+ *
+ * @details
+ * Two shapes, each node doing a little arithmetic:
+ *  - a chain of `kChain` nodes (no parallelism, pure hand-off cost);
+ *  - a stencil of `kDepth` layers of `kWidth` nodes, node `(d, i)` waiting
+ *    for `(d - 1, i)` and `(d - 1, i + 1)`.
+ * The hand-chained variants are written the way pipelines were before
+ * `TaskGraph`: each finished job decrements its successors' counters and
+ * enqueues a new `IJob` for every successor that became ready, with the
+ * counters allocated for every run. The graph variants build the graph
+ * once and re-run it.
+ *
+ * Argument: `threads`.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "i_job.h"
+#include "task_graph.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Nodes of the chain shape.
+ */
+constexpr size_t kChain = 1000;
+
+/**
+ * @brief Nodes per layer of the stencil shape.
+ */
+constexpr size_t kWidth = 16;
+
+/**
+ * @brief Layers of the stencil shape.
+ */
+constexpr size_t kDepth = 64;
+
+/**
+ * @brief Simulated work of one node; returns a value so it cannot be optimized out.
+ */
+std::uint64_t work(size_t node)
+{
+    std::uint64_t x = node + 1;
+    for (int r = 0; r < 64; ++r)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return x;
+}
+
+/**
+ * @brief State of one hand-chained run: a countdown per node and a done counter.
+ */
+struct ChainedRun
+{
+    ChainedRun(ThreadPool& pool, size_t nodes, std::atomic<std::uint64_t>& sink)
+        : pool(pool), countdown(nodes), done(0), sink(sink)
+    {
+    }
+
+    ThreadPool&                   pool;
+    std::vector<std::atomic<int>> countdown;
+    std::atomic<size_t>           done;
+    std::atomic<std::uint64_t>&   sink;
+};
+
+/**
+ * @brief Stencil node that enqueues its ready successors itself.
+ */
+class StencilJob : public IJob
+{
+   public:
+    StencilJob(ChainedRun& run, size_t node) : run(run), node(node) {}
+
+    void execute() override
+    {
+        run.sink.fetch_add(work(node), std::memory_order_relaxed);
+
+        const size_t layer = node / kWidth;
+        const size_t index = node % kWidth;
+        if (layer + 1 < kDepth)
+        {
+            // (d + 1, i) and (d + 1, i - 1) wait for this node
+            for (size_t next : {index, (index + kWidth - 1) % kWidth})
+            {
+                const size_t successor = (layer + 1) * kWidth + next;
+                if (run.countdown[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    run.pool.enqueue(std::make_unique<StencilJob>(run, successor));
+            }
+        }
+        run.done.fetch_add(1, std::memory_order_release);
+    }
+
+   private:
+    ChainedRun& run;
+    size_t      node;
+};
+
+/**
+ * @brief Chain node that enqueues the next one itself.
+ */
+class ChainJob : public IJob
+{
+   public:
+    ChainJob(ChainedRun& run, size_t node) : run(run), node(node) {}
+
+    void execute() override
+    {
+        run.sink.fetch_add(work(node), std::memory_order_relaxed);
+        if (node + 1 < kChain)
+            run.pool.enqueue(std::make_unique<ChainJob>(run, node + 1));
+        run.done.fetch_add(1, std::memory_order_release);
+    }
+
+   private:
+    ChainedRun& run;
+    size_t      node;
+};
+
+/**
+ * @brief Waits for `count` finished nodes.
+ */
+void awaitDone(const ChainedRun& run, size_t count)
+{
+    while (run.done.load(std::memory_order_acquire) < count)
+        std::this_thread::yield();
+}
+
+/**
+ * @brief Worker counts used by every benchmark in this file.
+ */
+void graphArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("threads")->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Benchmarks */
+
+/**
+ * @brief Chain, each job enqueuing the next.
+ */
+void BM_ChainHandChained(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::atomic<std::uint64_t> sink{0};
+
+    for (auto _ : state)
+    {
+        ChainedRun run(pool, kChain, sink);
+        pool.enqueue(std::make_unique<ChainJob>(run, 0));
+        awaitDone(run, kChain);
+    }
+    pool.shutdown();
+
+    benchmark::DoNotOptimize(sink.load());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kChain));
+}
+BENCHMARK(BM_ChainHandChained)->Apply(graphArgs);
+
+/**
+ * @brief Chain as a TaskGraph, built once.
+ */
+void BM_ChainGraph(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::atomic<std::uint64_t> sink{0};
+
+    TaskGraph graph(pool);
+    for (size_t node = 0; node < kChain; ++node)
+    {
+        auto step = [&sink, node] { sink.fetch_add(work(node), std::memory_order_relaxed); };
+        if (node == 0)
+            graph.add(step);
+        else
+            graph.add(step, {node - 1});
+    }
+
+    for (auto _ : state)
+    {
+        graph.run();
+        graph.wait();
+    }
+    pool.shutdown();
+
+    benchmark::DoNotOptimize(sink.load());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kChain));
+}
+BENCHMARK(BM_ChainGraph)->Apply(graphArgs);
+
+/**
+ * @brief Stencil, each job enqueuing the successors it made ready.
+ */
+void BM_StencilHandChained(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::atomic<std::uint64_t> sink{0};
+
+    for (auto _ : state)
+    {
+        ChainedRun run(pool, kWidth * kDepth, sink);
+        for (size_t node = kWidth; node < kWidth * kDepth; ++node)
+            run.countdown[node].store(2, std::memory_order_relaxed);
+        for (size_t node = 0; node < kWidth; ++node)
+            pool.enqueue(std::make_unique<StencilJob>(run, node));
+        awaitDone(run, kWidth * kDepth);
+    }
+    pool.shutdown();
+
+    benchmark::DoNotOptimize(sink.load());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kWidth * kDepth));
+}
+BENCHMARK(BM_StencilHandChained)->Apply(graphArgs);
+
+/**
+ * @brief Stencil as a TaskGraph, built once.
+ */
+void BM_StencilGraph(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::atomic<std::uint64_t> sink{0};
+
+    TaskGraph graph(pool);
+    for (size_t node = 0; node < kWidth * kDepth; ++node)
+    {
+        auto step = [&sink, node] { sink.fetch_add(work(node), std::memory_order_relaxed); };
+        if (node < kWidth)
+        {
+            graph.add(step);
+            continue;
+        }
+        const size_t above = node - kWidth;
+        const size_t layer = above / kWidth;
+        graph.add(step, {above, layer * kWidth + (above % kWidth + 1) % kWidth});
+    }
+
+    for (auto _ : state)
+    {
+        graph.run();
+        graph.wait();
+    }
+    pool.shutdown();
+
+    benchmark::DoNotOptimize(sink.load());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kWidth * kDepth));
+}
+BENCHMARK(BM_StencilGraph)->Apply(graphArgs);
@@ -0,0 +1,394 @@
+/**
+ * @file        bench_thread_pool.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief ThreadPool hot paths: submission latency, per-job overhead and shutdown time.
+ *
+ * @details
+ * - `BM_EnqueueToExecuteLatency`: time from `enqueue()` to the start of
+ *   `execute()` on an idle pool, reported as p50 / p90 / p99 / max counters.
+ * - `BM_EmptyJob*`: throughput of empty jobs through `enqueue()`, `post()`
+ *   and `enqueueBatch()`, i.e. the fixed cost the pool adds to every job.
+ * - `BM_Shutdown*`: time for `shutdown()` on an idle pool and on a pool
+ *   with a backlog to drain.
+ * - `BM_Pipeline*`: requests going through `kStages` short stages, each
+ *   stage chained by re-enqueueing an `IJob`, with `then()` or with
+ *   `thenInline()`.
+ *
+ * The argument is the number of worker threads.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "i_job.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Jobs submitted per iteration of the throughput benchmarks.
+ */
+constexpr int kJobsPerIteration = 1000;
+
+/**
+ * @brief Records when it started running.
+ */
+class StampJob : public IJob
+{
+   public:
+    explicit StampJob(std::atomic<int64_t>& startedAt) : startedAt(startedAt) {}
+
+    void execute() override
+    {
+        startedAt.store(Clock::now().time_since_epoch().count(), std::memory_order_release);
+    }
+
+   private:
+    std::atomic<int64_t>& startedAt;
+};
+
+/**
+ * @brief Does nothing but count itself.
+ */
+class EmptyJob : public IJob
+{
+   public:
+    explicit EmptyJob(std::atomic<int>& done) : done(done) {}
+
+    void execute() override { done.fetch_add(1, std::memory_order_release); }
+
+   private:
+    std::atomic<int>& done;
+};
+
+/**
+ * @brief Stages of every request of the pipeline benchmarks.
+ */
+constexpr int kStages = 4;
+
+/**
+ * @brief Requests in flight per iteration of the pipeline benchmarks.
+ */
+constexpr int kRequests = 250;
+
+/**
+ * @brief Per-request data every stage of the pipeline touches.
+ */
+struct Request
+{
+    std::array<std::uint32_t, 256> data{};
+};
+
+/**
+ * @brief One pipeline stage: a pass over the request's data.
+ */
+Request* stage(Request* request)
+{
+    for (auto& value : request->data)
+        value = value * 3 + 1;
+    return request;
+}
+
+/**
+ * @brief Pipeline stage that enqueues the next stage itself.
+ */
+class StageJob : public IJob
+{
+   public:
+    StageJob(ThreadPool& pool, Request* request, int index, std::atomic<int>& done)
+        : pool(pool), request(request), index(index), done(done)
+    {
+    }
+
+    void execute() override
+    {
+        stage(request);
+        if (index + 1 < kStages)
+            pool.enqueue(std::make_unique<StageJob>(pool, request, index + 1, done));
+        else
+            done.fetch_add(1, std::memory_order_release);
+    }
+
+   private:
+    ThreadPool&       pool;
+    Request*          request;
+    int               index;
+    std::atomic<int>& done;
+};
+
+/**
+ * @brief Spins (yielding) until `done` reaches `expected`, then resets it.
+ */
+void waitAndReset(std::atomic<int>& done, int expected)
+{
+    while (done.load(std::memory_order_acquire) < expected)
+        std::this_thread::yield();
+    done.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Value at percentile `p` (0..1) of sorted `samples`.
+ */
+double percentile(const std::vector<double>& samples, double p)
+{
+    if (samples.empty())
+        return 0.0;
+    const size_t index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1));
+    return samples[index];
+}
+
+/**
+ * @brief Worker counts used by every benchmark in this file.
+ */
+void threadArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("threads")->Arg(1)->Arg(2)->Arg(4);
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Benchmarks */
+
+/**
+ * @brief One job at a time: enqueue, then wait until it has started.
+ */
+void BM_EnqueueToExecuteLatency(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+
+    std::atomic<int64_t> startedAt{0};
+    std::vector<double>  samples;
+
+    for (auto _ : state)
+    {
+        startedAt.store(0, std::memory_order_relaxed);
+        const int64_t submittedAt = Clock::now().time_since_epoch().count();
+        pool.enqueue(std::make_unique<StampJob>(startedAt));
+
+        int64_t started;
+        while ((started = startedAt.load(std::memory_order_acquire)) == 0)
+            std::this_thread::yield();
+
+        samples.push_back(
+            std::chrono::duration<double, std::micro>(Clock::duration(started - submittedAt))
+                .count());
+    }
+    pool.shutdown();
+
+    std::sort(samples.begin(), samples.end());
+    state.counters["p50_us"] = percentile(samples, 0.50);
+    state.counters["p90_us"] = percentile(samples, 0.90);
+    state.counters["p99_us"] = percentile(samples, 0.99);
+    state.counters["max_us"] = samples.empty() ? 0.0 : samples.back();
+}
+BENCHMARK(BM_EnqueueToExecuteLatency)->Apply(threadArgs)->UseRealTime();
+
+/**
+ * @brief Empty `IJob`s through `enqueue()`.
+ */
+void BM_EmptyJobEnqueue(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::atomic<int> done{0};
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < kJobsPerIteration; ++i)
+            pool.enqueue(std::make_unique<EmptyJob>(done));
+        waitAndReset(done, kJobsPerIteration);
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * kJobsPerIteration);
+}
+BENCHMARK(BM_EmptyJobEnqueue)->Apply(threadArgs)->UseRealTime();
+
+/**
+ * @brief Empty lambdas through `post()` (inline `Task`, no allocation).
+ */
+void BM_EmptyJobPost(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::atomic<int> done{0};
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < kJobsPerIteration; ++i)
+            pool.post([&done] { done.fetch_add(1, std::memory_order_release); });
+        waitAndReset(done, kJobsPerIteration);
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * kJobsPerIteration);
+}
+BENCHMARK(BM_EmptyJobPost)->Apply(threadArgs)->UseRealTime();
+
+/**
+ * @brief Empty `IJob`s through one `enqueueBatch()` per iteration.
+ */
+void BM_EmptyJobBatch(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::atomic<int> done{0};
+
+    for (auto _ : state)
+    {
+        std::vector<std::unique_ptr<IJob>> jobs;
+        jobs.reserve(kJobsPerIteration);
+        for (int i = 0; i < kJobsPerIteration; ++i)
+            jobs.push_back(std::make_unique<EmptyJob>(done));
+        pool.enqueueBatch(std::move(jobs));
+        waitAndReset(done, kJobsPerIteration);
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * kJobsPerIteration);
+}
+BENCHMARK(BM_EmptyJobBatch)->Apply(threadArgs)->UseRealTime();
+
+/**
+ * @brief `shutdown()` of an idle pool (wake, close, join).
+ */
+void BM_ShutdownIdle(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        ThreadPool pool;
+        pool.start(static_cast<size_t>(state.range(0)));
+
+        const auto begin = Clock::now();
+        pool.shutdown();
+        state.SetIterationTime(std::chrono::duration<double>(Clock::now() - begin).count());
+    }
+}
+BENCHMARK(BM_ShutdownIdle)->Apply(threadArgs)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief `shutdown()` of a pool that still has `kJobsPerIteration` empty jobs queued.
+ */
+void BM_ShutdownWithBacklog(benchmark::State& state)
+{
+    std::atomic<int> done{0};
+
+    for (auto _ : state)
+    {
+        ThreadPool pool;
+        pool.start(static_cast<size_t>(state.range(0)));
+        for (int i = 0; i < kJobsPerIteration; ++i)
+            pool.post([&done] { done.fetch_add(1, std::memory_order_relaxed); });
+
+        const auto begin = Clock::now();
+        pool.shutdown();
+        state.SetIterationTime(std::chrono::duration<double>(Clock::now() - begin).count());
+    }
+
+    benchmark::DoNotOptimize(done.load());
+}
+BENCHMARK(BM_ShutdownWithBacklog)
+    ->Apply(threadArgs)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Pipeline whose stages re-enqueue the next one (`IJob`).
+ */
+void BM_PipelineEnqueue(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::vector<Request> requests(kRequests);
+    std::atomic<int>     done{0};
+
+    for (auto _ : state)
+    {
+        for (auto& request : requests)
+            pool.enqueue(std::make_unique<StageJob>(pool, &request, 0, done));
+        waitAndReset(done, kRequests);
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * kRequests);
+}
+BENCHMARK(BM_PipelineEnqueue)->Apply(threadArgs)->UseRealTime();
+
+/**
+ * @brief Pipeline chained with `then()` (every stage dispatched to the pool).
+ */
+void BM_PipelineThen(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::vector<Request> requests(kRequests);
+    std::atomic<int>     done{0};
+
+    for (auto _ : state)
+    {
+        for (auto& request : requests)
+        {
+            TaskFuture<Request*> chain = pool.submit([&request] { return stage(&request); });
+            for (int i = 1; i < kStages; ++i)
+                chain = chain.then(stage);
+            chain.then([&done](Request*) { done.fetch_add(1, std::memory_order_release); });
+        }
+        waitAndReset(done, kRequests);
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * kRequests);
+}
+BENCHMARK(BM_PipelineThen)->Apply(threadArgs)->UseRealTime();
+
+/**
+ * @brief Pipeline chained with `thenInline()` (stages run on the completing worker).
+ */
+void BM_PipelineThenInline(benchmark::State& state)
+{
+    ThreadPool pool;
+    pool.start(static_cast<size_t>(state.range(0)));
+    std::vector<Request> requests(kRequests);
+    std::atomic<int>     done{0};
+
+    for (auto _ : state)
+    {
+        for (auto& request : requests)
+        {
+            TaskFuture<Request*> chain = pool.submit([&request] { return stage(&request); });
+            for (int i = 1; i < kStages; ++i)
+                chain = chain.thenInline(stage);
+            chain.thenInline([&done](Request*) { done.fetch_add(1, std::memory_order_release); });
+        }
+        waitAndReset(done, kRequests);
+    }
+    pool.shutdown();
+
+    state.SetItemsProcessed(state.iterations() * kRequests);
+}
+BENCHMARK(BM_PipelineThenInline)->Apply(threadArgs)->UseRealTime();
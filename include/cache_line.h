@@ -0,0 +1,32 @@
+/**
+ * @file        cache_line.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Cache-line size constant used to avoid false sharing.
+ *
+ * @details
+ * `std::hardware_destructive_interference_size` is only available from
+ * C++17, so the project keeps its own constant. 64 bytes matches every
+ * x86-64 and most ARMv8 parts.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstddef>
+
+/*****************************************************************************/
+
+/**
+ * @brief Assumed size of a cache line, in bytes.
+ */
+constexpr std::size_t kCacheLineSize = 64;
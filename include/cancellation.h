@@ -0,0 +1,219 @@
+/**
+ * @file        cancellation.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Cooperative cancellation tokens and per-job deadlines.
+ *
+ * @details
+ * A `CancellationSource` owns one shared flag; the `CancellationToken`s it
+ * hands out only read it, so checking a token from `execute()` is a single
+ * atomic load. Cancelling never interrupts a running job: jobs that care
+ * poll their token.
+ *
+ * A `JobGuard` (token and/or deadline) attached at submission lets the
+ * workers drop the job when they dequeue it, without running it, if the
+ * token was cancelled or the deadline has passed meanwhile.
+ *
+ * Example:
+ * @code
+ * CancellationSource request;
+ * pool.post([token = request.token()] { while (!token.isCancelled()) step(); },
+ *           JobGuard(request.token(), std::chrono::milliseconds(50)));
+ * request.cancel();   // skipped if still queued, stops at the next poll otherwise
+ * @endcode
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+/*****************************************************************************/
+
+/**
+ * @class CancellationToken
+ * @brief Read-only view of a cancellation flag; cheap to copy and to check.
+ *
+ * @details
+ * A default-constructed token is never cancelled.
+ */
+class CancellationToken
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs a token that can never be cancelled.
+     */
+    CancellationToken() = default;
+
+    /**
+     * @brief Returns whether the owning source was cancelled.
+     */
+    bool isCancelled() const noexcept
+    {
+        return flag && flag->load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns whether the token is attached to a source.
+     */
+    bool cancellable() const noexcept { return flag != nullptr; }
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    friend class CancellationSource;
+
+    /**
+     * @brief Shares the flag of a source.
+     */
+    explicit CancellationToken(std::shared_ptr<const std::atomic<bool>> flag)
+        : flag(std::move(flag))
+    {
+    }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Flag shared with the source, `nullptr` for a detached token.
+     */
+    std::shared_ptr<const std::atomic<bool>> flag;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @class CancellationSource
+ * @brief Owner of a cancellation flag; hands out tokens and cancels them all at once.
+ */
+class CancellationSource
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Creates a source that is not cancelled yet.
+     */
+    CancellationSource() : flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+    /**
+     * @brief Returns a token observing this source.
+     */
+    CancellationToken token() const { return CancellationToken(flag); }
+
+    /**
+     * @brief Cancels every token of this source (idempotent).
+     */
+    void cancel() noexcept { flag->store(true, std::memory_order_release); }
+
+    /**
+     * @brief Returns whether `cancel()` was called.
+     */
+    bool isCancelled() const noexcept { return flag->load(std::memory_order_acquire); }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Flag shared with the tokens.
+     */
+    std::shared_ptr<std::atomic<bool>> flag;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @struct JobGuard
+ * @brief Conditions under which a queued job is dropped instead of run.
+ */
+struct JobGuard
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Outcome of `check()`.
+     */
+    enum class Verdict
+    {
+        Run,       /**< Still wanted. */
+        Cancelled, /**< The token was cancelled. */
+        Expired    /**< The deadline has passed. */
+    };
+
+    /**
+     * @brief No token, no deadline: the job always runs.
+     */
+    JobGuard() = default;
+
+    /**
+     * @brief Drops the job once `token` is cancelled.
+     */
+    JobGuard(CancellationToken token) : token(std::move(token)) {}
+
+    /**
+     * @brief Drops the job if it is dequeued after `deadline`.
+     */
+    JobGuard(Clock::time_point deadline) : deadline(deadline) {}
+
+    /**
+     * @brief Drops the job if it is dequeued more than `timeout` from now.
+     */
+    template <typename Rep, typename Period>
+    JobGuard(const std::chrono::duration<Rep, Period>& timeout)
+        : deadline(Clock::now() + std::chrono::duration_cast<Clock::duration>(timeout))
+    {
+    }
+
+    /**
+     * @brief Both conditions.
+     */
+    template <typename Deadline>
+    JobGuard(CancellationToken token, const Deadline& deadline)
+        : JobGuard(deadline)
+    {
+        this->token = std::move(token);
+    }
+
+    /**
+     * @brief Cancellation first (no clock read), then the deadline.
+     */
+    Verdict check() const
+    {
+        if (token.isCancelled())
+            return Verdict::Cancelled;
+        if (deadline != Clock::time_point::max() && Clock::now() > deadline)
+            return Verdict::Expired;
+        return Verdict::Run;
+    }
+
+    CancellationToken token;                               /**< Never cancelled by default. */
+    Clock::time_point deadline = Clock::time_point::max(); /**< No deadline by default. */
+};
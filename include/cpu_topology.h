@@ -0,0 +1,167 @@
+/**
+ * @file        cpu_topology.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Logical CPUs grouped by core and package, and worker placement orders.
+ *
+ * @details
+ * On Linux the topology is read from `/sys/devices/system/cpu`:
+ *  - `online` lists the usable logical CPUs (e.g. `0-7,16-23`);
+ *  - `cpuN/topology/core_id` and `cpuN/topology/physical_package_id` give
+ *    the physical core and socket of each of them;
+ * and NUMA nodes from `/sys/devices/system/node/nodeN/cpulist`.
+ * Where the CPU tree is missing, every one of `std::thread::hardware_concurrency()`
+ * CPUs is reported as its own core on package 0; without the node tree every
+ * CPU is on node 0.
+ *
+ * Placement orders (used by `ThreadPoolConfig::cpuPlacement`):
+ *  - compact: fill a core's hyper-threads, then the next core, then the next
+ *    package, so workers share caches;
+ *  - scatter: one CPU per core, alternating packages, before any second
+ *    hyper-thread, so workers get the most cache and memory bandwidth each.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*****************************************************************************/
+
+/**
+ * @brief One logical CPU.
+ */
+struct CpuInfo
+{
+    int cpu     = 0; /**< Logical CPU number (as used by the scheduler). */
+    int core    = 0; /**< Physical core id, unique within its package. */
+    int package = 0; /**< Physical package (socket) id. */
+    int node    = 0; /**< NUMA node id. */
+};
+
+/*****************************************************************************/
+
+/**
+ * @class CpuTopology
+ * @brief Immutable list of logical CPUs with filters and placement orders.
+ */
+class CpuTopology
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Wraps an explicit CPU list (sorted by CPU number).
+     */
+    explicit CpuTopology(std::vector<CpuInfo> cpus);
+
+    /**
+     * @brief Reads the topology of this machine.
+     *
+     * @param sysfsRoot Directory laid out like `/sys/devices/system/cpu`.
+     * @param nodeRoot  Directory laid out like `/sys/devices/system/node`.
+     */
+    static CpuTopology detect(const std::string& sysfsRoot = "/sys/devices/system/cpu",
+                              const std::string& nodeRoot  = "/sys/devices/system/node");
+
+    /**
+     * @brief Parses a kernel CPU list such as `0-3,8,10-11`.
+     *
+     * @return The CPU numbers in ascending order; malformed items are skipped.
+     */
+    static std::vector<int> parseCpuList(const std::string& list);
+
+    /**
+     * @brief Restricts the calling thread to `cpu`.
+     *
+     * @return false if the platform does not support it or the CPU is not allowed.
+     */
+    static bool pinCurrentThread(int cpu);
+
+    /**
+     * @brief Restricts the calling thread to the CPUs of `cpus`.
+     *
+     * @return false if the platform does not support it or no CPU is allowed.
+     */
+    static bool pinCurrentThread(const std::vector<int>& cpus);
+
+    /**
+     * @brief Returns the CPU the calling thread is running on (-1 if unknown).
+     */
+    static int currentCpu();
+
+    /**
+     * @brief Returns the logical CPUs.
+     */
+    const std::vector<CpuInfo>& cpus() const { return list; }
+
+    /**
+     * @brief Returns the number of logical CPUs.
+     */
+    size_t size() const { return list.size(); }
+
+    /**
+     * @brief Returns the distinct package ids, ascending.
+     */
+    std::vector<int> packages() const;
+
+    /**
+     * @brief Returns the distinct NUMA node ids, ascending.
+     */
+    std::vector<int> nodes() const;
+
+    /**
+     * @brief Returns the CPUs of package `id` only.
+     */
+    CpuTopology onPackage(int id) const;
+
+    /**
+     * @brief Returns the CPUs of NUMA node `id` only.
+     */
+    CpuTopology onNode(int id) const;
+
+    /**
+     * @brief Returns the CPU numbers, ascending.
+     */
+    std::vector<int> cpuNumbers() const;
+
+    /**
+     * @brief Returns the lowest-numbered CPU of every core (no hyper-thread siblings).
+     */
+    CpuTopology physicalCores() const;
+
+    /**
+     * @brief Returns the CPU numbers in compact order (siblings, cores, then packages).
+     */
+    std::vector<int> compactOrder() const;
+
+    /**
+     * @brief Returns the CPU numbers in scatter order (packages, cores, then siblings).
+     */
+    std::vector<int> scatterOrder() const;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief CPUs sorted by number.
+     */
+    std::vector<CpuInfo> list;
+
+    /******************************************************************/
+};
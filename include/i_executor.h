@@ -0,0 +1,54 @@
+/**
+ * @file        i_executor.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Minimal interface for anything that can run a `Task`.
+ *
+ * @details
+ * Higher-level building blocks (futures and their continuations, ...) only
+ * need a way to hand a Task over for asynchronous execution. Depending on
+ * this interface instead of `ThreadPool` keeps them free of include cycles
+ * and easy to test.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @class IExecutor
+ * @brief Abstract sink of Tasks.
+ */
+class IExecutor
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Virtual destructor for safe polymorphic cleanup.
+     */
+    virtual ~IExecutor() = default;
+
+    /**
+     * @brief Schedules `task` for asynchronous execution.
+     *
+     * @param task Non-empty task; ownership is transferred.
+     */
+    virtual void dispatch(Task task) = 0;
+
+    /******************************************************************/
+};
@@ -0,0 +1,339 @@
+/**
+ * @file        i_job_queue.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Interface shared by every job queue backend.
+ *
+ * @details
+ * The ThreadPool does not depend on a concrete queue implementation. Any
+ * backend that satisfies this contract can be plugged in through
+ * `ThreadPoolConfig::queueBackend`:
+ *  - `JobQueue`: unbounded FIFO protected by a mutex.
+ *  - `RingJobQueue`: bounded lock-free MPMC ring buffer.
+ *
+ * The element type is `Task`; the `IJob` based `push()` / `pop()` helpers
+ * are kept for existing callers and adapt jobs without extra allocations.
+ *
+ * ### Batches:
+ * `pushTasks()` / `popTasks()` move several tasks per call so that a backend
+ * can pay its synchronization cost (lock, notify, ...) once per batch. The
+ * defaults below simply loop over the single-task operations.
+ *
+ * ### Common semantics:
+ * - **Open**: accepts new jobs; `pop()` may block.
+ * - **Closed**: `pop()` keeps returning jobs until the queue drains and then
+ *   returns `nullptr`.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+/* Project libraries */
+
+#include "i_job.h"
+#include "job_priority.h"
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @class IJobQueue
+ * @brief Abstract multi-producer / multi-consumer job queue.
+ *
+ * @details
+ * All operations must be thread-safe. Implementations are free to choose
+ * their own synchronization strategy (locks, atomics, ...).
+ */
+class IJobQueue
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Virtual destructor for safe polymorphic cleanup.
+     */
+    virtual ~IJobQueue() = default;
+
+    /**
+     * @brief Pushes a task into the queue.
+     *
+     * @param task Non-empty task to insert.
+     */
+    virtual void pushTask(Task task) = 0;
+
+    /**
+     * @brief Pushes a task with a scheduling priority.
+     *
+     * @param task     Non-empty task to insert.
+     * @param priority Requested priority.
+     *
+     * @details
+     * Backends without priority lanes (the default) keep plain FIFO order.
+     */
+    virtual void pushPriorityTask(Task task, JobPriority priority)
+    {
+        (void)priority;
+        pushTask(std::move(task));
+    }
+
+    /**
+     * @brief Pushes a task unless the queue has no room for it (non-blocking).
+     *
+     * @param task     Non-empty task; moved from only on success.
+     * @param priority Requested priority.
+     * @return `false` if the queue is full.
+     *
+     * @details
+     * Unbounded backends (the default) always succeed.
+     */
+    virtual bool tryPushPriorityTask(Task& task, JobPriority priority)
+    {
+        pushPriorityTask(std::move(task), priority);
+        return true;
+    }
+
+    /**
+     * @brief Pops the next available task (blocking).
+     *
+     * @param task Receives the task on success.
+     * @return `false` if the queue is closed and drained (or `interrupt()`ed while empty).
+     */
+    virtual bool popTask(Task& task) = 0;
+
+    /**
+     * @brief Pops the next available task without blocking.
+     *
+     * @param task Receives the task on success.
+     * @return `false` if the queue is currently empty.
+     */
+    virtual bool tryPopTask(Task& task) = 0;
+
+    /**
+     * @brief Pops the task to sacrifice when the queue overflows (non-blocking).
+     *
+     * @param task Receives the task on success.
+     * @return `false` if the queue is currently empty.
+     *
+     * @details
+     * Used by `OverflowPolicy::DropOldest`. Backends without priority lanes
+     * (the default) give up their oldest task, the one `tryPopTask()` returns.
+     */
+    virtual bool tryPopVictim(Task& task) { return tryPopTask(task); }
+
+    /**
+     * @brief Pushes `count` tasks, in order.
+     *
+     * @param tasks Array of non-empty tasks; each one is moved from.
+     * @param count Number of tasks in `tasks`.
+     */
+    virtual void pushTasks(Task* tasks, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            pushTask(std::move(tasks[i]));
+    }
+
+    /**
+     * @brief Pops up to `max_count` tasks, blocking only for the first one.
+     *
+     * @param out       Receives the tasks, oldest first.
+     * @param max_count Capacity of `out`.
+     * @param consumers Number of threads sharing this queue (fairness hint).
+     * @return Number of tasks popped; `0` if the queue is closed and drained.
+     *
+     * @details
+     * A consumer never takes more than its fair share, `size() / consumers + 1`,
+     * so one thread cannot hoard work the others are idle for.
+     */
+    virtual size_t popTasks(Task* out, size_t max_count, size_t consumers = 1)
+    {
+        if (max_count == 0 || !popTask(out[0]))
+            return 0;
+
+        return 1 + popMore(out + 1, fairShare(size(), max_count - 1, consumers));
+    }
+
+    /**
+     * @brief Pops up to `max_count` tasks without blocking.
+     *
+     * @param out       Receives the tasks, oldest first.
+     * @param max_count Capacity of `out`.
+     * @param consumers Number of threads sharing this queue (fairness hint).
+     * @return Number of tasks popped; `0` if the queue is currently empty.
+     */
+    virtual size_t tryPopTasks(Task* out, size_t max_count, size_t consumers = 1)
+    {
+        if (max_count == 0 || !tryPopTask(out[0]))
+            return 0;
+
+        return 1 + popMore(out + 1, fairShare(size(), max_count - 1, consumers));
+    }
+
+    /**
+     * @brief Pushes a job into the queue.
+     *
+     * @param job Exclusive pointer to the job to insert (must be non-null).
+     *
+     * @details
+     * Convenience wrapper: the job is adapted into a `Task` without any
+     * extra allocation.
+     */
+    void push(std::unique_ptr<IJob> job) { pushTask(Task(std::move(job))); }
+
+    /**
+     * @brief Pushes a job with a scheduling priority.
+     */
+    void push(std::unique_ptr<IJob> job, JobPriority priority)
+    {
+        pushPriorityTask(Task(std::move(job)), priority);
+    }
+
+    /**
+     * @brief Pops the next available job (blocking).
+     *
+     * @return The next job, or `nullptr` if the queue is closed and drained.
+     */
+    std::unique_ptr<IJob> pop()
+    {
+        Task task;
+        return popTask(task) ? task.releaseJob() : nullptr;
+    }
+
+    /**
+     * @brief Pops the next available job without blocking.
+     *
+     * @return The next job, or `nullptr` if the queue is currently empty.
+     */
+    std::unique_ptr<IJob> tryPop()
+    {
+        Task task;
+        return tryPopTask(task) ? task.releaseJob() : nullptr;
+    }
+
+    /**
+     * @brief Pushes every job of `jobs` with a single `pushTasks()` call.
+     *
+     * @param jobs Any range of `std::unique_ptr<IJob>`; its elements are moved
+     *             from. Null entries are skipped.
+     */
+    template <typename Range>
+    void pushBatch(Range&& jobs)
+    {
+        std::vector<Task> tasks;
+        tasks.reserve(static_cast<size_t>(std::distance(std::begin(jobs), std::end(jobs))));
+        for (auto& job : jobs)
+        {
+            if (job)
+                tasks.emplace_back(std::move(job));
+        }
+
+        if (!tasks.empty())
+            pushTasks(tasks.data(), tasks.size());
+    }
+
+    /**
+     * @brief Pops up to `max_n` jobs (blocking for the first one).
+     *
+     * @return The jobs, oldest first; empty if the queue is closed and drained.
+     */
+    std::vector<std::unique_ptr<IJob>> popBatch(size_t max_n)
+    {
+        std::vector<Task>                  tasks(max_n);
+        std::vector<std::unique_ptr<IJob>> jobs;
+
+        const size_t count = popTasks(tasks.data(), max_n);
+        jobs.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            jobs.push_back(tasks[i].releaseJob());
+        return jobs;
+    }
+
+    /**
+     * @brief Returns whether the queue is currently empty (snapshot).
+     */
+    virtual bool empty() const = 0;
+
+    /**
+     * @brief Returns the number of pending jobs (snapshot).
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * @brief Removes all pending jobs.
+     */
+    virtual void clear() = 0;
+
+    /**
+     * @brief Closes the queue and wakes all waiting consumers.
+     */
+    virtual void shutdown() = 0;
+
+    /**
+     * @brief Returns whether the queue is closed.
+     */
+    virtual bool is_closed() = 0;
+
+    /**
+     * @brief Lets the next `count` blocking pops that find the queue empty return.
+     *
+     * @details
+     * Consumers blocked in `popTask()` / `popTasks()` are woken; up to `count`
+     * of them (or of the next callers) return `false` / `0` although the queue
+     * is still open, so they can re-check state of their own (the pool uses it
+     * to retire workers). Wake-ups are not lost if nobody is blocked yet.
+     * Backends that do not override it only wake consumers on push and on
+     * `shutdown()`.
+     */
+    virtual void interrupt(size_t count) { (void)count; }
+
+    /******************************************************************/
+
+    /* Protected Methods */
+
+   protected:
+    /**
+     * @brief Number of extra tasks a consumer may take from `available`.
+     *
+     * @details
+     * `available / consumers`, capped at `max_count`: the share of the
+     * backlog that belongs to one of `consumers` threads.
+     */
+    static size_t fairShare(size_t available, size_t max_count, size_t consumers)
+    {
+        return std::min(max_count, available / std::max<size_t>(consumers, 1));
+    }
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Pops up to `count` tasks with `tryPopTask()`.
+     */
+    size_t popMore(Task* out, size_t count)
+    {
+        size_t popped = 0;
+        while (popped < count && tryPopTask(out[popped]))
+            ++popped;
+        return popped;
+    }
+
+    /******************************************************************/
+};
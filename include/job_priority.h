@@ -0,0 +1,52 @@
+/**
+ * @file        job_priority.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Priority levels understood by the job queues.
+ *
+ * @details
+ * The number of levels is fixed at compile time so that a queue can keep
+ * one lane per level plus a bitmap of non-empty lanes and pick the next
+ * lane in constant time.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstddef>
+
+/*****************************************************************************/
+
+/**
+ * @enum JobPriority
+ * @brief Scheduling priority of a job, highest first.
+ */
+enum class JobPriority : unsigned
+{
+    Critical = 0, /**< Latency-critical work; always served first. */
+    High     = 1, /**< Interactive work. */
+    Normal   = 2, /**< Default level of every submission without a priority. */
+    Low      = 3  /**< Bulk / backfill work. */
+};
+
+/**
+ * @brief Number of `JobPriority` levels (one queue lane each).
+ */
+constexpr size_t kPriorityLevels = 4;
+
+/**
+ * @brief Lane index of `priority` (0 = highest).
+ */
+constexpr size_t laneOf(JobPriority priority)
+{
+    return static_cast<size_t>(priority);
+}
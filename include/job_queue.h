@@ -15,13 +15,20 @@
  *
  * ### Concurrency guarantees:
  * - All operations are thread-safe.
- * - FIFO ordering is strictly preserved.
+ * - FIFO ordering is strictly preserved within a priority level.
  * - `pop()` blocks until a job becomes available or the queue is closed.
  * - Once closed, consumers are awakened and eventually return `nullptr`.
  *
  * ### Design:
- * - Uses `std::unique_ptr<IJob>` for exclusive ownership.
+ * - Stores `Task`s; `IJob`s are adapted on `push()` without extra allocation.
  * - Protected internally by `std::mutex` and a `std::condition_variable`.
+ * - One lane per `JobPriority`; a bitmap of non-empty lanes makes picking the
+ *   highest non-empty lane O(1). Plain `push()` uses the `Normal` lane.
+ * - Optional aging: a lane passed over `aging_threshold` times is served
+ *   next, so low lanes progress under sustained high-priority load.
+ * - Optional spin phase (`SpinPolicy`): an idle consumer spins on the
+ *   lock-free task count before blocking, and producers only notify when
+ *   there are more tasks than spinning consumers.
  */
 
 /*****************************************************************************/
@@ -34,6 +41,8 @@
 
 /* Standard libraries */
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -42,6 +51,10 @@
 /* Project libraries */
 
 #include "i_job.h"
+#include "i_job_queue.h"
+#include "job_priority.h"
+#include "spin_wait.h"
+#include "task.h"
 
 /*****************************************************************************/
 
@@ -60,7 +73,7 @@
  * - **Closed**: rejects no jobs explicitly, but `pop()` returns `nullptr`
  *   once the queue drains.
  */
-class JobQueue
+class JobQueue : public IJobQueue
 {
     /******************************************************************/
 
@@ -69,8 +82,13 @@ class JobQueue
    public:
     /**
      * @brief Constructs an empty, open queue.
+     *
+     * @param aging_threshold Times a waiting lane may be passed over by
+     *                        higher lanes before it is served (0 = strict
+     *                        priority, lower lanes may starve).
+     * @param spin_policy     Spin phase of idle consumers before blocking (none by default).
      */
-    explicit JobQueue() = default;
+    explicit JobQueue(size_t aging_threshold = 0, const SpinPolicy& spin_policy = SpinPolicy{});
 
     /**
      * @brief Default destructor.
@@ -79,7 +97,7 @@ class JobQueue
      * If the queue was closed via `shutdown()`, any threads blocked on
      * `pop()` will already have been awakened.
      */
-    ~JobQueue() = default;
+    ~JobQueue() override = default;
 
     /**
      * @brief Disable copy constructor.
@@ -113,47 +131,90 @@ class JobQueue
     JobQueue& operator=(JobQueue&&) = delete;
 
     /**
-     * @brief Pushes a job into the queue.
+     * @brief Pushes a task into the queue.
      *
-     * @param job Exclusive pointer to the job to insert (must be non-null).
+     * @param task Non-empty task to insert.
      *
      * @details
      * Wakes one waiting consumer if any are blocked on `pop()`.
      */
-    void push(std::unique_ptr<IJob> job);
+    void pushTask(Task task) override;
+
+    /**
+     * @brief Pushes a task into the lane of `priority`.
+     *
+     * @param task     Non-empty task to insert.
+     * @param priority Lane the task is appended to.
+     */
+    void pushPriorityTask(Task task, JobPriority priority) override;
 
     /**
-     * @brief Pops the next available job (blocking).
+     * @brief Pops the next available task (blocking).
      *
-     * @return A `std::unique_ptr<IJob>` containing the next job, or `nullptr`
-     *         if the queue has been closed and no jobs remain.
+     * @param task Receives the next task.
+     * @return `false` if the queue has been closed and no tasks remain.
      *
      * @details
      * - Blocks while the queue is empty and still open.
-     * - If the queue is closed and empty, returns `nullptr` immediately.
+     * - If the queue is closed and empty, returns `false` immediately.
+     */
+    bool popTask(Task& task) override;
+
+    /**
+     * @brief Pops the next available task without blocking.
+     *
+     * @param task Receives the next task.
+     * @return `false` if the queue is currently empty (regardless of the
+     *         open/closed state).
+     */
+    bool tryPopTask(Task& task) override;
+
+    /**
+     * @brief Pops the oldest task of the lowest-priority non-empty lane (non-blocking).
+     *
+     * @param task Receives the task.
+     * @return `false` if the queue is currently empty.
+     */
+    bool tryPopVictim(Task& task) override;
+
+    /**
+     * @brief Appends `count` tasks under a single lock acquisition.
+     *
+     * @details
+     * Wakes one consumer for a single task and every consumer otherwise.
+     */
+    void pushTasks(Task* tasks, size_t count) override;
+
+    /**
+     * @brief Pops up to a fair share of `max_count` tasks under one lock (blocking).
+     */
+    size_t popTasks(Task* out, size_t max_count, size_t consumers = 1) override;
+
+    /**
+     * @brief Pops up to a fair share of `max_count` tasks under one lock (non-blocking).
      */
-    std::unique_ptr<IJob> pop();
+    size_t tryPopTasks(Task* out, size_t max_count, size_t consumers = 1) override;
 
     /**
      * @brief Returns whether the queue is currently empty.
      *
      * @note Thread-safe.
      */
-    bool empty() const;
+    bool empty() const override;
 
     /**
      * @brief Returns the number of pending jobs.
      *
      * @note Thread-safe.
      */
-    size_t size() const;
+    size_t size() const override;
 
     /**
      * @brief Removes all pending jobs.
      *
      * @warning Does not affect the open/closed state of the queue.
      */
-    void clear();
+    void clear() override;
 
     /**
      * @brief Closes the queue and wakes all waiting threads.
@@ -163,12 +224,56 @@ class JobQueue
      *  - Consumers eventually return `nullptr` from `pop()`.
      *  - The queue will not block again.
      */
-    void shutdown();
+    void shutdown() override;
 
     /**
      * @brief Returns whether the queue is closed.
      */
-    bool is_closed();
+    bool is_closed() override;
+
+    /**
+     * @brief Lets the next `count` pops that find the queue empty return.
+     */
+    void interrupt(size_t count) override;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Runs the spin phase, then blocks under `mtx` until a pop can return.
+     *
+     * @return The held lock.
+     */
+    std::unique_lock<std::mutex> waitLocked();
+
+    /**
+     * @brief Returns whether a push must notify `cv`. Requires `mtx`.
+     */
+    bool mustNotifyLocked() const;
+
+    /**
+     * @brief Moves the front task and its fair share of followers into `out`.
+     *
+     * @pre `mtx` is held and the queue is not empty.
+     */
+    size_t takeLocked(Task* out, size_t max_count, size_t consumers);
+
+    /**
+     * @brief Appends `task` to `lane`. Requires `mtx`.
+     */
+    void pushLocked(Task&& task, size_t lane);
+
+    /**
+     * @brief Pops the next task in priority order. Requires `mtx` and `queued > 0`.
+     */
+    void popLocked(Task& task);
+
+    /**
+     * @brief Chooses the lane to serve and updates the aging state. Requires `mtx`.
+     */
+    size_t selectLaneLocked();
 
     /******************************************************************/
 
@@ -176,9 +281,34 @@ class JobQueue
 
    private:
     /**
-     * @brief FIFO storage.
+     * @brief One FIFO lane per priority level, highest first.
+     */
+    std::array<std::deque<Task>, kPriorityLevels> lanes;
+
+    /**
+     * @brief Total number of tasks across all lanes (written under `mtx`, read lock-free).
+     */
+    std::atomic<size_t> queued{0};
+
+    /**
+     * @brief Bit `i` set when `lanes[i]` is not empty.
      */
-    std::deque<std::unique_ptr<IJob>> buffer;
+    unsigned nonEmptyLanes = 0;
+
+    /**
+     * @brief Bit `i` set when `lanes[i]` reached the aging threshold.
+     */
+    unsigned starvingLanes = 0;
+
+    /**
+     * @brief Pops served by a higher lane while each lane was waiting.
+     */
+    std::array<size_t, kPriorityLevels> passedOver{};
+
+    /**
+     * @brief Aging threshold (0 = strict priority).
+     */
+    const size_t agingThreshold;
 
     /**
      * @brief Synchronization primitive.
@@ -195,5 +325,20 @@ class JobQueue
      */
     bool closed = false;
 
+    /**
+     * @brief Pending `interrupt()` wake-ups.
+     */
+    size_t interrupts = 0;
+
+    /**
+     * @brief Consumers blocked (or about to block) on `cv` (protected by `mtx`).
+     */
+    size_t sleepers = 0;
+
+    /**
+     * @brief Spin phase run before blocking.
+     */
+    SpinWait spin;
+
     /******************************************************************/
 };
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @file        job_trace.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Job execution timeline in Chrome trace-event format.
+ *
+ * @details
+ * Workers record one `TraceEvent` per executed job into their own
+ * fixed-size buffer (see `ThreadPoolConfig::traceJobs`). `ThreadPool`
+ * drains those buffers into a `JobTrace`, which writes the JSON object
+ * format understood by `chrome://tracing` and https://ui.perfetto.dev:
+ *  - one complete (`"ph": "X"`) event per job on the track of its worker,
+ *    named after the job's type, with the queue wait in its `args`;
+ *  - one `thread_name` metadata event per worker.
+ * Timestamps are steady-clock microseconds, so traces dumped at different
+ * moments of the same run line up.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*****************************************************************************/
+
+/**
+ * @brief One executed job, as recorded by a worker.
+ */
+struct TraceEvent
+{
+    int64_t     submitted = 0;       /**< Submission stamp (steady-clock ticks, 0 if unknown). */
+    int64_t     started   = 0;       /**< Start of execution (steady-clock ticks). */
+    int64_t     finished  = 0;       /**< End of execution (steady-clock ticks). */
+    const char* type      = nullptr; /**< `Task::typeName()` (static storage). */
+    bool        failed    = false;   /**< Whether the job threw. */
+};
+
+/*****************************************************************************/
+
+/**
+ * @class JobTrace
+ * @brief Collected events of several workers, writable as trace-event JSON.
+ */
+class JobTrace
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Appends an event executed by worker `worker`.
+     */
+    void add(size_t worker, const TraceEvent& event);
+
+    /**
+     * @brief Adds `count` events a worker could not record (its buffer was full).
+     */
+    void addDropped(size_t count) { dropped += count; }
+
+    /**
+     * @brief Returns the number of collected events.
+     */
+    size_t size() const { return events.size(); }
+
+    /**
+     * @brief Returns the number of events lost to full buffers.
+     */
+    size_t droppedCount() const { return dropped; }
+
+    /**
+     * @brief Writes the trace as a Chrome trace-event JSON object.
+     */
+    void write(std::ostream& out) const;
+
+    /**
+     * @brief Writes the trace to `path` (overwriting it).
+     *
+     * @return `false` if the file could not be written.
+     */
+    bool writeFile(const std::string& path) const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief An event with the worker that ran it.
+     */
+    struct Entry
+    {
+        size_t     worker;
+        TraceEvent event;
+    };
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Collected events, in collection order.
+     */
+    std::vector<Entry> events;
+
+    /**
+     * @brief Events lost to full buffers.
+     */
+    size_t dropped = 0;
+
+    /******************************************************************/
+};
@@ -0,0 +1,278 @@
+/**
+ * @file        latency_histogram.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Log-linear (HDR-style) latency histogram with a lock-free recorder.
+ *
+ * @details
+ * Values (nanoseconds) are bucketed by power of two, and every power of two
+ * is split into `kSubBuckets` linear sub-buckets. Values below `kSubBuckets`
+ * are exact; above that the bucket width is 1/32 of the value, so any
+ * reported percentile is within ~3 % of the recorded value. The range is
+ * `[0, 2^44)` ns (about 4.9 hours); larger values are clamped.
+ *
+ * `LatencyHistogram` is the recording side: exactly one thread records
+ * (plain load + store on relaxed atomics, no read-modify-write), any thread
+ * may take a `snapshot()` concurrently. `HistogramSnapshot` is a plain value
+ * that can be merged with others and queried for percentiles.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/*****************************************************************************/
+
+/**
+ * @class HistogramSnapshot
+ * @brief Immutable copy of a histogram's buckets; mergeable.
+ */
+class HistogramSnapshot
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty snapshot.
+     */
+    HistogramSnapshot();
+
+    /**
+     * @brief Adds the samples of `other` to this snapshot.
+     */
+    void merge(const HistogramSnapshot& other);
+
+    /**
+     * @brief Removes the samples of `earlier`, an older snapshot of the same histogram.
+     *
+     * @details
+     * Leaves the samples recorded in between. `max()` keeps the overall
+     * maximum, so `percentile()` is only capped more loosely.
+     */
+    void subtract(const HistogramSnapshot& earlier);
+
+    /**
+     * @brief Returns the number of samples.
+     */
+    uint64_t count() const { return total; }
+
+    /**
+     * @brief Returns the sum of every sample, in nanoseconds.
+     */
+    uint64_t sum() const { return sumNs; }
+
+    /**
+     * @brief Returns the largest sample (exact), 0 if empty.
+     */
+    uint64_t max() const { return maxNs; }
+
+    /**
+     * @brief Returns the smallest sample (bucket resolution), 0 if empty.
+     */
+    uint64_t min() const;
+
+    /**
+     * @brief Returns the arithmetic mean, 0 if empty.
+     */
+    double mean() const;
+
+    /**
+     * @brief Returns the value at `percentile` (0..100), 0 if empty.
+     *
+     * @details
+     * The upper bound of the bucket holding the requested rank, capped at
+     * `max()`.
+     */
+    uint64_t percentile(double percentile) const;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    friend class LatencyHistogram;
+
+    /**
+     * @brief Samples per bucket.
+     */
+    std::vector<uint64_t> counts;
+
+    /**
+     * @brief Number of samples (sum of `counts`).
+     */
+    uint64_t total;
+
+    /**
+     * @brief Sum of every sample.
+     */
+    uint64_t sumNs;
+
+    /**
+     * @brief Largest sample.
+     */
+    uint64_t maxNs;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @class LatencyHistogram
+ * @brief Single-writer histogram recorder.
+ */
+class LatencyHistogram
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief log2 of the number of linear sub-buckets per power of two.
+     */
+    static constexpr unsigned kSubBucketBits = 5;
+
+    /**
+     * @brief Linear sub-buckets per power of two.
+     */
+    static constexpr uint64_t kSubBuckets = uint64_t(1) << kSubBucketBits;
+
+    /**
+     * @brief Values are clamped below `2^kMaxBits`.
+     */
+    static constexpr unsigned kMaxBits = 44;
+
+    /**
+     * @brief Total number of buckets.
+     */
+    static constexpr size_t kBuckets = (kMaxBits - kSubBucketBits + 1) * kSubBuckets;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty histogram.
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    LatencyHistogram(const LatencyHistogram&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /**
+     * @brief Records one sample. Owner thread only.
+     */
+    void record(uint64_t ns)
+    {
+        std::atomic<uint64_t>& bucket = buckets[bucketOf(ns)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        sumNs.store(sumNs.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+        if (ns > maxNs.load(std::memory_order_relaxed))
+            maxNs.store(ns, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the current buckets. Any thread, while recording goes on.
+     *
+     * @details
+     * Buckets are read one by one, so a snapshot may miss samples recorded
+     * during the copy; it never sees torn values.
+     */
+    HistogramSnapshot snapshot() const;
+
+    /**
+     * @brief Maps a value to its bucket index.
+     */
+    static size_t bucketOf(uint64_t ns)
+    {
+        if (ns < kSubBuckets)
+            return static_cast<size_t>(ns);
+        if (ns >> kMaxBits)
+            return kBuckets - 1;
+
+        const unsigned magnitude = highestBit(ns);
+        const unsigned shift     = magnitude - kSubBucketBits;
+        const uint64_t sub       = (ns >> shift) - kSubBuckets;
+        return static_cast<size_t>((shift + 1) * kSubBuckets + sub);
+    }
+
+    /**
+     * @brief Largest value mapped to bucket `index`.
+     */
+    static uint64_t upperBoundOf(size_t index);
+
+    /**
+     * @brief Smallest value mapped to bucket `index`.
+     */
+    static uint64_t lowerBoundOf(size_t index);
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Position of the most significant set bit (`value` != 0).
+     */
+    static unsigned highestBit(uint64_t value)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<unsigned>(index);
+#else
+        return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#endif
+    }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Samples per bucket.
+     */
+    std::array<std::atomic<uint64_t>, kBuckets> buckets;
+
+    /**
+     * @brief Sum of every sample.
+     */
+    std::atomic<uint64_t> sumNs;
+
+    /**
+     * @brief Largest sample.
+     */
+    std::atomic<uint64_t> maxNs;
+
+    /******************************************************************/
+};
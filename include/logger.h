@@ -20,6 +20,21 @@
  * - A static `minLevel` acts as a **filter**: messages below the current
  *   level are ignored.
  *
+ * Two output modes are available:
+ * - **Synchronous** (default): the calling thread formats and prints the line.
+ * - **Asynchronous** (`start_async()`): the calling thread only copies the
+ *   message into its own lock-free SPSC ring; a background thread formats
+ *   and writes the records in batches. Order is preserved per thread.
+ *
+ * Hot paths should log through the `LOG_DEBUG` / `LOG_INFO` / `LOG_WARN` /
+ * `LOG_ERROR` macros rather than the functions:
+ * - Levels below `LOGGER_COMPILE_LEVEL` (build-time, see CMake option of
+ *   the same name) expand to nothing: the message expression is not even
+ *   compiled in.
+ * - Remaining levels test `is_enabled()` **before** evaluating the message,
+ *   so a disabled line costs one relaxed load and one branch instead of
+ *   building a `std::string`.
+ *
  * @note
  * The Logger is purely static — no instances should be created.
  * It is designed to be safe for concurrent use across all threads.
@@ -31,7 +46,25 @@
 
 /*****************************************************************************/
 
+/* Compile-time threshold */
+
+/**
+ * @brief Lowest level compiled into the `LOG_*` macros (0 = DBG ... 3 = ERROR).
+ *
+ * @details
+ * Normally injected by CMake (`-DLOGGER_COMPILE_LEVEL=<n>`). Defaults to 0,
+ * i.e. every level is compiled in and only the runtime filter applies.
+ */
+#ifndef LOGGER_COMPILE_LEVEL
+#define LOGGER_COMPILE_LEVEL 0
+#endif
+
+/*****************************************************************************/
+
 /* Standard libraries */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <string>
 
@@ -47,6 +80,7 @@
  * - Supports 4 severity levels (`DBG`, `INFO`, `WARN`, `ERROR`).
  * - Global filter level configurable at runtime (`set_min_level()`).
  * - Each line includes timestamp + level + message.
+ * - Optional asynchronous backend (`start_async()` / `stop_async()`).
  *
  * ### Usage example:
  * ```cpp
@@ -82,6 +116,16 @@ class Logger
         ERROR = 3  /**< Error messages — failure occurred. */
     };
 
+    /**
+     * @enum OverflowPolicy
+     * @brief What an asynchronous producer does when its ring is full.
+     */
+    enum class OverflowPolicy
+    {
+        DROP  = 0, /**< Discard the message and count it (reported by the flush thread). */
+        BLOCK = 1  /**< Wait until the flush thread frees a slot. */
+    };
+
     /**@}*/
     /******************************************************************/
     /** @name Configuration */
@@ -106,6 +150,66 @@ class Logger
      */
     static void set_min_level(Level lvl);
 
+    /**
+     * @brief Returns whether a message of level `lvl` would currently be printed.
+     *
+     * @details
+     * Inline and lock-free: used by the `LOG_*` macros to skip building the
+     * message when it would be filtered anyway.
+     */
+    static bool is_enabled(Level lvl)
+    {
+        return static_cast<int>(lvl) >= static_cast<int>(minLevel.load(std::memory_order_relaxed));
+    }
+
+    /**@}*/
+    /******************************************************************/
+    /** @name Asynchronous Mode */
+    /**@{*/
+
+    /**
+     * @brief Switches to asynchronous logging.
+     *
+     * @param ring_capacity Records buffered per producing thread (rounded up to a power of two).
+     * @param policy        Behaviour when a thread's ring is full.
+     *
+     * @details
+     * GIVEN a synchronous logger,
+     * WHEN `start_async()` is called,
+     * THEN subsequent `log()` calls only enqueue the record and a background
+     * thread writes them in batches.
+     *
+     * Resets `dropped_count()`. Calling it while already asynchronous has no
+     * effect.
+     */
+    static void start_async(size_t         ring_capacity = 1024,
+                            OverflowPolicy policy        = OverflowPolicy::DROP);
+
+    /**
+     * @brief Writes every pending record, stops the background thread and
+     *        returns to synchronous logging.
+     *
+     * @details
+     * Called automatically at program exit if still asynchronous.
+     */
+    static void stop_async();
+
+    /**
+     * @brief Blocks until every record enqueued before the call has been written.
+     */
+    static void flush();
+
+    /**
+     * @brief Returns whether the asynchronous backend is active.
+     */
+    static bool is_async();
+
+    /**
+     * @brief Returns how many records were discarded by `OverflowPolicy::DROP`
+     *        since the last `start_async()`.
+     */
+    static uint64_t dropped_count();
+
     /**@}*/
     /******************************************************************/
     /** @name Logging Methods */
@@ -194,15 +298,67 @@ class Logger
      */
     static const char* levelToString(Level lvl);
 
+    /**
+     * @brief Writes a formatted line to `std::cout` on the calling thread.
+     */
+    static void write_sync(Level lvl, const std::string& msg);
+
+    /**
+     * @brief State of the asynchronous backend (rings, flush thread...).
+     *
+     * @details
+     * Defined in logger.cpp.
+     */
+    struct AsyncBackend;
+
     /**@}*/
     /******************************************************************/
     /** @name Static Attributes */
     /**@{*/
 
    private:
-    static std::mutex mtx;      /**< Global mutex to serialize console output. */
-    static Level      minLevel; /**< Current minimum severity threshold. */
+    static std::mutex         mtx;          /**< Global mutex to serialize console output. */
+    static std::atomic<Level> minLevel;     /**< Current minimum severity threshold. */
+    static AsyncBackend       asyncBackend; /**< Asynchronous mode state. */
 
     /**@}*/
     /******************************************************************/
 };
+
+/*****************************************************************************/
+
+/* Logging macros */
+
+/**
+ * @brief Logs `msg` at `lvl`, evaluating `msg` only if the level is enabled.
+ */
+#define LOGGER_LOG_LAZY(lvl, msg)        \
+    do                                   \
+    {                                    \
+        if (Logger::is_enabled(lvl))     \
+            Logger::log((lvl), (msg));   \
+    } while (0)
+
+#if LOGGER_COMPILE_LEVEL <= 0
+#define LOG_DEBUG(msg) LOGGER_LOG_LAZY(Logger::Level::DBG, msg)
+#else
+#define LOG_DEBUG(msg) ((void)0)
+#endif
+
+#if LOGGER_COMPILE_LEVEL <= 1
+#define LOG_INFO(msg) LOGGER_LOG_LAZY(Logger::Level::INFO, msg)
+#else
+#define LOG_INFO(msg) ((void)0)
+#endif
+
+#if LOGGER_COMPILE_LEVEL <= 2
+#define LOG_WARN(msg) LOGGER_LOG_LAZY(Logger::Level::WARN, msg)
+#else
+#define LOG_WARN(msg) ((void)0)
+#endif
+
+#if LOGGER_COMPILE_LEVEL <= 3
+#define LOG_ERROR(msg) LOGGER_LOG_LAZY(Logger::Level::ERROR, msg)
+#else
+#define LOG_ERROR(msg) ((void)0)
+#endif
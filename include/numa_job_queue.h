@@ -0,0 +1,286 @@
+/**
+ * @file        numa_job_queue.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Job queue sharded per NUMA node, with node-local routing.
+ *
+ * @details
+ * `NumaJobQueue` keeps one `JobQueue` shard per NUMA node of a `CpuTopology`
+ * (see `ThreadPoolConfig::QueueBackend::NumaSharded`):
+ *  - a push goes to the shard of the calling thread's node: the node its
+ *    home shard was bound to (`bindCurrentThread()`, done by pool workers),
+ *    otherwise the node of the CPU it is running on;
+ *  - a pop takes from the caller's shard first and only steals from the
+ *    other shards once that one is empty.
+ * Jobs submitted on a node are therefore queued and run on that node while
+ * it has work, and a node that runs dry still helps the others.
+ *
+ * Consumers that find every shard empty spin (see `SpinPolicy`), then sleep
+ * on one shared condition variable; producers only touch it when someone is
+ * asleep and the spinners cannot take every queued task.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* Project libraries */
+
+#include "cpu_topology.h"
+#include "i_job_queue.h"
+#include "job_priority.h"
+#include "job_queue.h"
+#include "spin_wait.h"
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @class NumaJobQueue
+ * @brief `IJobQueue` made of one priority-lane `JobQueue` per NUMA node.
+ */
+class NumaJobQueue : public IJobQueue
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Creates one shard per node of `topology`.
+     *
+     * @param topology       CPUs and their nodes (a topology without CPUs yields one shard).
+     * @param priority_aging Aging threshold of every shard (see `JobQueue`).
+     * @param spin_policy    Spin phase of idle consumers before sleeping (none by default).
+     */
+    explicit NumaJobQueue(const CpuTopology& topology, size_t priority_aging = 0,
+                          const SpinPolicy& spin_policy = SpinPolicy{});
+
+    /**
+     * @brief Destroys the queue and its pending tasks.
+     */
+    ~NumaJobQueue() override = default;
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    NumaJobQueue(const NumaJobQueue&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    NumaJobQueue& operator=(const NumaJobQueue&) = delete;
+
+    /**
+     * @brief Returns the number of shards (NUMA nodes).
+     */
+    size_t shardCount() const { return shards.size(); }
+
+    /**
+     * @brief Returns the NUMA node id of `shard`.
+     */
+    int nodeOf(size_t shard) const { return shards[shard]->node; }
+
+    /**
+     * @brief Returns the CPUs of the node of `shard`.
+     */
+    const std::vector<int>& cpusOf(size_t shard) const { return shards[shard]->cpus; }
+
+    /**
+     * @brief Returns the shard of `cpu` (0 for unknown CPUs).
+     */
+    size_t shardOf(int cpu) const;
+
+    /**
+     * @brief Returns the number of tasks waiting in `shard`.
+     */
+    size_t shardSize(size_t shard) const { return shards[shard]->queue.size(); }
+
+    /**
+     * @brief Makes `shard` the home shard of the calling thread for this queue.
+     */
+    void bindCurrentThread(size_t shard);
+
+    /**
+     * @brief Returns the calling thread's home shard.
+     */
+    size_t currentShard() const;
+
+    /**
+     * @brief Returns how many tasks were popped from a shard other than the caller's.
+     */
+    size_t stolenCount() const { return stolen.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Pushes `task` into the caller's shard.
+     */
+    void pushTask(Task task) override;
+
+    /**
+     * @brief Pushes `task` into the `priority` lane of the caller's shard.
+     */
+    void pushPriorityTask(Task task, JobPriority priority) override;
+
+    /**
+     * @brief Pops a task, blocking while every shard is empty and the queue is open.
+     */
+    bool popTask(Task& task) override;
+
+    /**
+     * @brief Pops from the caller's shard, else from the first other shard with work.
+     */
+    bool tryPopTask(Task& task) override;
+
+    /**
+     * @brief Pops the victim of the caller's shard, else of the first other shard with work.
+     */
+    bool tryPopVictim(Task& task) override;
+
+    /**
+     * @brief Pushes `count` tasks into the caller's shard under one lock.
+     */
+    void pushTasks(Task* tasks, size_t count) override;
+
+    /**
+     * @brief Pops up to a fair share of `max_count` tasks from one shard (blocking).
+     */
+    size_t popTasks(Task* out, size_t max_count, size_t consumers = 1) override;
+
+    /**
+     * @brief Pops up to a fair share of `max_count` tasks from one shard (non-blocking).
+     */
+    size_t tryPopTasks(Task* out, size_t max_count, size_t consumers = 1) override;
+
+    /**
+     * @brief Returns whether every shard is empty (snapshot).
+     */
+    bool empty() const override;
+
+    /**
+     * @brief Returns the number of tasks in all shards (snapshot).
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Removes the pending tasks of every shard.
+     */
+    void clear() override;
+
+    /**
+     * @brief Closes the queue and wakes every sleeping consumer.
+     */
+    void shutdown() override;
+
+    /**
+     * @brief Returns whether the queue is closed.
+     */
+    bool is_closed() override;
+
+    /**
+     * @brief Lets the next `count` pops that find every shard empty return.
+     */
+    void interrupt(size_t count) override;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Queue and CPUs of one node.
+     */
+    struct Shard
+    {
+        Shard(int node, std::vector<int> cpus, size_t priority_aging)
+            : node(node), cpus(std::move(cpus)), queue(priority_aging)
+        {
+        }
+
+        int              node;  /**< NUMA node id. */
+        std::vector<int> cpus;  /**< CPUs of the node. */
+        JobQueue         queue; /**< Tasks submitted on the node. */
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Wakes sleeping consumers after `count` tasks were published.
+     */
+    void wake(size_t count);
+
+    /**
+     * @brief Visits shards starting at the caller's until `take` returns non-zero.
+     */
+    template <typename Take>
+    size_t takeNearest(Take take);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief One shard per node, in node order.
+     */
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    /**
+     * @brief Shard index of every CPU number (unknown CPUs map to 0).
+     */
+    std::vector<size_t> cpuShard;
+
+    /**
+     * @brief Set by `shutdown()`.
+     */
+    std::atomic<bool> closed;
+
+    /**
+     * @brief Consumers sleeping (or about to) in `popTask()` / `popTasks()`.
+     */
+    std::atomic<size_t> sleepers;
+
+    /**
+     * @brief Tasks popped from a shard other than the caller's.
+     */
+    std::atomic<size_t> stolen;
+
+    /**
+     * @brief Protects the sleeping handshake.
+     */
+    std::mutex sleepMtx;
+
+    /**
+     * @brief Sleeping consumers wait here.
+     */
+    std::condition_variable sleepCv;
+
+    /**
+     * @brief Pending `interrupt()` wake-ups (protected by `sleepMtx`).
+     */
+    size_t interrupts = 0;
+
+    /**
+     * @brief Spin phase run before sleeping.
+     */
+    SpinWait spin;
+
+    /******************************************************************/
+};
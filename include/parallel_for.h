@@ -0,0 +1,262 @@
+/**
+ * @file        parallel_for.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Data-parallel loops over an index range: `parallelFor` and `parallelReduce`.
+ *
+ * @details
+ * The range is split adaptively instead of in fixed chunks. Every piece of
+ * work walks its range `grain` indices at a time; before each step it checks
+ * whether the pool has an idle worker (fewer pending jobs than threads) and,
+ * if so and enough is left, hands the upper half of what remains to the
+ * pool as a new job (lazy binary splitting). Busy pools therefore see few,
+ * large jobs, while a worker that runs dry causes the remaining work to be
+ * split again, which keeps uneven iterations balanced.
+ *
+ * Both functions block until the whole range is processed. The calling
+ * thread works on the range too (and helps the pool while waiting, see
+ * `TaskGroup`), so they may be called from inside a pool job. The first
+ * exception thrown by `body` is rethrown.
+ *
+ * Example:
+ * @code
+ * parallelFor(pool, 0, pixels.size(),
+ *             [&](size_t first, size_t last)
+ *             {
+ *                 for (size_t i = first; i < last; ++i)
+ *                     shade(pixels[i]);
+ *             });
+ *
+ * double total = parallelReduce(
+ *     pool, 0, values.size(), 0.0,
+ *     [&](size_t first, size_t last, double sum)
+ *     {
+ *         for (size_t i = first; i < last; ++i)
+ *             sum += values[i];
+ *         return sum;
+ *     },
+ *     [](double a, double b) { return a + b; });
+ * @endcode
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* Project libraries */
+
+#include "task_group.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace parallel_detail
+{
+/**
+ * @brief Target number of `grain`-sized steps per thread when the grain is automatic.
+ */
+constexpr size_t kStepsPerThread = 32;
+
+/**
+ * @brief Automatic grain: small enough to balance, large enough to amortize the checks.
+ */
+inline size_t autoGrain(const ThreadPool& pool, size_t count)
+{
+    const size_t threads = pool.size() + 1;
+    return std::max<size_t>(1, count / (threads * kStepsPerThread));
+}
+
+/**
+ * @brief Whether handing work to the pool would keep a thread busy.
+ */
+inline bool poolHasIdleWorker(const ThreadPool& pool)
+{
+    return pool.pending() < pool.size();
+}
+
+/**
+ * @brief `parallelFor` per-job behaviour: call the body, keep nothing.
+ */
+template <typename Body>
+struct ForEach
+{
+    struct Chunk
+    {
+    };
+
+    Chunk begin(size_t) const { return Chunk{}; }
+
+    void step(Chunk&, size_t first, size_t last) { body(first, last); }
+
+    void end(Chunk&&) {}
+
+    Body& body;
+};
+
+/**
+ * @brief `parallelReduce` per-job behaviour: fold into a local partial, publish it once.
+ */
+template <typename T, typename Body>
+struct Fold
+{
+    struct Chunk
+    {
+        size_t origin; /**< Start of the job's range (orders the partials). */
+        T      value;  /**< Fold of the steps run so far. */
+    };
+
+    Chunk begin(size_t origin) const { return Chunk{origin, identity}; }
+
+    void step(Chunk& chunk, size_t first, size_t last)
+    {
+        chunk.value = body(first, last, std::move(chunk.value));
+    }
+
+    void end(Chunk&& chunk)
+    {
+        std::lock_guard<std::mutex> lock(partialsMtx);
+        partials.emplace_back(chunk.origin, std::move(chunk.value));
+    }
+
+    Body&                             body;
+    const T&                          identity;
+    std::mutex                        partialsMtx;
+    std::vector<std::pair<size_t, T>> partials;
+};
+
+/**
+ * @brief Loop state shared by every job of one call.
+ *
+ * @details
+ * Jobs only carry a pointer to it plus their range, so they fit in the
+ * inline storage of `Task`.
+ */
+template <typename Policy>
+struct Loop
+{
+    ThreadPool& pool;
+    TaskGroup&  group;
+    size_t      grain;
+    Policy&     policy;
+};
+
+/**
+ * @brief Processes `[first, last)` in `grain` steps, splitting off upper halves while
+ *        workers are idle.
+ */
+template <typename Policy>
+void split(Loop<Policy>* loop, size_t first, size_t last)
+{
+    auto chunk = loop->policy.begin(first);
+
+    while (last - first > loop->grain)
+    {
+        if (last - first >= 2 * loop->grain && poolHasIdleWorker(loop->pool))
+        {
+            const size_t middle = first + (last - first) / 2;
+            loop->group.run([loop, middle, last] { split(loop, middle, last); });
+            last = middle;
+            continue;
+        }
+
+        const size_t stop = first + loop->grain;
+        loop->policy.step(chunk, first, stop);
+        first = stop;
+    }
+
+    if (first < last)
+        loop->policy.step(chunk, first, last);
+    loop->policy.end(std::move(chunk));
+}
+
+/**
+ * @brief Runs `policy` over `[begin, end)` and waits for every job.
+ */
+template <typename Policy>
+void run(ThreadPool& pool, size_t begin, size_t end, size_t grain, Policy& policy)
+{
+    TaskGroup    group(pool);
+    Loop<Policy> loop{pool, group, grain ? grain : autoGrain(pool, end - begin), policy};
+    split(&loop, begin, end);
+    group.wait();
+}
+}  // namespace parallel_detail
+
+/*****************************************************************************/
+
+/* Public Functions */
+
+/**
+ * @brief Calls `body(first, last)` on disjoint sub-ranges covering `[begin, end)`, in parallel.
+ *
+ * @param pool  Pool whose workers share the loop.
+ * @param begin First index.
+ * @param end   One past the last index.
+ * @param body  Callable `void(size_t first, size_t last)`; invoked concurrently.
+ * @param grain Smallest sub-range handed to `body` (0 = chosen from the range and pool size).
+ */
+template <typename Body>
+void parallelFor(ThreadPool& pool, size_t begin, size_t end, Body&& body, size_t grain = 0)
+{
+    if (begin >= end)
+        return;
+
+    parallel_detail::ForEach<typename std::remove_reference<Body>::type> policy{body};
+    parallel_detail::run(pool, begin, end, grain, policy);
+}
+
+/**
+ * @brief Folds `[begin, end)` in parallel.
+ *
+ * @details
+ * Every job folds its sub-ranges into its own partial value, starting from
+ * `identity`; the partials are then combined in index order, so `combine`
+ * must be associative but need not be commutative.
+ *
+ * @param pool     Pool whose workers share the loop.
+ * @param begin    First index.
+ * @param end      One past the last index.
+ * @param identity Neutral element of `combine`.
+ * @param body     Callable `T(size_t first, size_t last, T partial)` returning the partial
+ *                 folded with `[first, last)`; invoked concurrently.
+ * @param combine  Callable `T(T left, T right)`.
+ * @param grain    Smallest sub-range handed to `body` (0 = automatic).
+ *
+ * @return The fold of the whole range (`identity` when it is empty).
+ */
+template <typename T, typename Body, typename Combine>
+T parallelReduce(ThreadPool& pool, size_t begin, size_t end, T identity, Body&& body,
+                 Combine&& combine, size_t grain = 0)
+{
+    if (begin >= end)
+        return identity;
+
+    parallel_detail::Fold<T, typename std::remove_reference<Body>::type> policy{body, identity};
+    parallel_detail::run(pool, begin, end, grain, policy);
+
+    std::sort(policy.partials.begin(), policy.partials.end(),
+              [](const std::pair<size_t, T>& a, const std::pair<size_t, T>& b)
+              { return a.first < b.first; });
+
+    T result = std::move(identity);
+    for (auto& partial : policy.partials)
+        result = combine(std::move(result), std::move(partial.second));
+    return result;
+}
@@ -0,0 +1,318 @@
+/**
+ * @file        ring_job_queue.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Bounded lock-free MPMC ring buffer of `Task`s.
+ *
+ * @details
+ * `RingJobQueue` is an alternative backend to `JobQueue` for workloads with
+ * many concurrent producers. The fast path (`push()` / `pop()` when the ring
+ * is neither full nor empty) never takes a lock:
+ *  - Every slot carries a sequence number that tells producers and consumers
+ *    whether the slot is free, full, or still being written (D. Vyukov's
+ *    bounded MPMC queue).
+ *  - The enqueue and dequeue cursors live on separate cache lines.
+ *
+ * A mutex + condition variable are only used to park consumers when the
+ * ring is empty, so `pop()` keeps the same blocking semantics as `JobQueue`.
+ * With a `SpinPolicy`, consumers spin on the cursors before parking and
+ * producers skip the wake-up while spinners can take the published jobs.
+ *
+ * ### Concurrency guarantees:
+ * - All operations are thread-safe.
+ * - FIFO ordering is preserved per producer.
+ * - Once closed, consumers drain the remaining jobs and then get `nullptr`.
+ * - `push()` on a full ring waits (yielding) until a slot is released.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* Project libraries */
+
+#include "cache_line.h"
+#include "i_job.h"
+#include "i_job_queue.h"
+#include "spin_wait.h"
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @class RingJobQueue
+ *
+ * @brief A bounded, lock-free multi-producer / multi-consumer job queue.
+ *
+ * @details
+ * The capacity is rounded up to the next power of two so that slot indices
+ * can be computed with a mask instead of a modulo.
+ */
+class RingJobQueue : public IJobQueue
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty, open ring.
+     *
+     * @param capacity Maximum number of pending jobs (rounded up to a power of two,
+     *                 minimum 2).
+     * @param spin_policy Spin phase of idle consumers before parking (none by default).
+     */
+    explicit RingJobQueue(size_t capacity, const SpinPolicy& spin_policy = SpinPolicy{});
+
+    /**
+     * @brief Destroys the ring and any job still stored in it.
+     */
+    ~RingJobQueue() override;
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    RingJobQueue(const RingJobQueue&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    RingJobQueue& operator=(const RingJobQueue&) = delete;
+
+    /**
+     * @brief Disable move constructor.
+     */
+    RingJobQueue(RingJobQueue&&) = delete;
+
+    /**
+     * @brief Disable move assignment operator.
+     */
+    RingJobQueue& operator=(RingJobQueue&&) = delete;
+
+    /**
+     * @brief Pushes a task into the ring.
+     *
+     * @param task Non-empty task to insert.
+     *
+     * @details
+     * Lock-free while there is room. If the ring is full the caller yields
+     * until a consumer releases a slot. A parked consumer is woken only if
+     * one is actually waiting.
+     */
+    void pushTask(Task task) override;
+
+    /**
+     * @brief Pushes a task if the ring has a free slot (lock-free, never waits).
+     *
+     * @param task     Non-empty task; left untouched when the ring is full.
+     * @param priority Ignored: the ring has no lanes.
+     * @return `false` if the ring is full.
+     */
+    bool tryPushPriorityTask(Task& task, JobPriority priority) override;
+
+    /**
+     * @brief Pops the next available task (blocking).
+     *
+     * @param task Receives the next task.
+     * @return `false` if the ring is closed and drained.
+     */
+    bool popTask(Task& task) override;
+
+    /**
+     * @brief Pops the next available task without blocking (lock-free).
+     *
+     * @param task Receives the next task.
+     * @return `false` if the ring is currently empty.
+     */
+    bool tryPopTask(Task& task) override;
+
+    /**
+     * @brief Pops up to `max_count` tasks, parking only for the first one.
+     *
+     * @details
+     * The extra tasks are taken with lock-free dequeues, capped at the
+     * caller's fair share of the backlog.
+     */
+    size_t popTasks(Task* out, size_t max_count, size_t consumers = 1) override;
+
+    /**
+     * @brief Publishes `count` tasks and checks for parked consumers once.
+     *
+     * @details
+     * While the ring is full the producer wakes the consumers before
+     * yielding, so a batch larger than the capacity cannot stall.
+     */
+    void pushTasks(Task* tasks, size_t count) override;
+
+    /**
+     * @brief Returns whether the ring is currently empty (snapshot).
+     */
+    bool empty() const override;
+
+    /**
+     * @brief Returns the number of pending jobs (snapshot).
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Removes and destroys all pending jobs.
+     */
+    void clear() override;
+
+    /**
+     * @brief Closes the ring and wakes all waiting consumers.
+     */
+    void shutdown() override;
+
+    /**
+     * @brief Returns whether the ring is closed.
+     */
+    bool is_closed() override;
+
+    /**
+     * @brief Lets the next `count` pops that find the ring empty return.
+     */
+    void interrupt(size_t count) override;
+
+    /**
+     * @brief Returns the (power of two) capacity of the ring.
+     */
+    size_t capacity() const;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Dequeues a task, spinning and then parking while the ring is empty.
+     *
+     * @return `false` once the ring is closed and drained, or for a pending
+     *         `interrupt()` while it is empty.
+     */
+    bool waitDequeue(Task& task);
+
+    /**
+     * @brief Lock-free enqueue attempt.
+     *
+     * @return `false` if the ring is full.
+     */
+    bool tryEnqueue(Task& task);
+
+    /**
+     * @brief Lock-free dequeue attempt.
+     *
+     * @return `false` if the ring is empty.
+     */
+    bool tryDequeue(Task& task);
+
+    /**
+     * @brief Wakes one parked consumer (or all of them if `all`), if any.
+     */
+    void notifyConsumer(bool all = false);
+
+    /**
+     * @brief Consumes one pending `interrupt()` wake-up, if any.
+     */
+    bool takeInterrupt();
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Ring cell: sequence number + payload.
+     */
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        Task                task;
+    };
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Ring storage.
+     */
+    std::vector<Slot> slots;
+
+    /**
+     * @brief `capacity - 1`, used to map positions to slots.
+     */
+    const size_t mask;
+
+    /**
+     * @brief Keeps the enqueue cursor off the cache line of the read-only fields.
+     */
+    char padHead[kCacheLineSize];
+
+    /**
+     * @brief Next position to be written by a producer.
+     */
+    std::atomic<size_t> enqueuePos;
+
+    /**
+     * @brief Keeps the enqueue and dequeue cursors on separate cache lines.
+     */
+    char padTail[kCacheLineSize - sizeof(std::atomic<size_t>)];
+
+    /**
+     * @brief Next position to be read by a consumer.
+     */
+    std::atomic<size_t> dequeuePos;
+
+    /**
+     * @brief Isolates the dequeue cursor from the parking state below.
+     */
+    char padParking[kCacheLineSize - sizeof(std::atomic<size_t>)];
+
+    /**
+     * @brief Number of consumers parked (or about to park) on `cv`.
+     */
+    std::atomic<size_t> waiters;
+
+    /**
+     * @brief Indicates whether the ring is closed.
+     */
+    std::atomic<bool> closed;
+
+    /**
+     * @brief Pending `interrupt()` wake-ups.
+     */
+    std::atomic<size_t> interrupts;
+
+    /**
+     * @brief Spin phase run before parking.
+     */
+    SpinWait spin;
+
+    /**
+     * @brief Protects the parking handshake only (never the data path).
+     */
+    std::mutex mtx;
+
+    /**
+     * @brief Parks consumers while the ring is empty.
+     */
+    std::condition_variable cv;
+
+    /******************************************************************/
+};
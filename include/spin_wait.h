@@ -0,0 +1,210 @@
+/**
+ * @file        spin_wait.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Bounded, self-tuning spin-then-yield phase run by idle consumers before parking.
+ *
+ * @details
+ * Parking on a condition variable costs a futex sleep and a futex wake,
+ * tens of microseconds when the next job arrives right after. A consumer
+ * that finds nothing therefore first:
+ *  1. spins up to the current budget with a CPU pause hint (`pause` on x86,
+ *     `yield` on ARM), re-checking for work between two hints;
+ *  2. calls `std::this_thread::yield()` up to `SpinPolicy::yields` times;
+ *  3. parks.
+ *
+ * With `SpinPolicy::adaptive` the budget follows the waits actually seen by
+ * the consumers of one queue: a hit after `n` spins moves it towards `2n`
+ * (a hit while yielding counts as one just past the budget), a miss lets
+ * it decay, within [`kMinSpins`, `maxSpins`]. Queues that are
+ * busy keep spinning; queues that stay idle soon park almost at once.
+ *
+ * Producers read `spinning()` and skip the wake-up when the spinners can
+ * take all the work published.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(_M_ARM64)
+#include <intrin.h>
+#endif
+
+/*****************************************************************************/
+
+/**
+ * @brief How long an idle consumer spins and yields before parking.
+ */
+struct SpinPolicy
+{
+    size_t maxSpins = 0;    /**< Pause iterations before yielding (0 = none). */
+    size_t yields   = 0;    /**< `yield()` calls between spinning and parking. */
+    bool   adaptive = true; /**< Tune the spin count from the observed waits. */
+};
+
+/*****************************************************************************/
+
+/**
+ * @class SpinWait
+ * @brief Spin budget and spinner count shared by the consumers of one queue.
+ */
+class SpinWait
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Lowest adaptive budget, so the budget can grow back from a miss streak.
+     */
+    static constexpr size_t kMinSpins = 16;
+
+    /**
+     * @brief Creates the spin phase of `policy` (the default one never spins).
+     */
+    explicit SpinWait(const SpinPolicy& policy = SpinPolicy{})
+        : policy(policy), spinners(0), currentBudget(policy.maxSpins)
+    {
+    }
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    SpinWait(const SpinWait&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    SpinWait& operator=(const SpinWait&) = delete;
+
+    /**
+     * @brief Tells the CPU the caller is busy-waiting (frees pipeline resources for a sibling).
+     */
+    static void relax()
+    {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#elif defined(_M_ARM64)
+        __yield();
+#endif
+    }
+
+    /**
+     * @brief Spins, then yields, until `ready()` holds or the budget is spent.
+     *
+     * @return The last value of `ready()`; `false` means the caller should park.
+     *
+     * @details
+     * The caller is counted in `spinning()` for the whole phase. `ready()`
+     * must be cheap and must not take the lock producers publish under.
+     */
+    template <typename Ready>
+    bool until(Ready ready)
+    {
+        if (ready())
+            return true;
+        if (policy.maxSpins == 0 && policy.yields == 0)
+            return false;
+
+        spinners.fetch_add(1, std::memory_order_seq_cst);
+
+        const size_t limit = budget();
+        size_t       spins = 0;
+        bool         hit   = false;
+        while (!hit && spins < limit)
+        {
+            relax();
+            ++spins;
+            hit = ready();
+        }
+        for (size_t i = 0; !hit && i < policy.yields; ++i)
+        {
+            std::this_thread::yield();
+            hit = ready();
+        }
+
+        spinners.fetch_sub(1, std::memory_order_seq_cst);
+
+        if (policy.adaptive && policy.maxSpins > 0)
+            learn(hit, spins);
+        return hit;
+    }
+
+    /**
+     * @brief Returns the number of consumers currently in `until()`.
+     */
+    size_t spinning() const { return spinners.load(std::memory_order_seq_cst); }
+
+    /**
+     * @brief Returns the spin count of the next `until()`.
+     */
+    size_t budget() const
+    {
+        return policy.adaptive ? currentBudget.load(std::memory_order_relaxed) : policy.maxSpins;
+    }
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Moves the budget 1/8 of the way towards `2 * spins` (hit) or 0 (miss).
+     *
+     * @details
+     * `spins` equals the budget for a hit during the yield phase, which thus
+     * grows it. Concurrent updates may overwrite each other; the budget is a
+     * heuristic.
+     */
+    void learn(bool hit, size_t spins)
+    {
+        const size_t current = currentBudget.load(std::memory_order_relaxed);
+        const size_t target  = hit ? std::min(2 * spins, policy.maxSpins) : 0;
+        size_t       next    = target >= current ? current + (target - current + 7) / 8
+                                                 : current - (current - target) / 8;
+        const size_t floor   = kMinSpins < policy.maxSpins ? kMinSpins : policy.maxSpins;
+        next                 = std::max(std::min(next, policy.maxSpins), floor);
+        currentBudget.store(next, std::memory_order_relaxed);
+    }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Spin and yield limits.
+     */
+    const SpinPolicy policy;
+
+    /**
+     * @brief Consumers currently spinning or yielding.
+     */
+    std::atomic<size_t> spinners;
+
+    /**
+     * @brief Adaptive spin count.
+     */
+    std::atomic<size_t> currentBudget;
+
+    /******************************************************************/
+};
@@ -0,0 +1,207 @@
+/**
+ * @file        spsc_ring.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Bounded single-producer / single-consumer ring with reusable slots.
+ *
+ * @details
+ * Exactly one thread may push and exactly one (other) thread may consume.
+ * Each side owns one cursor and keeps a private cached copy of the other
+ * side's cursor, so the shared cache line is only read when the cached value
+ * says the ring looks full (producer) or empty (consumer).
+ *
+ * Slots are default-constructed once and then **reused**: producers fill a
+ * slot in place (`tryPush(fill)`) and consumers read it in place
+ * (`consume(sink)`). For slot types owning buffers (e.g. `std::string`) the
+ * capacity survives from one lap to the next, so steady-state pushes do not
+ * allocate.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+/* Project libraries */
+
+#include "cache_line.h"
+
+/*****************************************************************************/
+
+/**
+ * @class SpscRing
+ * @brief Fixed-capacity SPSC ring of `T` slots.
+ */
+template <typename T>
+class SpscRing
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty ring.
+     *
+     * @param requested_capacity Minimum number of slots (rounded up to a power of two, min 2).
+     */
+    explicit SpscRing(size_t requested_capacity)
+        : mask(roundUpPowerOfTwo(requested_capacity) - 1),
+          slots(new T[mask + 1]),
+          tail(0),
+          cachedHead(0),
+          head(0),
+          cachedTail(0)
+    {
+    }
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    SpscRing(const SpscRing&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * @brief Fills the next free slot in place. Producer thread only.
+     *
+     * @param fill Callable `void(T&)` writing the new element.
+     * @return `false` if the ring is full (nothing written).
+     */
+    template <typename Fill>
+    bool tryPush(Fill&& fill)
+    {
+        const size_t pos = tail.load(std::memory_order_relaxed);
+        if (pos - cachedHead > mask)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (pos - cachedHead > mask)
+                return false;
+        }
+
+        fill(slots[pos & mask]);
+        tail.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Hands up to `max_items` elements to `sink`, oldest first. Consumer thread only.
+     *
+     * @param sink      Callable `void(T&)`; the slot is recycled when it returns.
+     * @param max_items Upper bound on the number of elements consumed.
+     * @return Number of elements consumed.
+     */
+    template <typename Sink>
+    size_t consume(Sink&& sink, size_t max_items = std::numeric_limits<size_t>::max())
+    {
+        size_t pos = head.load(std::memory_order_relaxed);
+        if (pos == cachedTail)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (pos == cachedTail)
+                return 0;
+        }
+
+        size_t count = 0;
+        while (pos != cachedTail && count < max_items)
+        {
+            sink(slots[pos & mask]);
+            ++pos;
+            ++count;
+        }
+
+        head.store(pos, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Returns whether the ring looks empty (snapshot, any thread).
+     */
+    bool empty() const
+    {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    size_t capacity() const { return mask + 1; }
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Smallest power of two `>= value` (at least 2).
+     */
+    static size_t roundUpPowerOfTwo(size_t value)
+    {
+        size_t result = 2;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief `capacity - 1`, used to map positions to slots.
+     */
+    const size_t mask;
+
+    /**
+     * @brief Slot storage.
+     */
+    std::unique_ptr<T[]> slots;
+
+    /**
+     * @brief Keeps the producer cursor off the cache line of the read-only fields.
+     */
+    char padProducer[kCacheLineSize];
+
+    /**
+     * @brief Next position to be written (producer-owned).
+     */
+    std::atomic<size_t> tail;
+
+    /**
+     * @brief Producer's last observed value of `head`.
+     */
+    size_t cachedHead;
+
+    /**
+     * @brief Keeps the producer and consumer cursors on separate cache lines.
+     */
+    char padConsumer[kCacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+    /**
+     * @brief Next position to be read (consumer-owned).
+     */
+    std::atomic<size_t> head;
+
+    /**
+     * @brief Consumer's last observed value of `tail`.
+     */
+    size_t cachedTail;
+
+    /******************************************************************/
+};
@@ -0,0 +1,361 @@
+/**
+ * @file        strand.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Serial executors over a ThreadPool: one job at a time, in FIFO order.
+ *
+ * @details
+ * A `Strand` queues its jobs and keeps at most one "drain" job in the pool.
+ * The drain runs the queued jobs one after the other on whichever worker
+ * picked it up, so jobs of one strand never overlap and see each other's
+ * writes, while different strands run in parallel. State touched only from
+ * one strand therefore needs no lock of its own.
+ *
+ * The strand's mutex is only held to push or pop a job, never while a job
+ * runs. After `kDrainBatch` jobs the drain re-dispatches itself behind the
+ * pool's other work, so a busy strand cannot hold a worker forever.
+ *
+ * `KeyedStrands` hashes a key (account id, session...) to one of a fixed
+ * set of strands: jobs with the same key keep their submission order and
+ * never run concurrently.
+ *
+ * Example:
+ * @code
+ * KeyedStrands<std::uint64_t> accounts(pool);
+ * accounts.post(accountId, [&balances, accountId, amount] { balances[accountId] += amount; });
+ * @endcode
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* Project libraries */
+
+#include "i_executor.h"
+#include "i_job.h"
+#include "task.h"
+#include "task_future.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+/**
+ * @class Strand
+ * @brief Runs the jobs submitted to it one at a time, in submission order, on a pool.
+ *
+ * @details
+ * Jobs may be submitted from any thread, including from jobs of the same
+ * strand (they are queued behind the current one). If the pool refuses or
+ * discards the strand's drain job, the jobs queued at that moment are
+ * dropped with a warning (their futures complete with `broken_promise`).
+ */
+class Strand : public IExecutor
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Jobs run by one drain before it yields its worker.
+     */
+    static constexpr size_t kDrainBatch = 64;
+
+    /**
+     * @brief Creates an idle strand over `pool`.
+     *
+     * @param pool Pool running the jobs; must outlive the strand.
+     */
+    explicit Strand(ThreadPool& pool);
+
+    /**
+     * @brief Waits for the queued jobs, helping the pool meanwhile.
+     */
+    ~Strand() override;
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    Strand(const Strand&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    Strand& operator=(const Strand&) = delete;
+
+    /**
+     * @brief Queues an `IJob` behind the strand's previous jobs.
+     *
+     * @param job Unique pointer to an `IJob` instance; null is ignored with a warning.
+     */
+    void enqueue(std::unique_ptr<IJob> job);
+
+    /**
+     * @brief Queues a `void()` callable behind the strand's previous jobs, fire-and-forget.
+     *
+     * @details
+     * Exceptions are only logged.
+     */
+    template <typename F>
+    void post(F&& fn)
+    {
+        dispatch(Task(std::forward<F>(fn)));
+    }
+
+    /**
+     * @brief Queues a callable and returns a future for its result.
+     *
+     * @details
+     * Continuations attached with `TaskFuture::then()` run on this strand
+     * too, so the strand must outlive them.
+     */
+    template <typename F, typename R = decltype(std::declval<typename std::decay<F>::type&>()())>
+    TaskFuture<R> submit(F&& fn)
+    {
+        TaskFuture<R> future;
+        dispatch(makeFutureTask<R>(this, std::forward<F>(fn), future));
+        return future;
+    }
+
+    /**
+     * @brief Queues `task` and schedules a drain if none is pending.
+     *
+     * @param task Non-empty task; ownership is transferred.
+     */
+    void dispatch(Task task) override;
+
+    /**
+     * @brief Blocks until every job queued so far has run, helping meanwhile.
+     *
+     * @warning Must not be called from a job of this strand (it would wait for itself).
+     */
+    void wait();
+
+    /**
+     * @brief Returns the number of jobs queued or running.
+     */
+    size_t pending() const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Shared by the strand and its drain job.
+     */
+    struct State
+    {
+        explicit State(ThreadPool& pool) : pool(pool), outstanding(0) {}
+
+        /**
+         * @brief Dispatches a drain job to the pool.
+         */
+        void schedule(const std::shared_ptr<State>& self);
+
+        /**
+         * @brief Runs up to `kDrainBatch` jobs; returns whether more are queued.
+         */
+        bool drain();
+
+        /**
+         * @brief Drops the queued jobs after the pool refused or discarded the drain.
+         */
+        void abandon();
+
+        /**
+         * @brief Counts one job as done; the last one wakes the waiter.
+         */
+        void finish();
+
+        ThreadPool&         pool;              /**< Pool the drain runs on. */
+        std::mutex          mtx;               /**< Protects `tasks` and `scheduled`. */
+        std::deque<Task>    tasks;             /**< Jobs not started yet, FIFO. */
+        bool                scheduled = false; /**< A drain is queued or running. */
+        std::atomic<size_t> outstanding;       /**< Jobs queued or running. */
+    };
+
+    /**
+     * @brief Callable dispatched to the pool to run the strand's jobs.
+     *
+     * @details
+     * Destroyed without having run, it settles the strand through `abandon()`.
+     */
+    class Drain
+    {
+       public:
+        explicit Drain(std::shared_ptr<State> state) : state(std::move(state)) {}
+
+        Drain(Drain&& other) noexcept : state(std::move(other.state)), ran(other.ran) {}
+
+        Drain& operator=(Drain&&) = delete;
+
+        ~Drain()
+        {
+            if (state && !ran)
+                state->abandon();
+        }
+
+        void operator()()
+        {
+            ran = true;
+            if (state->drain())
+                state->schedule(state);
+        }
+
+        /**
+         * @brief Lets the pool match this drain to a waiter of its strand.
+         */
+        const std::atomic<size_t>* counter() const { return state ? &state->outstanding : nullptr; }
+
+       private:
+        std::shared_ptr<State> state;
+        bool                   ran = false;
+    };
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Queue and counters, shared with the drain in flight.
+     */
+    std::shared_ptr<State> state;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @class KeyedStrands
+ * @brief Fixed set of strands selected by hashing a key.
+ *
+ * @tparam Key  Key type (account id, session name...).
+ * @tparam Hash Hash function for `Key`.
+ *
+ * @details
+ * Jobs with equal keys always land on the same strand: they run in
+ * submission order and never concurrently. Distinct keys may share a
+ * strand (and then serialize), so more strands mean fewer false conflicts.
+ */
+template <typename Key, typename Hash = std::hash<Key>>
+class KeyedStrands
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Creates `count` strands over `pool`.
+     *
+     * @param pool  Pool running the jobs; must outlive this object.
+     * @param count Number of strands; 0 is raised to 1.
+     * @param hash  Hash function applied to the keys.
+     */
+    explicit KeyedStrands(ThreadPool& pool, size_t count = 64, const Hash& hash = Hash())
+        : hash(hash)
+    {
+        const size_t total = count > 0 ? count : 1;
+        strands.reserve(total);
+        for (size_t i = 0; i < total; ++i)
+            strands.emplace_back(new Strand(pool));
+    }
+
+    /**
+     * @brief Returns the strand serving `key`.
+     */
+    Strand& strand(const Key& key)
+    {
+        // Fibonacci hashing spreads weak hashes (e.g. identity on integers)
+        const size_t mixed =
+            static_cast<size_t>(hash(key)) * static_cast<size_t>(0x9E3779B97F4A7C15ull);
+        return *strands[(mixed >> (sizeof(size_t) * 4)) % strands.size()];
+    }
+
+    /**
+     * @brief Queues an `IJob` on the strand of `key`.
+     */
+    void enqueue(const Key& key, std::unique_ptr<IJob> job) { strand(key).enqueue(std::move(job)); }
+
+    /**
+     * @brief Queues a `void()` callable on the strand of `key`.
+     */
+    template <typename F>
+    void post(const Key& key, F&& fn)
+    {
+        strand(key).post(std::forward<F>(fn));
+    }
+
+    /**
+     * @brief Queues a callable on the strand of `key` and returns a future for its result.
+     */
+    template <typename F, typename R = decltype(std::declval<typename std::decay<F>::type&>()())>
+    TaskFuture<R> submit(const Key& key, F&& fn)
+    {
+        return strand(key).submit(std::forward<F>(fn));
+    }
+
+    /**
+     * @brief Blocks until every strand is idle, helping meanwhile.
+     */
+    void wait()
+    {
+        for (auto& s : strands)
+            s->wait();
+    }
+
+    /**
+     * @brief Returns the number of jobs queued or running on all strands.
+     */
+    size_t pending() const
+    {
+        size_t total = 0;
+        for (const auto& s : strands)
+            total += s->pending();
+        return total;
+    }
+
+    /**
+     * @brief Returns the number of strands.
+     */
+    size_t size() const { return strands.size(); }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Hash function applied to the keys.
+     */
+    Hash hash;
+
+    /**
+     * @brief The strands, never resized after construction.
+     */
+    std::vector<std::unique_ptr<Strand>> strands;
+
+    /******************************************************************/
+};
@@ -0,0 +1,561 @@
+/**
+ * @file        task.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Type-erased, move-only callable with inline small-buffer storage.
+ *
+ * @details
+ * `Task` is the unit the queues and workers actually move around. It can
+ * hold:
+ *  - Any callable `void()` (lambda, functor, function pointer). Callables
+ *    that fit in `Task::kInlineSize` bytes and are nothrow-movable are stored
+ *    inline, so submitting them costs no heap allocation. Larger ones fall
+ *    back to the heap.
+ *  - A legacy `std::unique_ptr<IJob>` (adapter). The pointer itself is stored
+ *    inline, so existing `IJob` users keep their single allocation.
+ *
+ * Either can be stored together with a `JobGuard`: `check()` then tells the
+ * worker whether the Task is still wanted before it runs it. Unguarded
+ * Tasks keep a null entry in their table and pay nothing for it. Likewise,
+ * `counter()` reports the completion counter a callable settles (the jobs
+ * of `TaskGroup`, `Strand` and `TaskGraph`), so the pool can tell which
+ * jobs a blocked waiter depends on.
+ *
+ * Dispatch goes through a per-type table of function pointers, i.e. one
+ * indirect call per operation, exactly like a virtual call but without
+ * requiring the callable to derive from anything.
+ *
+ * Example:
+ * @code
+ * Task t([counter] { counter->fetch_add(1); });
+ * t();                 // runs the lambda
+ * @endcode
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+/* Project libraries */
+
+#include "cancellation.h"
+#include "i_job.h"
+
+/*****************************************************************************/
+
+/**
+ * @class Task
+ * @brief Move-only `void()` callable with small-buffer optimization.
+ *
+ * @details
+ * A default-constructed Task is empty: `static_cast<bool>(task) == false`
+ * and it must not be invoked.
+ */
+class Task
+{
+    /******************************************************************/
+
+    /* Public Constants */
+
+   public:
+    /**
+     * @brief Bytes of inline storage available to callables.
+     *
+     * @details
+     * Chosen so that a Task (storage + dispatch table pointer + bookkeeping)
+     * fits in a single 64-byte cache line.
+     */
+    static constexpr std::size_t kInlineSize = 48;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty Task.
+     */
+    Task() noexcept : ops(nullptr), submitTicks(0) {}
+
+    /**
+     * @brief Adapts a legacy `IJob` (no extra allocation).
+     *
+     * @param job Job to own; a null pointer produces an empty Task.
+     */
+    explicit Task(std::unique_ptr<IJob> job);
+
+    /**
+     * @brief Stores any `void()` callable, inline when it fits.
+     *
+     * @param fn Callable to store (copied or moved).
+     */
+    template <typename F, typename Fn = typename std::decay<F>::type,
+              typename = typename std::enable_if<!std::is_same<Fn, Task>::value>::type,
+              typename = decltype(std::declval<Fn&>()())>
+    explicit Task(F&& fn) : ops(nullptr), submitTicks(0)
+    {
+        emplace<Fn>(std::forward<F>(fn), std::integral_constant<bool, fitsInline<Fn>()>{});
+    }
+
+    /**
+     * @brief Stores a callable that is only run while `guard` allows it.
+     *
+     * @param fn    Callable to store (copied or moved).
+     * @param guard Cancellation token and/or deadline checked through `check()`.
+     */
+    template <typename F, typename Fn = typename std::decay<F>::type,
+              typename = decltype(std::declval<Fn&>()())>
+    Task(F&& fn, const JobGuard& guard) : ops(nullptr), submitTicks(0)
+    {
+        emplace<Guarded<Fn>>(Guarded<Fn>(guard, std::forward<F>(fn)),
+                             std::integral_constant<bool, fitsInline<Guarded<Fn>>()>{});
+    }
+
+    /**
+     * @brief Adapts a legacy `IJob` that is only run while `guard` allows it.
+     *
+     * @param job   Job to own; a null pointer produces an empty Task.
+     * @param guard Cancellation token and/or deadline checked through `check()`.
+     */
+    Task(std::unique_ptr<IJob> job, const JobGuard& guard);
+
+    /**
+     * @brief Move constructor (relocates the stored callable).
+     */
+    Task(Task&& other) noexcept : ops(other.ops), submitTicks(other.submitTicks)
+    {
+        if (ops)
+        {
+            ops->relocate(storage, other.storage);
+            other.ops = nullptr;
+        }
+    }
+
+    /**
+     * @brief Move assignment (destroys the current callable first).
+     */
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            submitTicks = other.submitTicks;
+            if (other.ops)
+            {
+                other.ops->relocate(storage, other.storage);
+                ops       = other.ops;
+                other.ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Disable copy constructor (Tasks own their callable).
+     */
+    Task(const Task&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    Task& operator=(const Task&) = delete;
+
+    /**
+     * @brief Destroys the stored callable, if any.
+     */
+    ~Task() { reset(); }
+
+    /**
+     * @brief Invokes the stored callable.
+     *
+     * @warning Undefined behaviour on an empty Task.
+     */
+    void operator()() { ops->invoke(storage); }
+
+    /**
+     * @brief Returns whether a callable is stored.
+     */
+    explicit operator bool() const noexcept { return ops != nullptr; }
+
+    /**
+     * @brief Returns whether the callable lives in the inline buffer.
+     */
+    bool isInline() const noexcept { return ops && ops->isInline; }
+
+    /**
+     * @brief Returns the (implementation-defined) type name of the stored callable.
+     *
+     * @details
+     * For adapted jobs this is the dynamic type of the `IJob`.
+     */
+    const char* typeName() const { return ops ? ops->name(storage) : "empty"; }
+
+    /**
+     * @brief Returns whether the Task should still run (`Run` when unguarded).
+     *
+     * @details
+     * Called by the workers right after dequeuing: a Task that is not
+     * wanted any more is destroyed without running.
+     */
+    JobGuard::Verdict check() const
+    {
+        return ops && ops->check ? ops->check(storage) : JobGuard::Verdict::Run;
+    }
+
+    /**
+     * @brief Returns the completion counter the stored callable settles, if any.
+     *
+     * @details
+     * Callables with a `const std::atomic<std::size_t>* counter() const`
+     * member report it; the others (and adapted jobs) report `nullptr`.
+     */
+    const std::atomic<std::size_t>* counter() const
+    {
+        return ops && ops->counter ? ops->counter(storage) : nullptr;
+    }
+
+    /**
+     * @brief Records when the Task was submitted (steady-clock ticks since its epoch).
+     *
+     * @details
+     * Set by the pool so workers can measure the queue wait; travels with
+     * the Task through moves. 0 means "not stamped".
+     */
+    void setSubmitTime(std::int64_t ticks) noexcept { submitTicks = ticks; }
+
+    /**
+     * @brief Returns the submission stamp set by `setSubmitTime()` (0 if none).
+     */
+    std::int64_t submitTime() const noexcept { return submitTicks; }
+
+    /**
+     * @brief Destroys the stored callable and leaves the Task empty.
+     */
+    void reset() noexcept
+    {
+        if (ops)
+        {
+            ops->destroy(storage);
+            ops = nullptr;
+        }
+    }
+
+    /**
+     * @brief Converts this Task back into an owning `IJob`.
+     *
+     * @return The original job for adapted `IJob`s (no allocation); a heap
+     *         `TaskJob` wrapping the callable otherwise; `nullptr` if empty.
+     *
+     * @details
+     * Leaves this Task empty. Used by the legacy `IJobQueue::pop()` API.
+     */
+    std::unique_ptr<IJob> releaseJob();
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Raw inline buffer.
+     */
+    using Storage = typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type;
+
+    /**
+     * @brief Guard check of a stored callable.
+     */
+    using GuardCheck = JobGuard::Verdict (*)(const Storage& self);
+
+    /**
+     * @brief Completion counter of a stored callable.
+     */
+    using CounterOf = const std::atomic<std::size_t>* (*)(const Storage& self);
+
+    /**
+     * @brief Per-type dispatch table.
+     */
+    struct Ops
+    {
+        void (*invoke)(Storage& self);
+        void (*relocate)(Storage& dst, Storage& src) noexcept;
+        void (*destroy)(Storage& self) noexcept;
+        const char* (*name)(const Storage& self);
+        IJob* (*release)(Storage& self) noexcept; /**< Non-null only for adapted IJobs. */
+        GuardCheck check;   /**< Non-null only for guarded callables. */
+        CounterOf  counter; /**< Non-null only for callables exposing `counter()`. */
+        bool       isInline;
+    };
+
+    /**
+     * @brief Callable paired with the guard deciding whether it still runs.
+     */
+    template <typename Fn>
+    struct Guarded
+    {
+        template <typename F>
+        Guarded(const JobGuard& guard, F&& fn) : guard(guard), fn(std::forward<F>(fn))
+        {
+        }
+
+        void operator()() { fn(); }
+
+        JobGuard guard;
+        Fn       fn;
+    };
+
+    /**
+     * @brief Whether `Fn` is a `Guarded` callable.
+     */
+    template <typename Fn>
+    struct IsGuarded : std::false_type
+    {
+    };
+
+    template <typename Fn>
+    struct IsGuarded<Guarded<Fn>> : std::true_type
+    {
+    };
+
+    /**
+     * @brief `check` entry of `Model`'s table: `Model::check` when guarded, null otherwise.
+     */
+    template <typename Model>
+    static constexpr GuardCheck checkOf(std::true_type)
+    {
+        return &Model::check;
+    }
+
+    template <typename Model>
+    static constexpr GuardCheck checkOf(std::false_type)
+    {
+        return nullptr;
+    }
+
+    /**
+     * @brief Whether `Fn` has a `counter()` member.
+     */
+    template <typename Fn, typename = void>
+    struct HasCounter : std::false_type
+    {
+    };
+
+    template <typename Fn>
+    struct HasCounter<Fn, decltype(void(std::declval<const Fn&>().counter()))> : std::true_type
+    {
+    };
+
+    /**
+     * @brief `counter` entry of `Model`'s table: `Model::counter` when exposed, null otherwise.
+     */
+    template <typename Model>
+    static constexpr CounterOf counterOf(std::true_type)
+    {
+        return &Model::counter;
+    }
+
+    template <typename Model>
+    static constexpr CounterOf counterOf(std::false_type)
+    {
+        return nullptr;
+    }
+
+    /**
+     * @brief Callable stored directly in `storage`.
+     */
+    template <typename Fn>
+    struct InlineModel
+    {
+        static Fn* get(Storage& s) { return reinterpret_cast<Fn*>(&s); }
+
+        static void invoke(Storage& s) { (*get(s))(); }
+
+        static void relocate(Storage& dst, Storage& src) noexcept
+        {
+            ::new (static_cast<void*>(&dst)) Fn(std::move(*get(src)));
+            get(src)->~Fn();
+        }
+
+        static void destroy(Storage& s) noexcept { get(s)->~Fn(); }
+
+        static const char* name(const Storage&) { return typeid(Fn).name(); }
+
+        static JobGuard::Verdict check(const Storage& s)
+        {
+            return reinterpret_cast<const Fn*>(&s)->guard.check();
+        }
+
+        static const std::atomic<std::size_t>* counter(const Storage& s)
+        {
+            return reinterpret_cast<const Fn*>(&s)->counter();
+        }
+
+        static const Ops ops;
+    };
+
+    /**
+     * @brief Callable too large (or throwing on move) for the inline buffer.
+     */
+    template <typename Fn>
+    struct HeapModel
+    {
+        static Fn*& get(Storage& s) { return *reinterpret_cast<Fn**>(&s); }
+
+        static void invoke(Storage& s) { (*get(s))(); }
+
+        static void relocate(Storage& dst, Storage& src) noexcept
+        {
+            ::new (static_cast<void*>(&dst)) Fn*(get(src));
+        }
+
+        static void destroy(Storage& s) noexcept { delete get(s); }
+
+        static const char* name(const Storage&) { return typeid(Fn).name(); }
+
+        static JobGuard::Verdict check(const Storage& s)
+        {
+            return (*reinterpret_cast<Fn* const*>(&s))->guard.check();
+        }
+
+        static const std::atomic<std::size_t>* counter(const Storage& s)
+        {
+            return (*reinterpret_cast<Fn* const*>(&s))->counter();
+        }
+
+        static const Ops ops;
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Whether `Fn` can live in the inline buffer.
+     */
+    template <typename Fn>
+    static constexpr bool fitsInline()
+    {
+        return sizeof(Fn) <= sizeof(Storage) && alignof(Fn) <= alignof(Storage) &&
+               std::is_nothrow_move_constructible<Fn>::value;
+    }
+
+    /**
+     * @brief Inline construction.
+     */
+    template <typename Fn, typename F>
+    void emplace(F&& fn, std::true_type)
+    {
+        ::new (static_cast<void*>(&storage)) Fn(std::forward<F>(fn));
+        ops = &InlineModel<Fn>::ops;
+    }
+
+    /**
+     * @brief Heap construction.
+     */
+    template <typename Fn, typename F>
+    void emplace(F&& fn, std::false_type)
+    {
+        ::new (static_cast<void*>(&storage)) Fn*(new Fn(std::forward<F>(fn)));
+        ops = &HeapModel<Fn>::ops;
+    }
+
+    /**
+     * @brief Dispatch table for adapted `IJob`s (defined in task.cpp).
+     */
+    static const Ops jobOps;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Inline buffer (callable, heap pointer or `unique_ptr<IJob>`).
+     */
+    Storage storage;
+
+    /**
+     * @brief Dispatch table of the stored callable, `nullptr` when empty.
+     */
+    const Ops* ops;
+
+    /**
+     * @brief Submission stamp (see `setSubmitTime()`).
+     */
+    std::int64_t submitTicks;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/* Template definitions */
+
+template <typename Fn>
+const Task::Ops Task::InlineModel<Fn>::ops = {&InlineModel<Fn>::invoke,
+                                              &InlineModel<Fn>::relocate,
+                                              &InlineModel<Fn>::destroy,
+                                              &InlineModel<Fn>::name,
+                                              nullptr,
+                                              checkOf<InlineModel<Fn>>(IsGuarded<Fn>{}),
+                                              counterOf<InlineModel<Fn>>(HasCounter<Fn>{}),
+                                              true};
+
+template <typename Fn>
+const Task::Ops Task::HeapModel<Fn>::ops = {&HeapModel<Fn>::invoke,
+                                            &HeapModel<Fn>::relocate,
+                                            &HeapModel<Fn>::destroy,
+                                            &HeapModel<Fn>::name,
+                                            nullptr,
+                                            checkOf<HeapModel<Fn>>(IsGuarded<Fn>{}),
+                                            counterOf<HeapModel<Fn>>(HasCounter<Fn>{}),
+                                            false};
+
+/*****************************************************************************/
+
+/**
+ * @class TaskJob
+ * @brief `IJob` adapter around a `Task`.
+ *
+ * @details
+ * Only needed when a callable Task must leave the scheduler as an `IJob`
+ * (e.g. through the legacy `IJobQueue::pop()` or `ThreadPool::shutdownNow()`).
+ * A guarded Task keeps its guard: `execute()` skips it once cancelled or expired.
+ */
+class TaskJob : public IJob
+{
+   public:
+    /**
+     * @brief Takes ownership of `task`.
+     */
+    explicit TaskJob(Task task) : task(std::move(task)) {}
+
+    /**
+     * @brief Runs the wrapped Task unless its guard says otherwise.
+     */
+    void execute() override
+    {
+        if (task.check() == JobGuard::Verdict::Run)
+            task();
+    }
+
+   private:
+    Task task;
+};
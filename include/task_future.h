@@ -0,0 +1,736 @@
+/**
+ * @file        task_future.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Lightweight future returned by `ThreadPool::submit()`.
+ *
+ * @details
+ * A submission is backed by exactly **one** heap block, `FutureTask<R, Fn>`,
+ * holding at the same time:
+ *  - the callable to run,
+ *  - the slot for its result (or the exception it threw),
+ *  - the completion flags, an intrusive reference count and the optional
+ *    continuation.
+ *
+ * The Task pushed into the queue only carries a pointer to that block, so it
+ * always fits inline, and the `TaskFuture<R>` handed to the caller shares the
+ * same block. There is no separate promise / shared state / packaged task
+ * as with `std::packaged_task` + `std::future`.
+ *
+ * Completion is a single atomic `fetch_or`. The mutex / condition variable
+ * embedded in the block are only touched when somebody is actually blocked
+ * in `wait()` or a continuation is registered.
+ *
+ * Continuations attached with `then()` are dispatched to the executor; those
+ * attached with `thenInline()` run right away on the thread that completes
+ * the antecedent, up to `kMaxInlineDepth` nested levels per thread, past
+ * which they are dispatched as well (to the worker's own deque in
+ * work-stealing mode).
+ *
+ * If the Task is destroyed without running (e.g. discarded by
+ * `shutdownNow()`), the future completes with `std::future_errc::broken_promise`
+ * instead of hanging forever.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/* Project libraries */
+
+#include "i_executor.h"
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @class FutureStateBase
+ * @brief Type-independent part of a future's shared block.
+ *
+ * @details
+ * Reference counted: one reference for the producing Task, one for the
+ * `TaskFuture`, one for a pending continuation. The block deletes itself
+ * when the last reference is dropped.
+ */
+class FutureStateBase
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs a pending state with one reference.
+     *
+     * @param executor Where continuations are dispatched (may be `nullptr`:
+     *                 continuations then run inline on the completing thread).
+     */
+    explicit FutureStateBase(IExecutor* executor) noexcept;
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    FutureStateBase(const FutureStateBase&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    FutureStateBase& operator=(const FutureStateBase&) = delete;
+
+    /**
+     * @brief Adds a reference.
+     */
+    void addRef() noexcept { refs.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief Drops a reference, deleting the block when it was the last one.
+     */
+    void release() noexcept
+    {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
+    }
+
+    /**
+     * @brief Returns whether a value or an exception has been stored (non-blocking).
+     */
+    bool ready() const noexcept { return (flags.load(std::memory_order_acquire) & kReady) != 0; }
+
+    /**
+     * @brief Blocks until the state is ready.
+     */
+    void wait();
+
+    /**
+     * @brief Blocks until the state is ready or `deadline` passes.
+     *
+     * @return `true` if ready.
+     */
+    bool waitUntil(std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief Completes the state with an exception.
+     */
+    void setError(std::exception_ptr error) noexcept;
+
+    /**
+     * @brief Registers the single continuation of this state.
+     *
+     * @param continuation Task to run once the state is ready.
+     * @param runInline    Run it on the completing thread instead of dispatching it.
+     *
+     * @details
+     * If the state is already ready the continuation is launched right
+     * away by the caller; otherwise the completing thread launches it.
+     */
+    void setContinuation(Task continuation, bool runInline = false);
+
+    /**
+     * @brief Returns the executor continuations are dispatched to.
+     */
+    IExecutor* continuationExecutor() const noexcept { return executor; }
+
+    /**
+     * @brief Runs the stored callable and completes the state.
+     */
+    virtual void run() = 0;
+
+    /**
+     * @brief Inline continuations nested on one thread before they are dispatched instead.
+     *
+     * @details
+     * Bounds the stack used by a long `thenInline()` chain completing at once.
+     */
+    static constexpr unsigned kMaxInlineDepth = 8;
+
+    /******************************************************************/
+
+    /* Protected Methods */
+
+   protected:
+    /**
+     * @brief Virtual destructor; only `release()` deletes.
+     */
+    virtual ~FutureStateBase() = default;
+
+    /**
+     * @brief Publishes completion, wakes waiters and fires the continuation.
+     *
+     * @details
+     * The result (or `error`) must be written before calling this.
+     */
+    void markReady() noexcept;
+
+    /**
+     * @brief Rethrows the stored exception, if any. Only valid once ready.
+     */
+    void rethrowIfError() const
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Runs a continuation inline when asked (and the depth allows) or
+     *        without an executor; otherwise hands it to the executor.
+     */
+    void launch(Task continuation, bool runInline) noexcept;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Completion flag.
+     */
+    static constexpr unsigned kReady = 1u;
+
+    /**
+     * @brief Someone is (or is about to be) blocked in `wait()`.
+     */
+    static constexpr unsigned kWaiter = 2u;
+
+    /**
+     * @brief A continuation has been stored.
+     */
+    static constexpr unsigned kContinuation = 4u;
+
+    /**
+     * @brief Intrusive reference count.
+     */
+    std::atomic<int> refs;
+
+    /**
+     * @brief Combination of `kReady`, `kWaiter` and `kContinuation`.
+     */
+    std::atomic<unsigned> flags;
+
+    /**
+     * @brief Executor used to dispatch the continuation.
+     */
+    IExecutor* const executor;
+
+    /**
+     * @brief Guards the slow paths (`wait()`, continuation hand-over).
+     */
+    std::mutex mtx;
+
+    /**
+     * @brief Signals waiters on completion.
+     */
+    std::condition_variable cv;
+
+    /**
+     * @brief Pending continuation (empty until `setContinuation()`).
+     */
+    Task continuation;
+
+    /**
+     * @brief The pending continuation asked to run on the completing thread.
+     */
+    bool inlineContinuation = false;
+
+    /**
+     * @brief Exception thrown by the callable, if any.
+     */
+    std::exception_ptr error;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @class FutureState
+ * @brief Result slot of a future producing `R`.
+ */
+template <typename R>
+class FutureState : public FutureStateBase
+{
+   public:
+    using FutureStateBase::FutureStateBase;
+
+    /**
+     * @brief Stores the result and completes the state.
+     */
+    template <typename V>
+    void setValue(V&& value)
+    {
+        ::new (static_cast<void*>(&storage)) R(std::forward<V>(value));
+        hasValue = true;
+        markReady();
+    }
+
+    /**
+     * @brief Moves the result out, or rethrows the stored exception.
+     *
+     * @warning Only valid once ready, and only once.
+     */
+    R take()
+    {
+        rethrowIfError();
+        return std::move(*reinterpret_cast<R*>(&storage));
+    }
+
+   protected:
+    ~FutureState() override
+    {
+        if (hasValue)
+            reinterpret_cast<R*>(&storage)->~R();
+    }
+
+   private:
+    typename std::aligned_storage<sizeof(R), alignof(R)>::type storage;
+    bool                                                       hasValue = false;
+};
+
+/**
+ * @brief `void` specialization: completion only.
+ */
+template <>
+class FutureState<void> : public FutureStateBase
+{
+   public:
+    using FutureStateBase::FutureStateBase;
+
+    /**
+     * @brief Completes the state successfully.
+     */
+    void setValue() { markReady(); }
+
+    /**
+     * @brief Rethrows the stored exception, if any.
+     */
+    void take() { rethrowIfError(); }
+};
+
+/*****************************************************************************/
+
+/**
+ * @class FutureTask
+ * @brief The single allocation of a submission: callable + result slot.
+ */
+template <typename R, typename Fn>
+class FutureTask final : public FutureState<R>
+{
+   public:
+    template <typename F>
+    FutureTask(IExecutor* executor, F&& fn) : FutureState<R>(executor), fn(std::forward<F>(fn))
+    {
+    }
+
+    /**
+     * @brief Runs the callable, capturing its result or exception.
+     */
+    void run() override
+    {
+        try
+        {
+            complete(std::is_void<R>{});
+        }
+        catch (...)
+        {
+            this->setError(std::current_exception());
+        }
+    }
+
+   private:
+    void complete(std::true_type)
+    {
+        fn();
+        this->setValue();
+    }
+
+    void complete(std::false_type) { this->setValue(fn()); }
+
+    Fn fn;
+};
+
+/*****************************************************************************/
+
+/**
+ * @class FutureRunner
+ * @brief Pointer-sized callable queued in place of the submitted function.
+ *
+ * @details
+ * Owns one reference to the state. Dropping it without running completes the
+ * state with `broken_promise`.
+ */
+class FutureRunner
+{
+   public:
+    explicit FutureRunner(FutureStateBase* state) noexcept : state(state) {}
+
+    FutureRunner(FutureRunner&& other) noexcept : state(other.state) { other.state = nullptr; }
+
+    FutureRunner(const FutureRunner&)            = delete;
+    FutureRunner& operator=(const FutureRunner&) = delete;
+    FutureRunner& operator=(FutureRunner&&)      = delete;
+
+    ~FutureRunner()
+    {
+        if (!state)
+            return;
+
+        if (!state->ready())
+            state->setError(
+                std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+        state->release();
+    }
+
+    void operator()() { state->run(); }
+
+   private:
+    FutureStateBase* state;
+};
+
+/*****************************************************************************/
+
+/**
+ * @brief Result type of a continuation taking `T` (or nothing for `void`).
+ */
+template <typename Fn, typename T, typename = void>
+struct FutureContinuationResult
+{
+    using type = decltype(std::declval<Fn&>()(std::declval<T>()));
+};
+
+template <typename Fn, typename T>
+struct FutureContinuationResult<Fn, T, typename std::enable_if<std::is_void<T>::value>::type>
+{
+    using type = decltype(std::declval<Fn&>()());
+};
+
+/*****************************************************************************/
+
+/**
+ * @class TaskFuture
+ * @brief Move-only handle to the eventual result of a submitted callable.
+ *
+ * @details
+ * Provides polling (`ready()`), blocking (`wait()`, `waitFor()`), retrieval
+ * with exception propagation (`get()`) and chaining (`then()`,
+ * `thenInline()`). `get()` and the chaining calls consume the future:
+ * afterwards `valid()` is `false`.
+ *
+ * Example:
+ * @code
+ * TaskFuture<int> f = pool.submit([] { return 6 * 7; });
+ * int answer = f.get();                        // 42, or rethrows
+ * @endcode
+ */
+template <typename R>
+class TaskFuture
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an invalid future.
+     */
+    TaskFuture() noexcept : state(nullptr) {}
+
+    /**
+     * @brief Adopts one reference to `state`.
+     */
+    explicit TaskFuture(FutureState<R>* state) noexcept : state(state) {}
+
+    /**
+     * @brief Move constructor.
+     */
+    TaskFuture(TaskFuture&& other) noexcept : state(other.state) { other.state = nullptr; }
+
+    /**
+     * @brief Move assignment operator.
+     */
+    TaskFuture& operator=(TaskFuture&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            state       = other.state;
+            other.state = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Disable copy constructor (a result can only be taken once).
+     */
+    TaskFuture(const TaskFuture&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    TaskFuture& operator=(const TaskFuture&) = delete;
+
+    /**
+     * @brief Drops the reference; the submitted callable still runs.
+     */
+    ~TaskFuture() { reset(); }
+
+    /**
+     * @brief Returns whether this future refers to a result.
+     */
+    bool valid() const noexcept { return state != nullptr; }
+
+    /**
+     * @brief Returns whether the result is available (non-blocking poll).
+     */
+    bool ready() const noexcept { return state && state->ready(); }
+
+    /**
+     * @brief Blocks until the result is available.
+     */
+    void wait() const { checked()->wait(); }
+
+    /**
+     * @brief Blocks until the result is available or `timeout` elapses.
+     *
+     * @return `true` if the result is available.
+     */
+    template <typename Rep, typename Period>
+    bool waitFor(const std::chrono::duration<Rep, Period>& timeout) const
+    {
+        return checked()->waitUntil(std::chrono::steady_clock::now() +
+                                    std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+    }
+
+    /**
+     * @brief Waits for and returns the result, rethrowing the callable's exception.
+     *
+     * @details
+     * Invalidates the future.
+     */
+    R get()
+    {
+        Holder holder(checked());
+        state = nullptr;
+        holder.state->wait();
+        return holder.state->take();
+    }
+
+    /**
+     * @brief Chains `fn` to run once this result is available.
+     *
+     * @param fn Callable taking `R` (or nothing for `void`).
+     * @return Future of `fn`'s result.
+     *
+     * @details
+     * The continuation is dispatched to the executor that ran this future
+     * (immediately if the result is already there). If this future failed,
+     * `fn` is skipped and the exception propagates to the returned future.
+     * Invalidates this future.
+     */
+    template <typename F, typename Fn = typename std::decay<F>::type,
+              typename U = typename FutureContinuationResult<Fn, R>::type>
+    TaskFuture<U> then(F&& fn)
+    {
+        return chain<U, Fn>(std::forward<F>(fn), false);
+    }
+
+    /**
+     * @brief Chains `fn` to run on the thread that completes this future.
+     *
+     * @param fn Short callable taking `R` (or nothing for `void`).
+     * @return Future of `fn`'s result.
+     *
+     * @details
+     * Meant for cheap follow-up stages: `fn` runs right after the antecedent,
+     * on the same worker and with its data still in cache, without a queue
+     * round-trip or a wake-up. If the result is already there, `fn` runs
+     * inline on the calling thread. Past `kMaxInlineDepth` nested inline
+     * continuations on one thread, `fn` is dispatched like with `then()`.
+     * Errors propagate as with `then()`. Invalidates this future.
+     *
+     * @warning `fn` delays whatever the completing worker would run next;
+     *          blocking or long work belongs in `then()`.
+     */
+    template <typename F, typename Fn = typename std::decay<F>::type,
+              typename U = typename FutureContinuationResult<Fn, R>::type>
+    TaskFuture<U> thenInline(F&& fn)
+    {
+        return chain<U, Fn>(std::forward<F>(fn), true);
+    }
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Owns one reference and releases it on scope exit.
+     */
+    struct Holder
+    {
+        explicit Holder(FutureState<R>* state) : state(state) {}
+        ~Holder() { state->release(); }
+        FutureState<R>* state;
+    };
+
+    /**
+     * @brief Callable stored in the next future: feeds the antecedent's value to `fn`.
+     */
+    template <typename Fn>
+    class Continuation
+    {
+       public:
+        template <typename F>
+        Continuation(FutureState<R>* antecedent, F&& fn)
+            : antecedent(antecedent), fn(std::forward<F>(fn))
+        {
+        }
+
+        Continuation(Continuation&& other) noexcept(
+            std::is_nothrow_move_constructible<Fn>::value)
+            : antecedent(other.antecedent), fn(std::move(other.fn))
+        {
+            other.antecedent = nullptr;
+        }
+
+        ~Continuation()
+        {
+            if (antecedent)
+                antecedent->release();
+        }
+
+        typename FutureContinuationResult<Fn, R>::type operator()()
+        {
+            return call(std::is_void<R>{});
+        }
+
+       private:
+        typename FutureContinuationResult<Fn, R>::type call(std::true_type)
+        {
+            antecedent->take();
+            return fn();
+        }
+
+        typename FutureContinuationResult<Fn, R>::type call(std::false_type)
+        {
+            return fn(antecedent->take());
+        }
+
+        FutureState<R>* antecedent;
+        Fn              fn;
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Returns the state, throwing `no_state` on an invalid future.
+     */
+    FutureState<R>* checked() const
+    {
+        if (!state)
+            throw std::future_error(std::future_errc::no_state);
+        return state;
+    }
+
+    /**
+     * @brief Common path of `then()` and `thenInline()`.
+     */
+    template <typename U, typename Fn, typename F>
+    TaskFuture<U> chain(F&& fn, bool runInline)
+    {
+        FutureState<R>* antecedent = checked();
+        state                      = nullptr;
+
+        using Body = Continuation<Fn>;
+        auto* next = new FutureTask<U, Body>(antecedent->continuationExecutor(),
+                                             Body(antecedent, std::forward<F>(fn)));
+        next->addRef();
+        antecedent->setContinuation(Task(FutureRunner(next)), runInline);
+        return TaskFuture<U>(next);
+    }
+
+    /**
+     * @brief Drops the held reference, if any.
+     */
+    void reset() noexcept
+    {
+        if (state)
+        {
+            state->release();
+            state = nullptr;
+        }
+    }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Shared block, `nullptr` when invalid.
+     */
+    FutureState<R>* state;
+
+    /******************************************************************/
+};
+
+/*****************************************************************************/
+
+/**
+ * @brief Allocates the shared block for `fn` and returns the Task to queue.
+ *
+ * @param executor Executor running the Task (and later continuations).
+ * @param fn       Callable producing `R`.
+ * @param future   Receives the caller's handle.
+ * @return Pointer-sized Task that runs `fn` and completes `future`.
+ */
+template <typename R, typename F>
+Task makeFutureTask(IExecutor* executor, F&& fn, TaskFuture<R>& future)
+{
+    using Fn   = typename std::decay<F>::type;
+    auto* body = new FutureTask<R, Fn>(executor, std::forward<F>(fn));
+    body->addRef();
+    future = TaskFuture<R>(body);
+    return Task(FutureRunner(body));
+}
+
+/**
+ * @brief Same as above, with the returned Task skipped by the workers once `guard` says so.
+ *
+ * @details
+ * A skipped Task is destroyed unrun, completing `future` with `broken_promise`.
+ */
+template <typename R, typename F>
+Task makeFutureTask(IExecutor* executor, F&& fn, TaskFuture<R>& future, const JobGuard& guard)
+{
+    using Fn   = typename std::decay<F>::type;
+    auto* body = new FutureTask<R, Fn>(executor, std::forward<F>(fn));
+    body->addRef();
+    future = TaskFuture<R>(body);
+    return Task(FutureRunner(body), guard);
+}
@@ -0,0 +1,309 @@
+/**
+ * @file        task_graph.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Dependency graph of jobs run on a ThreadPool, reusable across runs.
+ *
+ * @details
+ * Nodes are jobs; an edge `a -> c` means `c` may only start once `a` has
+ * finished. `run()` submits the nodes without predecessors; every node
+ * carries an atomic countdown of unfinished predecessors, and the node
+ * bringing a successor's countdown to zero releases it:
+ *  - the first successor it releases runs next on the same thread, without
+ *    going through a queue;
+ *  - the others are dispatched to the pool (the finishing worker's own
+ *    deque in work-stealing mode).
+ *
+ * The graph is built once and can be run any number of times: a run only
+ * resets the countdowns, so it allocates nothing on the graph side (the
+ * released jobs are inline `Task`s).
+ *
+ * `wait()` helps the pool like `TaskGroup::wait()`. A node that throws
+ * still releases its successors; the first exception is rethrown by
+ * `wait()`. If the pool refuses or discards a released node, the nodes not
+ * started yet are skipped and `wait()` reports `broken_promise`.
+ *
+ * Example:
+ * @code
+ * TaskGraph graph(pool);
+ * const size_t a = graph.add(loadA);
+ * const size_t b = graph.add(loadB);
+ * graph.add(merge, {a, b});   // runs after a and b
+ *
+ * for (int frame = 0; frame < 100; ++frame)
+ * {
+ *     graph.run();
+ *     graph.wait();
+ * }
+ * @endcode
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* Project libraries */
+
+#include "i_job.h"
+#include "task.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+/**
+ * @class TaskGraph
+ * @brief Jobs with predecessors, run on one pool as many times as needed.
+ *
+ * @details
+ * The graph is built and run from one thread; jobs run on the pool.
+ * `precede()` is refused while a run is in progress.
+ */
+class TaskGraph
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Creates an empty graph running on `pool`.
+     *
+     * @param pool Pool running the nodes; must outlive the graph.
+     */
+    explicit TaskGraph(ThreadPool& pool);
+
+    /**
+     * @brief Waits for a run in progress (errors are discarded).
+     */
+    ~TaskGraph();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    TaskGraph(const TaskGraph&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    /**
+     * @brief Adds a node running `fn`, after every node of `predecessors`.
+     *
+     * @return Id of the node, for later `precede()` / `add()` calls.
+     */
+    template <typename F, typename = decltype(std::declval<typename std::decay<F>::type&>()())>
+    size_t add(F&& fn, std::initializer_list<size_t> predecessors = {})
+    {
+        return addNode(Task(std::forward<F>(fn)), predecessors);
+    }
+
+    /**
+     * @brief Adds a node running `job->execute()`, after every node of `predecessors`.
+     *
+     * @return Id of the node; a null job adds a node doing nothing, with a warning.
+     */
+    size_t add(std::unique_ptr<IJob> job, std::initializer_list<size_t> predecessors = {});
+
+    /**
+     * @brief Makes `after` wait for `before`.
+     *
+     * @return `false` (with a warning) for an unknown id, a self edge, or while running.
+     */
+    bool precede(size_t before, size_t after);
+
+    /**
+     * @brief Submits the nodes without predecessors; the rest follow as they are released.
+     *
+     * @return `false` (with a log) while a previous run is in progress or if
+     *         the edges form a cycle; nothing is submitted then.
+     */
+    bool run();
+
+    /**
+     * @brief Blocks until the current run has finished, helping meanwhile.
+     *
+     * @details
+     * Rethrows the first exception thrown by a node during the run (the
+     * others are dropped), after which the graph can be run again.
+     */
+    void wait();
+
+    /**
+     * @brief Returns the number of nodes.
+     */
+    size_t size() const { return nodes.size(); }
+
+    /**
+     * @brief Returns the number of nodes of the current run not finished yet.
+     */
+    size_t pending() const { return outstanding.load(std::memory_order_acquire); }
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief One job and its edges.
+     */
+    struct Node
+    {
+        Node(Task work, size_t id) : work(std::move(work)), id(id), predecessors(0), countdown(0)
+        {
+        }
+
+        Task                work;         /**< Run once per run. */
+        size_t              id;           /**< Index in `nodes`. */
+        std::vector<Node*>  successors;   /**< Nodes waiting for this one. */
+        size_t              predecessors; /**< Nodes this one waits for. */
+        std::atomic<size_t> countdown;    /**< Predecessors not finished in this run. */
+    };
+
+    /**
+     * @brief Callable dispatched to the pool for one released node.
+     *
+     * @details
+     * Destroyed without having run (pool refused or discarded it), it
+     * settles its node through `abandon()`, so `wait()` still returns.
+     */
+    class Release
+    {
+       public:
+        Release(TaskGraph* graph, Node* node) : graph(graph), node(node) {}
+
+        Release(Release&& other) noexcept : graph(other.graph), node(other.node), ran(other.ran)
+        {
+            other.graph = nullptr;
+        }
+
+        Release& operator=(Release&&) = delete;
+
+        ~Release()
+        {
+            if (graph && !ran)
+                graph->abandon(node);
+        }
+
+        void operator()()
+        {
+            ran = true;
+            graph->execute(node);
+        }
+
+        /**
+         * @brief Lets the pool match this node to a waiter of its graph.
+         */
+        const std::atomic<size_t>* counter() const { return graph ? &graph->outstanding : nullptr; }
+
+       private:
+        TaskGraph* graph;
+        Node*      node;
+        bool       ran = false;
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Appends a node and its incoming edges.
+     */
+    size_t addNode(Task work, std::initializer_list<size_t> predecessors);
+
+    /**
+     * @brief Recomputes `roots` and checks that the edges form no cycle.
+     */
+    bool validate();
+
+    /**
+     * @brief Runs `node`, then every successor it releases first, on the calling thread.
+     */
+    void execute(Node* node);
+
+    /**
+     * @brief Dispatches `node` to the pool.
+     */
+    void release(Node* node);
+
+    /**
+     * @brief Settles `node` and the nodes it alone was holding back, without running them.
+     */
+    void abandon(Node* node);
+
+    /**
+     * @brief Keeps `error` if it is the run's first.
+     */
+    void fail(std::exception_ptr error);
+
+    /**
+     * @brief Counts one node as finished; the last one wakes the waiter.
+     */
+    void finish();
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Pool the nodes run on.
+     */
+    ThreadPool& pool;
+
+    /**
+     * @brief Every node, in insertion order (ids are indices).
+     */
+    std::vector<std::unique_ptr<Node>> nodes;
+
+    /**
+     * @brief Nodes without predecessors, valid while `dirty` is false.
+     */
+    std::vector<Node*> roots;
+
+    /**
+     * @brief Set when edges or nodes changed since the last validation.
+     */
+    bool dirty = true;
+
+    /**
+     * @brief Nodes of the current run not finished yet.
+     */
+    std::atomic<size_t> outstanding;
+
+    /**
+     * @brief Set once a released node was refused: the remaining nodes are skipped.
+     */
+    std::atomic<bool> abandoned;
+
+    /**
+     * @brief Protects `error`.
+     */
+    std::mutex errorMtx;
+
+    /**
+     * @brief First exception thrown by a node of the current run.
+     */
+    std::exception_ptr error;
+
+    /******************************************************************/
+};
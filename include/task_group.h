@@ -0,0 +1,232 @@
+/**
+ * @file        task_group.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Fork / join over a ThreadPool: run N jobs, wait for all of them.
+ *
+ * @details
+ * While `wait()` blocks, the calling thread runs pending jobs of the pool
+ * itself (its own deque first when it is a work-stealing worker), and only
+ * sleeps when nothing is runnable. A job may therefore create a group, fan
+ * out and wait on it from inside the pool: the waiting worker keeps working
+ * instead of holding a thread hostage, so nested fork / join cannot
+ * exhaust the workers.
+ *
+ * Example:
+ * @code
+ * TaskGroup group(pool);
+ * for (auto& chunk : chunks)
+ *     group.run([&chunk] { process(chunk); });
+ * group.wait();   // rethrows the first exception, if any
+ * @endcode
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+/* Project libraries */
+
+#include "i_job.h"
+#include "task.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+/**
+ * @class TaskGroup
+ * @brief Set of jobs submitted to one pool and awaited together.
+ */
+class TaskGroup
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Creates an empty group submitting to `pool`.
+     *
+     * @param pool Pool running the jobs; must outlive the group.
+     */
+    explicit TaskGroup(ThreadPool& pool);
+
+    /**
+     * @brief Waits for the outstanding jobs (errors are discarded).
+     */
+    ~TaskGroup();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    TaskGroup(const TaskGroup&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * @brief Submits an `IJob` as part of the group.
+     *
+     * @param job Unique pointer to an `IJob` instance; null is ignored with a warning.
+     */
+    void run(std::unique_ptr<IJob> job);
+
+    /**
+     * @brief Submits a `void()` callable as part of the group.
+     *
+     * @details
+     * Goes through `ThreadPool::dispatch()`, so the usual routing applies
+     * (local deque when called from a work-stealing worker). If the pool
+     * refuses or discards the job, it counts as finished with
+     * `std::future_errc::broken_promise`.
+     */
+    template <typename F, typename = decltype(std::declval<typename std::decay<F>::type&>()())>
+    void run(F&& fn)
+    {
+        state->outstanding.fetch_add(1, std::memory_order_relaxed);
+        state->pool.dispatch(
+            Task(Member<typename std::decay<F>::type>(state, std::forward<F>(fn))));
+    }
+
+    /**
+     * @brief Blocks until every job run so far has finished, helping meanwhile.
+     *
+     * @details
+     * Rethrows the first exception thrown by a job of the group (the
+     * others are dropped), after which the group can be reused.
+     */
+    void wait();
+
+    /**
+     * @brief Returns the number of jobs submitted and not finished yet.
+     */
+    size_t pending() const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Shared by the group and its in-flight jobs.
+     */
+    struct State
+    {
+        explicit State(ThreadPool& pool) : pool(pool), outstanding(0) {}
+
+        /**
+         * @brief Keeps `error` if it is the group's first.
+         */
+        void fail(std::exception_ptr error);
+
+        /**
+         * @brief Settles one job; the last one wakes the waiter.
+         */
+        void finish();
+
+        ThreadPool&         pool;        /**< Pool the jobs are submitted to. */
+        std::atomic<size_t> outstanding; /**< Submitted, not finished. */
+        std::mutex          errorMtx;    /**< Protects `error`. */
+        std::exception_ptr  error;       /**< First exception thrown by a job. */
+    };
+
+    /**
+     * @brief Settles its job exactly once: after it ran, or with
+     *        `broken_promise` if it is destroyed without running.
+     *
+     * @details
+     * Declared before the callable in `Member`, so it is destroyed after it:
+     * the waiter is only released once the job's captures are gone.
+     */
+    class Ticket
+    {
+       public:
+        explicit Ticket(std::shared_ptr<State> state) : state(std::move(state)) {}
+
+        Ticket(Ticket&& other) noexcept : state(std::move(other.state)) {}
+
+        Ticket& operator=(Ticket&&) = delete;
+
+        ~Ticket();
+
+        /**
+         * @brief Returns the group's counter this ticket settles.
+         */
+        const std::atomic<size_t>* counter() const { return state ? &state->outstanding : nullptr; }
+
+        /**
+         * @brief Runs `fn`, capturing what it throws.
+         */
+        template <typename Fn>
+        void run(Fn& fn)
+        {
+            try
+            {
+                fn();
+            }
+            catch (...)
+            {
+                state->fail(std::current_exception());
+            }
+            ran = true;
+        }
+
+       private:
+        std::shared_ptr<State> state;
+        bool                   ran = false;
+    };
+
+    /**
+     * @brief Callable dispatched to the pool for one job of the group.
+     */
+    template <typename Fn>
+    class Member
+    {
+       public:
+        template <typename F>
+        Member(std::shared_ptr<State> state, F&& fn)
+            : ticket(std::move(state)), fn(std::forward<F>(fn))
+        {
+        }
+
+        void operator()() { ticket.run(fn); }
+
+        /**
+         * @brief Lets the pool match this job to a waiter of its group.
+         */
+        const std::atomic<size_t>* counter() const { return ticket.counter(); }
+
+       private:
+        Ticket ticket;
+        Fn     fn;
+    };
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Counter and first error, shared with the in-flight jobs.
+     */
+    std::shared_ptr<State> state;
+
+    /******************************************************************/
+};
@@ -8,13 +8,20 @@
  *
  * @details
  * The ThreadPool provides:
- *  - A configurable number of worker threads (default = hardware concurrency).
+ *  - A configurable number of worker threads (default = hardware concurrency),
+ *    resizable at runtime (`resize()`) or by an optional auto-scaler.
  *  - FIFO job submission through `enqueue()` and `tryEnqueue()`.
- *  - Graceful shutdown (`shutdown()`): waits for queued jobs to finish.
+ *  - Graceful shutdown (`shutdown()`): waits (event-driven, optional deadline)
+ *    for accepted jobs to finish and reports completed / abandoned counts.
  *  - Immediate shutdown (`shutdownNow()`): stops accepting jobs, interrupts waiting threads.
  *  - Automatic thread joining and safe cleanup.
+ *  - Per-worker counters and latency histograms (`metrics()`).
+ *  - Optional job timeline in Chrome trace-event format (`collectTrace()`).
  *
- * Jobs must inherit from `IJob` and override `execute()`.
+ * Jobs either inherit from `IJob` and override `execute()`, or are plain
+ * callables. `post()` is fire-and-forget (stored inline in a `Task`, no heap
+ * allocation when they fit); `submit()` returns a `TaskFuture` carrying the
+ * result or the exception thrown by the job.
  *
  * The pool guarantees:
  *  - No job is lost after being accepted.
@@ -33,6 +40,8 @@
 /* Standard libraries */
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -41,7 +50,21 @@
 
 /* Project libraries */
 
-#include "job_queue.h"
+#include "cancellation.h"
+#include "i_executor.h"
+#include "i_job_queue.h"
+#include "job_priority.h"
+#include "job_trace.h"
+#include "latency_histogram.h"
+#include "spin_wait.h"
+#include "task.h"
+#include "task_future.h"
+#include "thread_pool_config.h"
+#include "timer_wheel.h"
+
+/*****************************************************************************/
+
+class NumaJobQueue;
 
 /*****************************************************************************/
 
@@ -58,13 +81,70 @@
  * ThreadPool is non-copyable and non-movable to avoid transferring thread ownership.
  * Lifetime is strictly controlled: destruction forces a complete shutdown.
  */
-class ThreadPool
+class ThreadPool : public IExecutor
 {
     /******************************************************************/
 
     /* Public Methods */
 
    public:
+    /**
+     * @brief Outcome of a graceful `shutdown()`.
+     */
+    struct ShutdownReport
+    {
+        size_t completed = 0;    /**< Jobs that finished during the shutdown call. */
+        size_t abandoned = 0;    /**< Accepted jobs discarded without running. */
+        bool   drained   = true; /**< `false` if the deadline expired first. */
+    };
+
+    /**
+     * @brief Outcome counters of the backpressure policy (see `ThreadPoolConfig::maxQueuedJobs`).
+     */
+    struct BackpressureStats
+    {
+        size_t blocked       = 0; /**< Submissions that had to wait for room. */
+        size_t timedOut      = 0; /**< `Block` waits that expired (job rejected). */
+        size_t rejected      = 0; /**< Jobs refused by the `Reject` policy. */
+        size_t droppedOldest = 0; /**< Queued jobs discarded by `DropOldest`. */
+        size_t callerRuns    = 0; /**< Jobs run on the submitting thread by `CallerRuns`. */
+    };
+
+    /**
+     * @brief Counters and latency distributions of one worker thread (see `metrics()`).
+     */
+    struct WorkerMetrics
+    {
+        size_t                   executed = 0; /**< Jobs run (including the ones that threw). */
+        size_t                   failed   = 0; /**< Jobs that threw. */
+        size_t                   stolen   = 0; /**< Jobs taken from another worker's deque. */
+        std::chrono::nanoseconds busy{0};      /**< Time spent inside jobs (when timed). */
+        HistogramSnapshot        queueWait;    /**< Submission to start of execution, ns. */
+        HistogramSnapshot        execution;    /**< Start to end of execution, ns. */
+    };
+
+    /**
+     * @brief Snapshot returned by `metrics()`.
+     */
+    struct Metrics
+    {
+        std::chrono::nanoseconds   uptime{0};     /**< Total time spent running (all runs). */
+        size_t                     pending   = 0; /**< Accepted jobs not finished yet. */
+        size_t                     cancelled = 0; /**< Jobs skipped: token cancelled. */
+        size_t                     expired   = 0; /**< Jobs skipped: deadline passed. */
+        std::vector<WorkerMetrics> workers;     /**< One entry per worker index ever started. */
+        WorkerMetrics              total;       /**< Sum of `workers`. */
+
+        /**
+         * @brief Completed jobs per second of uptime.
+         */
+        double throughput() const
+        {
+            const double seconds = std::chrono::duration<double>(uptime).count();
+            return seconds > 0.0 ? static_cast<double>(total.executed) / seconds : 0.0;
+        }
+    };
+
     /**
      * @brief Constructs an empty thread pool (not running).
      *
@@ -73,13 +153,24 @@ class ThreadPool
      */
     explicit ThreadPool();
 
+    /**
+     * @brief Constructs an empty thread pool (not running) with custom options.
+     *
+     * @param config Queue backend and tuning options.
+     *
+     * @details
+     * The shared queue is created here according to `config.queueBackend`;
+     * threads are NOT created until `start()` is called.
+     */
+    explicit ThreadPool(const ThreadPoolConfig& config);
+
     /**
      * @brief Destructs the thread pool.
      *
      * @details
      * Automatically performs `shutdown()` to ensure all threads are joined.
      */
-    ~ThreadPool();
+    ~ThreadPool() override;
 
     /**
      * @brief Deleted copy constructor.
@@ -125,9 +216,28 @@ class ThreadPool
      * If called multiple times, only the first one creates threads.
      *
      * If number_threads == 0, the pool forces 1 thread.
+     *
+     * Reserves worker slots up to `ThreadPoolConfig::maxThreads` (at least
+     * `number_threads`) and, with `ThreadPoolConfig::autoScale`, starts the
+     * auto-scaler.
      */
     void start(size_t number_threads = std::thread::hardware_concurrency());
 
+    /**
+     * @brief Changes the number of workers of a running pool.
+     *
+     * @param number_threads New worker count, clamped to [1, `maxThreads`].
+     *
+     * @details
+     * Growing starts the new workers right away, reusing the slots (index,
+     * metrics, deque) of retired ones. Shrinking asks surplus workers to
+     * retire: a busy worker leaves after its current batch, an idle one at
+     * once, so no accepted job is lost. `size()` drops as they leave.
+     *
+     * Ignored if the pool is not running.
+     */
+    void resize(size_t number_threads);
+
     /**
      * @brief Enqueues a job for execution.
      *
@@ -136,17 +246,64 @@ class ThreadPool
      * @details
      * The job is ALWAYS accepted as long as:
      *  - the pool is running, and
-     *  - the queue is not closed.
+     *  - no `shutdown()` / `shutdownNow()` has begun (a job submitted by a
+     *    job running on this pool is still accepted, so it can finish), and
+     *  - the queue is not closed, and
+     *  - the shared queue is below `ThreadPoolConfig::maxQueuedJobs`
+     *    (otherwise `overflowPolicy` decides: wait, reject, drop the oldest
+     *    queued job, or run it on the calling thread).
+     *
+     * In `WorkStealing` mode, a job enqueued from inside a job running on
+     * this pool goes to the calling worker's local deque instead of the
+     * shared queue.
      *
      * @warning This function throws if `job` is nullptr.
      */
     void enqueue(std::unique_ptr<IJob> job);
 
+    /**
+     * @brief Enqueues a job with a scheduling priority.
+     *
+     * @param job      Unique pointer to an `IJob` instance.
+     * @param priority Lane of the shared queue the job waits in.
+     *
+     * @details
+     * Same acceptance rules as `enqueue(job)`, which uses `JobPriority::Normal`.
+     * Workers always take the highest non-empty lane first (subject to
+     * `ThreadPoolConfig::priorityAging`). The priority is ignored by the
+     * `LockFreeRing` backend. In work-stealing mode a job enqueued by a worker
+     * with a priority other than `Normal` goes to the shared queue, not to the
+     * worker's deque, so its lane applies; the worker itself still finishes
+     * its own deque first, while idle workers pick the job up before stealing.
+     */
+    void enqueue(std::unique_ptr<IJob> job, JobPriority priority);
+
+    /**
+     * @brief Enqueues a job that is skipped if `guard` no longer allows it when dequeued.
+     *
+     * @param job   Unique pointer to an `IJob` instance.
+     * @param guard Cancellation token and/or deadline.
+     *
+     * @details
+     * Same acceptance rules as `enqueue(job)`. A worker dequeuing the job
+     * after its token was cancelled or past its deadline destroys it
+     * without calling `execute()`, and counts it in `Metrics::cancelled` /
+     * `Metrics::expired`. A job already running is never interrupted: it
+     * may poll its own token.
+     *
+     * Example:
+     * @code
+     * pool.enqueue(std::make_unique<Render>(request), std::chrono::milliseconds(20));
+     * @endcode
+     */
+    void enqueue(std::unique_ptr<IJob> job, const JobGuard& guard);
+
     /**
      * @brief Attempts to enqueue a job without guaranteeing acceptance.
      *
      * @param job Unique pointer to an `IJob` instance.
-     * @return `true` if the job was accepted, `false` otherwise.
+     * @return `true` if the job was accepted (or run by `CallerRuns`),
+     *         `false` if the pool is stopped or backpressure refused it.
      *
      * @details
      * Useful when external systems must avoid blocking or must not enqueue
@@ -155,29 +312,237 @@ class ThreadPool
     bool tryEnqueue(std::unique_ptr<IJob> job);
 
     /**
-     * @brief Gracefully shuts down the pool.
+     * @brief Enqueues several jobs with a single shared-queue operation.
+     *
+     * @param jobs Jobs to run, in submission order. Null entries are skipped
+     *             with a warning.
+     *
+     * @details
+     * The jobs are published with one `IJobQueue::pushTasks()` call (one lock
+     * and one wake-up for the `Mutex` backend) instead of one per job.
+     * When the shared queue is bounded, or when called from a work-stealing
+     * worker, each job goes through the same path as `enqueue()` so the
+     * overflow policy and local-deque routing still apply per job.
+     */
+    void enqueueBatch(std::vector<std::unique_ptr<IJob>> jobs);
+
+    /**
+     * @brief Enqueues a callable for execution, fire-and-forget.
+     *
+     * @param fn Any `void()` callable (lambda, functor...).
+     *
+     * @details
+     * The callable is stored in a `Task`: if it fits in `Task::kInlineSize`
+     * bytes and is nothrow-movable it lives inline in the queue slot, so the
+     * submission performs no heap allocation of its own. Same acceptance
+     * rules as `enqueue()`. Exceptions are only logged.
+     *
+     * Example:
+     * @code
+     * pool.post([&counter] { counter.fetch_add(1); });
+     * @endcode
+     */
+    template <typename F>
+    void post(F&& fn)
+    {
+        dispatch(Task(std::forward<F>(fn)));
+    }
+
+    /**
+     * @brief Enqueues a callable that is skipped if `guard` no longer allows it when dequeued.
+     *
+     * @details
+     * See `enqueue(job, guard)`. The guard travels inline with the callable.
+     */
+    template <typename F>
+    void post(F&& fn, const JobGuard& guard)
+    {
+        dispatch(Task(std::forward<F>(fn), guard));
+    }
+
+    /**
+     * @brief Enqueues a callable and returns a future for its result.
+     *
+     * @param fn Any callable taking no arguments; may return a value.
+     * @return Future completed with the return value or the thrown exception.
+     *
+     * @details
+     * Costs exactly one allocation, shared by the callable, the result and
+     * the future (see `task_future.h`). Continuations attached with
+     * `TaskFuture::then()` are dispatched back to this pool.
+     *
+     * Example:
+     * @code
+     * TaskFuture<int> answer = pool.submit([] { return 42; });
+     * answer.get();                // 42, or rethrows
+     * @endcode
+     */
+    template <typename F, typename R = decltype(std::declval<typename std::decay<F>::type&>()())>
+    TaskFuture<R> submit(F&& fn)
+    {
+        TaskFuture<R> future;
+        dispatch(makeFutureTask<R>(this, std::forward<F>(fn), future));
+        return future;
+    }
+
+    /**
+     * @brief Enqueues a callable under `guard` and returns a future for its result.
+     *
+     * @details
+     * See `enqueue(job, guard)`. A skipped callable completes the future
+     * with `std::future_errc::broken_promise`.
+     */
+    template <typename F, typename R = decltype(std::declval<typename std::decay<F>::type&>()())>
+    TaskFuture<R> submit(F&& fn, const JobGuard& guard)
+    {
+        TaskFuture<R> future;
+        dispatch(makeFutureTask<R>(this, std::forward<F>(fn), future, guard));
+        return future;
+    }
+
+    /**
+     * @brief Enqueues an `IJob` and returns a future that completes when it ran.
+     *
+     * @param job Unique pointer to an `IJob` instance.
+     * @return Future rethrowing whatever `execute()` threw.
+     *
+     * @warning A null job yields a future completed with `broken_promise`.
+     */
+    TaskFuture<void> submit(std::unique_ptr<IJob> job);
+
+    /**
+     * @brief Enqueues `job` once `delay` has elapsed.
+     *
+     * @param delay Time to wait before the job is handed to the queue.
+     * @param job   Unique pointer to an `IJob` instance.
+     * @return Handle to cancel the timer; invalid if the pool is not running.
+     *
+     * @details
+     * The wait happens on the pool's timer thread, not on a worker. See
+     * `scheduleAt()`.
+     */
+    template <typename Rep, typename Period>
+    TimerHandle scheduleAfter(const std::chrono::duration<Rep, Period>& delay,
+                              std::unique_ptr<IJob>                     job)
+    {
+        return scheduleAt(std::chrono::steady_clock::now() +
+                              std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay),
+                          std::move(job));
+    }
+
+    /**
+     * @brief Enqueues `job` once `when` is reached.
+     *
+     * @param when Deadline on the steady clock.
+     * @param job  Unique pointer to an `IJob` instance.
+     * @return Handle to cancel the timer; invalid if the pool is not running.
+     *
+     * @details
+     * Timers are kept in a hierarchical timing wheel (`TimerWheel`) driven by
+     * a timer thread started on first use; insertion and expiry are O(1) and
+     * accuracy is one `ThreadPoolConfig::timerTick`. A due job goes through
+     * the same path as `enqueue()`. Timers still pending at shutdown are
+     * discarded.
+     */
+    TimerHandle scheduleAt(std::chrono::steady_clock::time_point when,
+                           std::unique_ptr<IJob>                 job);
+
+    /**
+     * @brief Enqueues `job` every `period`, the first time one period from now.
+     *
+     * @param period Interval between runs.
+     * @param job    Unique pointer to an `IJob` instance, executed on every run.
+     * @return Handle to stop the timer; invalid if the pool is not running.
+     *
+     * @details
+     * A run is skipped while the previous one is still queued or running, so
+     * `job->execute()` never runs concurrently with itself.
+     */
+    template <typename Rep, typename Period>
+    TimerHandle scheduleEvery(const std::chrono::duration<Rep, Period>& period,
+                              std::unique_ptr<IJob>                     job)
+    {
+        return scheduleRepeating(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(period),
+            std::move(job));
+    }
+
+    /**
+     * @brief Routes a task to the shared queue or the caller's local deque.
+     *
+     * @details
+     * Common path of `enqueue()`, `tryEnqueue()`, `post()` and `submit()`;
+     * also used by futures to schedule continuations. Empty tasks (e.g. a
+     * null `IJob`) are dropped with a warning.
+     */
+    void dispatch(Task task) override;
+
+    /**
+     * @brief Gracefully shuts down the pool, waiting as long as needed.
      *
      * @details
      * - Stops accepting new jobs.
-     * - Waits up to 1 second for the queue to drain.
+     * - Waits until every accepted job (including jobs spawned by running
+     *   jobs) has finished. The wait is event-driven: the last worker to
+     *   finish wakes the caller, no polling.
      * - Closes the queue.
      * - Joins all threads.
      *
-     * threads finish any job already in progress.
+     * @return Completed / abandoned counts (nothing is abandoned here).
      */
-    void shutdown();
+    ShutdownReport shutdown();
 
     /**
-     * @brief Immediately shuts down the pool.
+     * @brief Gracefully shuts down the pool, draining until `deadline`.
+     *
+     * @param deadline Latest time to wait for the drain.
+     * @return How many jobs completed during the call and how many queued
+     *         jobs were abandoned because the deadline expired.
      *
      * @details
-     * - Stops accepting new jobs.
-     * - Immediately closes the queue.
-     * - threads unblock and exit even if jobs remain unprocessed.
+     * If the deadline expires, jobs still queued are discarded (futures
+     * complete with `broken_promise`); jobs already running finish normally
+     * and count as completed.
+     */
+    ShutdownReport shutdown(std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief Same as `shutdown(deadline)` with a relative timeout.
+     */
+    template <typename Rep, typename Period>
+    ShutdownReport shutdown(const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return shutdown(std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout));
+    }
+
+    /**
+     * @brief Immediately shuts down the pool and hands back the jobs it did not run.
+     *
+     * @return The queued jobs that never started, so the caller can persist
+     *         them or re-route them to another pool; empty if not running.
+     *
+     * @details
+     * - Stops accepting new jobs and closes the queue.
+     * - Jobs already running finish; no other job is started from then on.
+     * - Every job still queued (shared queue, worker deques, batches already
+     *   popped by a worker) is returned instead of run or destroyed.
+     * - Except for a running job blocked in a wait (`TaskGroup`, `TaskGraph`,
+     *   `Strand`, `parallelFor`): its thread keeps running the queued jobs of
+     *   that group, graph or strand until the wait completes, so the pool can
+     *   join. Those jobs are not returned; every other job still is.
+     *
+     * Adapted `IJob`s come back as the original objects; callables,
+     * `submit()`ed tasks and guarded `IJob`s come back wrapped in a `TaskJob`,
+     * which still honours the guard when executed. A future whose
+     * task is returned stays pending until that job is run elsewhere, or
+     * completes with `broken_promise` if it is destroyed. Cancelled or
+     * expired guarded jobs are skipped and counted as usual, not returned.
      *
-     * This is the “fail-fast” version of shutdown().
+     * Jobs are returned roughly in queue order per worker, but no global
+     * order is guaranteed. This is the “fail-fast” version of shutdown().
      */
-    void shutdownNow();
+    std::vector<std::unique_ptr<IJob>> shutdownNow();
 
     /**
      * @brief Waits for all worker threads to finish.
@@ -189,6 +554,9 @@ class ThreadPool
 
     /**
      * @brief Returns the number of active worker threads.
+     *
+     * @details
+     * Workers asked to retire count until they actually leave.
      */
     size_t size() const;
 
@@ -199,21 +567,289 @@ class ThreadPool
      */
     bool isRunning() const;
 
+    /**
+     * @brief Returns the number of accepted jobs not yet finished (queued or running).
+     */
+    size_t pending() const;
+
+    /**
+     * @brief Returns a snapshot of the backpressure outcome counters.
+     */
+    BackpressureStats backpressureStats() const;
+
+    /**
+     * @brief Returns per-worker counters and merged latency histograms.
+     *
+     * @details
+     * Every worker records into its own cache-line-isolated slot with plain
+     * relaxed stores; this call only reads those slots, so it never stops
+     * or slows down the workers. The snapshot is therefore not atomic
+     * across workers: a job finishing during the call may be missing.
+     *
+     * Counters are cumulative since construction: slot `i` is reused by
+     * worker `i` of every run, and stays readable after `shutdown()`.
+     */
+    Metrics metrics() const;
+
+    /**
+     * @brief Takes every trace event recorded since the previous collection.
+     *
+     * @details
+     * Requires `ThreadPoolConfig::traceJobs`; otherwise the trace is empty.
+     * Workers keep running: each one records into its own single-producer
+     * ring, and this call is the (only) consumer. Concurrent calls are
+     * serialized. With `ThreadPoolConfig::traceFile` set, `shutdown()`
+     * writes whatever is left to that file.
+     *
+     * Example:
+     * @code
+     * pool.collectTrace().writeFile("run.json");   // open in ui.perfetto.dev
+     * @endcode
+     */
+    JobTrace collectTrace();
+
+    /**
+     * @brief Same as `collectTrace().writeFile(path)`.
+     *
+     * @return `false` if the file could not be written.
+     */
+    bool dumpTrace(const std::string& path);
+
     /******************************************************************/
 
     /* Private Methods */
 
    private:
+    /**
+     * @brief Runs and waits on jobs through the helper API below.
+     */
+    friend class Strand;
+    friend class TaskGraph;
+    friend class TaskGroup;
+
+    /**
+     * @brief Per-worker scheduling state (local deque, RNG...).
+     *
+     * @details
+     * Defined in thread_pool.cpp; only used in `WorkStealing` mode.
+     */
+    struct Worker;
+
+    /**
+     * @brief Per-thread counters and histograms, written only by their thread.
+     *
+     * @details
+     * Defined in thread_pool.cpp; used in every scheduling mode.
+     */
+    struct WorkerStats;
+
     /**
      * @brief Main loop executed by each worker thread.
      *
+     * @param worker_name Name used in log lines.
+     * @param worker      Worker state in `WorkStealing` mode, `nullptr` otherwise.
+     * @param stats       Metrics slot of this thread.
+     *
      * @details
      * Each worker:
-     *  - Blocks on JobQueue::pop()
-     *  - Exits when `nullptr` is returned (queue closed)
+     *  - Blocks on JobQueue::popTask() (or `acquireTask()` when work stealing)
+     *  - Exits when `nullptr` is returned (queue closed) or when it claims a retirement
      *  - Catches exceptions thrown by jobs
      */
-    void threadLoop(const std::string& worker_name);
+    void threadLoop(const std::string& worker_name, Worker* worker, WorkerStats& stats);
+
+    /**
+     * @brief Starts one worker in a free slot (a new one, or one left by a retired worker).
+     *
+     * @pre `resizeMtx` is held and fewer than `targetWorkers` workers are live.
+     */
+    void launchWorker();
+
+    /**
+     * @brief Body of `resize()`.
+     *
+     * @pre `resizeMtx` is held.
+     */
+    void resizeLocked(size_t number_threads);
+
+    /**
+     * @brief Takes one pending retirement for the calling worker, if any.
+     *
+     * @return `true` if the caller must exit.
+     */
+    bool claimRetirement();
+
+    /**
+     * @brief Auto-scaler thread: one `autoScaleStep()` every `scaleInterval`.
+     */
+    void scaleLoop();
+
+    /**
+     * @brief Grows or shrinks the pool from the metrics of the last interval.
+     *
+     * @param previous Metrics at the start of the interval.
+     * @param current  Metrics now.
+     */
+    void autoScaleStep(const Metrics& previous, const Metrics& current);
+
+    /**
+     * @brief Stops and joins the auto-scaler thread, if any.
+     */
+    void stopScaler();
+
+    /**
+     * @brief Binds the calling worker to its NUMA node (`NumaSharded` backend only).
+     *
+     * @param worker_name Name used in log lines.
+     * @param index       Worker index; picks the node when the worker is not pinned.
+     * @param cpu         CPU the worker is pinned to, or -1.
+     */
+    void joinNode(const std::string& worker_name, size_t index, int cpu);
+
+    /**
+     * @brief Finds the next job for a work-stealing worker, parking if idle.
+     *
+     * @details
+     * Search order: own deque (LIFO) → shared queue → random victims (FIFO).
+     * When nothing is found the worker parks until new work is published.
+     *
+     * @param task Receives the next task.
+     * @return `false` once the shared queue is closed and no work is visible
+     *         anywhere, or when the worker claims a retirement.
+     */
+    bool acquireTask(Worker& worker, Task& task);
+
+    /**
+     * @brief Single non-blocking pass over every work source.
+     *
+     * @return `true` if `task` was filled.
+     */
+    bool findWork(Worker& worker, Task& task);
+
+    /**
+     * @brief Returns whether any deque or the shared queue holds work (snapshot).
+     */
+    bool hasVisibleWork() const;
+
+    /**
+     * @brief Wakes one parked work-stealing worker, if any.
+     */
+    void wakeIdleWorker();
+
+    /**
+     * @brief Wakes every parked work-stealing worker.
+     */
+    void wakeAllWorkers();
+
+    /**
+     * @brief Accepts `task` (into the lane of `priority`) subject to the backpressure policy.
+     *
+     * @return `false` if the task was refused (it is destroyed).
+     */
+    bool admit(Task task, JobPriority priority = JobPriority::Normal);
+
+    /**
+     * @brief Claims one of the `maxQueuedJobs` slots without waiting.
+     */
+    bool tryReserveSlot();
+
+    /**
+     * @brief Waits (per `blockTimeout`) until a slot is claimed or the queue closes.
+     */
+    bool waitForSlot();
+
+    /**
+     * @brief Returns `count` slots after tasks left the shared queue, waking blocked producers.
+     */
+    void releaseSlots(size_t count);
+
+    /**
+     * @brief Non-template part of `scheduleEvery()`.
+     */
+    TimerHandle scheduleRepeating(std::chrono::steady_clock::duration period,
+                                  std::unique_ptr<IJob>               job);
+
+    /**
+     * @brief Returns the timer wheel, creating it on first use; `nullptr` if not running.
+     *
+     * @pre `timerMtx` is held.
+     */
+    TimerWheel* timers();
+
+    /**
+     * @brief Stops and destroys the timer wheel, discarding pending timers.
+     */
+    void stopTimers();
+
+    /**
+     * @brief Stamps `task` with the submission time when metrics or traces are collected.
+     */
+    void stamp(Task& task) const;
+
+    /**
+     * @brief Writes the remaining trace to `ThreadPoolConfig::traceFile`, if set.
+     */
+    void writeTraceFile();
+
+    /**
+     * @brief Marks one accepted job as settled, waking `shutdown()` if it was the last.
+     */
+    void finishPending();
+
+    /**
+     * @brief Runs `task` (or discards it once the drain deadline expired)
+     *        and updates the pending / completed counters and `stats` (if any).
+     *
+     * @details
+     * `rescue` is set when a pool thread helps a wait along: the task then
+     * runs even during `shutdownNow()`, instead of being handed back.
+     */
+    void runTask(Task& task, const std::string& worker_name, WorkerStats* stats,
+                 bool rescue = false);
+
+    /**
+     * @brief Runs one pending job on the calling thread, if one is visible.
+     *
+     * @param outstanding Counter the calling thread waits on; during
+     *                    `shutdownNow()` only the jobs settling it still run.
+     * @return `false` if nothing was runnable (or the queue is closed).
+     */
+    bool runPendingTask(const std::atomic<size_t>& outstanding);
+
+    /**
+     * @brief Takes the newest task of `reclaimed` settling `outstanding`, if any.
+     */
+    bool takeReclaimed(Task& task, const std::atomic<size_t>& outstanding);
+
+    /**
+     * @brief Returns whether `reclaimed` holds a task settling `outstanding`.
+     */
+    bool hasReclaimed(const std::atomic<size_t>& outstanding);
+
+    /**
+     * @brief Runs pending jobs on the calling thread until `outstanding` is zero.
+     *
+     * @details
+     * Used by `TaskGroup::wait()`. Blocks (no polling) while nothing is
+     * runnable; woken by `wakeHelpers()`. During `shutdownNow()` a pool
+     * thread keeps running the queued and reclaimed jobs settling
+     * `outstanding` (see `Task::counter()`) until its wait completes, since
+     * nobody else would run them; any other job it finds is handed back.
+     */
+    void helpUntilDone(const std::atomic<size_t>& outstanding);
+
+    /**
+     * @brief Returns whether a helper waiting on `outstanding` could pick up a job (snapshot).
+     */
+    bool helperHasWork(const std::atomic<size_t>& outstanding);
+
+    /**
+     * @brief Wakes threads blocked in `helpUntilDone()`, if any.
+     *
+     * @details
+     * Called after publishing work and by the last job of a `TaskGroup`.
+     */
+    void wakeHelpers();
 
     /******************************************************************/
 
@@ -221,9 +857,19 @@ class ThreadPool
 
    private:
     /**
-     * @brief Shared job queue.
+     * @brief Options the pool was built with.
      */
-    JobQueue queue;
+    const ThreadPoolConfig config;
+
+    /**
+     * @brief Shared job queue (backend selected by `config.queueBackend`).
+     */
+    std::unique_ptr<IJobQueue> queue;
+
+    /**
+     * @brief `queue` when it is a `NumaJobQueue` (`NumaSharded` backend), `nullptr` otherwise.
+     */
+    NumaJobQueue* numaQueue;
 
     /**
      * @brief Indicates whether the pool is in running state.
@@ -231,9 +877,247 @@ class ThreadPool
     std::atomic<bool> running;
 
     /**
-     * @brief Threads.
+     * @brief Threads, one per worker slot (retired ones are joined when their slot is reused).
      */
     std::vector<std::thread> threads;
 
+    /**
+     * @brief Number of live worker threads that have not claimed a retirement.
+     *
+     * @details
+     * Used as the fair-share divisor when workers pop a batch.
+     */
+    std::atomic<size_t> workerCount;
+
+    /**
+     * @brief Work-stealing state, one entry per slot (empty in `SharedQueue` mode).
+     *
+     * @details
+     * Reserved to `slotCapacity` at `start()`, so appending a slot never moves
+     * the entries; other workers only index the first `workerSlots` of them.
+     */
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /**
+     * @brief Entries of `workers` published to thieves.
+     */
+    std::atomic<size_t> workerSlots;
+
+    /**
+     * @brief Worker slots this run may use (`maxThreads` resolved at `start()`).
+     */
+    size_t slotCapacity;
+
+    /**
+     * @brief Whether each slot's thread is running (set by `launchWorker()`, cleared by the thread).
+     */
+    std::unique_ptr<std::atomic<bool>[]> slotBusy;
+
+    /**
+     * @brief Worker count asked by the last `start()` / `resize()` (protected by `resizeMtx`).
+     */
+    size_t targetWorkers;
+
+    /**
+     * @brief Retirements requested by a shrink and not yet claimed by a worker.
+     */
+    std::atomic<size_t> retireRequests;
+
+    /**
+     * @brief CPU of every slot (wrapping), empty when workers are not pinned.
+     */
+    std::vector<int> placement;
+
+    /**
+     * @brief Serializes `start()`, `resize()`, `join()` and the auto-scaler.
+     */
+    mutable std::mutex resizeMtx;
+
+    /**
+     * @brief Auto-scaler thread (only with `autoScale`).
+     */
+    std::thread scaler;
+
+    /**
+     * @brief Asks the auto-scaler to exit (protected by `scalerMtx`).
+     */
+    bool scalerStop;
+
+    /**
+     * @brief Protects `scalerStop`.
+     */
+    std::mutex scalerMtx;
+
+    /**
+     * @brief Wakes the auto-scaler early on shutdown.
+     */
+    std::condition_variable scalerCv;
+
+    /**
+     * @brief Number of work-stealing workers parked (or about to park).
+     */
+    std::atomic<size_t> parkedWorkers;
+
+    /**
+     * @brief Spin phase of idle work-stealing workers before parking.
+     */
+    SpinWait idleSpin;
+
+    /**
+     * @brief Protects the parking handshake of work-stealing workers.
+     */
+    std::mutex parkMtx;
+
+    /**
+     * @brief Parks idle work-stealing workers.
+     */
+    std::condition_variable parkCv;
+
+    /**
+     * @brief Accepted jobs not finished yet (incremented before publishing).
+     */
+    std::atomic<size_t> pendingJobs;
+
+    /**
+     * @brief Jobs run to completion (successfully or by throwing).
+     */
+    std::atomic<size_t> completedJobs;
+
+    /**
+     * @brief Set once `shutdown()` / `shutdownNow()` begins, until the next `start()`.
+     *
+     * @details
+     * Outside submissions are refused from then on; jobs submitted by the
+     * pool's own workers are still accepted, so running jobs can finish.
+     */
+    std::atomic<bool> stopping;
+
+    /**
+     * @brief Set while `shutdown()` waits, so workers only notify when needed.
+     */
+    std::atomic<bool> draining;
+
+    /**
+     * @brief Set when the drain deadline expired: workers discard what they pop.
+     */
+    std::atomic<bool> discardQueued;
+
+    /**
+     * @brief Set by `shutdownNow()`: workers move what they pop into `reclaimed`.
+     */
+    std::atomic<bool> reclaimQueued;
+
+    /**
+     * @brief Protects `reclaimed`.
+     */
+    std::mutex reclaimMtx;
+
+    /**
+     * @brief Tasks popped but not run during `shutdownNow()`.
+     */
+    std::vector<Task> reclaimed;
+
+    /**
+     * @brief Protects the drain handshake.
+     */
+    std::mutex drainMtx;
+
+    /**
+     * @brief Signalled when `pendingJobs` drops to zero while draining.
+     */
+    std::condition_variable drainCv;
+
+    /**
+     * @brief Claimed slots of the shared queue (only tracked when bounded).
+     */
+    std::atomic<size_t> queuedJobs;
+
+    /**
+     * @brief Producers waiting in `waitForSlot()`.
+     */
+    std::atomic<size_t> blockedProducers;
+
+    /**
+     * @brief Protects the blocked-producer handshake.
+     */
+    std::mutex spaceMtx;
+
+    /**
+     * @brief Signalled when a slot is released.
+     */
+    std::condition_variable spaceCv;
+
+    /**
+     * @brief Backpressure outcome counters (see `BackpressureStats`).
+     */
+    std::atomic<size_t> blockedCount;
+    std::atomic<size_t> timedOutCount;
+    std::atomic<size_t> rejectedCount;
+    std::atomic<size_t> droppedOldestCount;
+    std::atomic<size_t> callerRunsCount;
+
+    /**
+     * @brief Guarded jobs skipped at dequeue (see `Metrics::cancelled` / `Metrics::expired`).
+     */
+    std::atomic<size_t> cancelledCount;
+    std::atomic<size_t> expiredCount;
+
+    /**
+     * @brief Metrics slots, indexed like `threads` (kept across runs, never shrunk).
+     */
+    std::vector<std::unique_ptr<WorkerStats>> workerStats;
+
+    /**
+     * @brief When the current run started (`time_point{}` when stopped).
+     */
+    std::chrono::steady_clock::time_point startedAt;
+
+    /**
+     * @brief Running time of previous runs.
+     */
+    std::chrono::nanoseconds retiredUptime;
+
+    /**
+     * @brief Protects `workerStats` and the uptime fields.
+     *
+     * @details
+     * Only `start()`, `join()` and `metrics()` take it; workers hold a
+     * pointer to their own slot and never touch it.
+     */
+    mutable std::mutex metricsMtx;
+
+    /**
+     * @brief Serializes `collectTrace()` (the consumer side of the trace rings).
+     *
+     * @details
+     * Taken before `metricsMtx` when both are needed.
+     */
+    std::mutex traceMtx;
+
+    /**
+     * @brief Threads blocked in `helpUntilDone()` (or about to block).
+     */
+    std::atomic<size_t> waitingHelpers;
+
+    /**
+     * @brief Protects the helper parking handshake.
+     */
+    std::mutex helpMtx;
+
+    /**
+     * @brief Parks helpers that found nothing to run.
+     */
+    std::condition_variable helpCv;
+
+    /**
+     * @brief Delayed / periodic jobs (created by the first `schedule*()` call).
+     */
+    std::unique_ptr<TimerWheel> timerWheel;
+
+    /**
+     * @brief Protects the lazy creation and the stop of `timerWheel`.
+     */
+    std::mutex timerMtx;
+
     /******************************************************************/
 };
\ No newline at end of file
@@ -0,0 +1,283 @@
+/**
+ * @file        thread_pool_config.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Construction-time options for `ThreadPool`.
+ *
+ * @details
+ * A default-constructed `ThreadPoolConfig` reproduces the historical
+ * behaviour of the pool: one unbounded, mutex-protected `JobQueue`.
+ *
+ * Example:
+ * @code
+ * ThreadPoolConfig config;
+ * config.queueBackend  = ThreadPoolConfig::QueueBackend::LockFreeRing;
+ * config.queueCapacity = 4096;
+ *
+ * ThreadPool pool(config);
+ * pool.start(8);
+ * @endcode
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*****************************************************************************/
+
+/**
+ * @struct ThreadPoolConfig
+ * @brief Plain aggregate of ThreadPool tuning knobs.
+ */
+struct ThreadPoolConfig
+{
+    /**
+     * @enum QueueBackend
+     * @brief Selects the implementation of the shared job queue.
+     */
+    enum class QueueBackend
+    {
+        Mutex,        /**< `JobQueue`: unbounded, mutex + condition variable. */
+        LockFreeRing, /**< `RingJobQueue`: bounded lock-free MPMC ring. */
+        NumaSharded   /**< `NumaJobQueue`: one `JobQueue` per NUMA node; workers are
+                           grouped per node and steal across nodes only when idle. */
+    };
+
+    /**
+     * @enum SchedulingMode
+     * @brief Selects how workers find their next job.
+     */
+    enum class SchedulingMode
+    {
+        SharedQueue, /**< Every worker blocks on the shared queue. */
+        WorkStealing /**< Per-worker Chase-Lev deques + stealing; the shared
+                          queue only receives jobs submitted from outside. */
+    };
+
+    /**
+     * @enum OverflowPolicy
+     * @brief What a submission does when the shared queue holds `maxQueuedJobs`.
+     */
+    enum class OverflowPolicy
+    {
+        Block,      /**< Wait for room (up to `blockTimeout`), then reject. */
+        Reject,     /**< Refuse the new job immediately. */
+        DropOldest, /**< Discard the oldest job of the lowest priority lane (none: as Block). */
+        CallerRuns  /**< Run the new job on the submitting thread. */
+    };
+
+    /**
+     * @enum CpuPlacement
+     * @brief How worker threads are pinned to CPUs (see `CpuTopology`).
+     */
+    enum class CpuPlacement
+    {
+        None,    /**< No pinning: the OS schedules workers freely. */
+        Compact, /**< Fill hyper-threads of a core, then cores, then packages. */
+        Scatter, /**< One CPU per core, alternating packages, before any sibling. */
+        Explicit /**< Worker `i` runs on `cpuList[i % cpuList.size()]`. */
+    };
+
+    /**
+     * @brief Shared queue implementation.
+     */
+    QueueBackend queueBackend = QueueBackend::Mutex;
+
+    /**
+     * @brief Capacity of bounded backends (rounded up to a power of two).
+     *
+     * @details
+     * Ignored by the `Mutex` and `NumaSharded` backends.
+     */
+    size_t queueCapacity = 1024;
+
+    /**
+     * @brief Aging threshold of the priority lanes (0 = strict priority).
+     *
+     * @details
+     * A queued lower-priority job is served after its lane has been passed
+     * over this many times by higher lanes. The `Mutex` and `NumaSharded`
+     * backends have priority lanes (per node); the ring keeps FIFO order.
+     */
+    size_t priorityAging = 0;
+
+    /**
+     * @brief Worker scheduling strategy.
+     */
+    SchedulingMode schedulingMode = SchedulingMode::SharedQueue;
+
+    /**
+     * @brief Most tasks a worker takes from the shared queue at once (1 = no batching, default).
+     *
+     * @details
+     * The batch is popped under a single lock and run before the worker
+     * touches the shared queue again. A worker never takes more than its fair
+     * share of the backlog (`size / workers + 1`), so batching does not starve
+     * idle workers. In `WorkStealing` mode the extra tasks go to the worker's
+     * deque, where thieves can still reach them.
+     */
+    size_t workerBatchSize = 1;
+
+    /**
+     * @brief Maximum number of jobs waiting in the shared queue (0 = unbounded).
+     *
+     * @details
+     * Applies to submissions from outside the pool. Jobs submitted by the
+     * pool's own workers (spawned work, continuations) are never blocked or
+     * dropped, so they may exceed the bound slightly instead of deadlocking.
+     */
+    size_t maxQueuedJobs = 0;
+
+    /**
+     * @brief Backpressure policy used once `maxQueuedJobs` is reached.
+     */
+    OverflowPolicy overflowPolicy = OverflowPolicy::Block;
+
+    /**
+     * @brief Longest wait of the `Block` policy (0 = wait as long as needed).
+     */
+    std::chrono::milliseconds blockTimeout{0};
+
+    /**
+     * @brief Whether workers time every job for `ThreadPool::metrics()`.
+     *
+     * @details
+     * Costs one clock read at submission and two per executed job, so it is
+     * off by default. When disabled, `metrics()` still reports the
+     * per-worker counters but the latency histograms stay empty.
+     */
+    bool collectMetrics = false;
+
+    /**
+     * @brief Whether workers record a trace event for every job (see `ThreadPool::collectTrace()`).
+     */
+    bool traceJobs = false;
+
+    /**
+     * @brief Events each worker can buffer between two trace collections.
+     *
+     * @details
+     * Events recorded while a worker's buffer is full are dropped and
+     * counted in the trace's `dropped_events`.
+     */
+    size_t traceCapacity = 16384;
+
+    /**
+     * @brief File the trace is written to at shutdown (empty = none).
+     */
+    std::string traceFile;
+
+    /**
+     * @brief Worker pinning policy.
+     *
+     * @details
+     * `Compact` and `Scatter` order the CPUs read from
+     * `/sys/devices/system/cpu`; with more workers than CPUs the order wraps
+     * around. A worker that cannot be pinned logs a warning and runs unpinned.
+     * Pinning is only implemented on Linux.
+     *
+     * With the `NumaSharded` backend and `None`, worker `i` is restricted to
+     * the CPUs of node `i % nodes`; with another policy, each worker serves
+     * the node of the CPU it is pinned to.
+     */
+    CpuPlacement cpuPlacement = CpuPlacement::None;
+
+    /**
+     * @brief CPU numbers of the `Explicit` policy.
+     */
+    std::vector<int> cpuList;
+
+    /**
+     * @brief Restricts `Compact` / `Scatter` to one package (socket) id (-1 = all).
+     */
+    int cpuPackage = -1;
+
+    /**
+     * @brief Restricts `Compact` / `Scatter` to one hyper-thread per physical core.
+     */
+    bool physicalCoresOnly = false;
+
+    /**
+     * @brief Resolution of the timer wheel behind `scheduleAfter()` / `scheduleAt()` / `scheduleEvery()`.
+     */
+    std::chrono::milliseconds timerTick{1};
+
+    /**
+     * @brief Upper bound of `resize()` and of the auto-scaler (0 = `hardware_concurrency()`).
+     *
+     * @details
+     * Never below the `start()` count. The slots are reserved when the pool
+     * starts, so growing never moves state other workers are reading.
+     */
+    size_t maxThreads = 0;
+
+    /**
+     * @brief Whether a supervisor thread resizes the pool between `minThreads` and `maxThreads`.
+     *
+     * @details
+     * Every `scaleInterval` it:
+     *  - adds one worker if the p90 queue wait of the jobs started during the
+     *    interval exceeded `targetQueueWait`, or, with no sample, if jobs are
+     *    queued but none finished;
+     *  - otherwise retires the workers idle for at least `keepAlive`, down to
+     *    `minThreads`.
+     * Queue wait is only measured with `collectMetrics`.
+     */
+    bool autoScale = false;
+
+    /**
+     * @brief Fewest workers the auto-scaler keeps (at least 1).
+     */
+    size_t minThreads = 1;
+
+    /**
+     * @brief Queue wait (p90) above which the auto-scaler adds a worker.
+     */
+    std::chrono::microseconds targetQueueWait{1000};
+
+    /**
+     * @brief Idle time after which the auto-scaler retires a worker.
+     */
+    std::chrono::milliseconds keepAlive{30000};
+
+    /**
+     * @brief Period of the auto-scaler.
+     */
+    std::chrono::milliseconds scaleInterval{100};
+
+    /**
+     * @brief Pause iterations an idle worker spins at most before yielding and parking (0 = none).
+     *
+     * @details
+     * Catching a job while spinning saves the futex sleep and wake-up of a
+     * parked worker; producers only wake a parked worker when no spinner can
+     * take the job. On a single-CPU host spinning would only delay the
+     * producer, so the pool never spins there (`idleYields` still applies).
+     * Spinning burns CPU while the pool is idle, so it is opt-in: by default
+     * an idle worker parks right away.
+     */
+    size_t idleSpinLimit = 0;
+
+    /**
+     * @brief `std::this_thread::yield()` calls between spinning and parking.
+     */
+    size_t idleYields = 0;
+
+    /**
+     * @brief Whether the spin count adapts, up to `idleSpinLimit`, to how long workers wait.
+     */
+    bool idleSpinAdaptive = true;
+};
@@ -0,0 +1,327 @@
+/**
+ * @file        timer_wheel.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief       Hierarchical timing wheel handing due tasks to an executor.
+ *
+ * @details
+ * Timers live in 4 levels of 64 slots. Level 0 slots are one tick wide,
+ * level `n` slots are `64^n` ticks wide. Inserting a timer picks its level
+ * from the distance to its expiry and links it into one slot: O(1). Each
+ * tick expires one level-0 slot; every 64 ticks one slot of the level above
+ * is cascaded down. Timers further away than the top level can represent
+ * park in its farthest slot and are re-inserted when it comes around.
+ *
+ * A dedicated thread drives the wheel. It sleeps until the next occupied
+ * level-0 tick (or the next cascade) and then dispatches due tasks to the
+ * `IExecutor` outside the wheel lock, so a job never occupies a worker
+ * while it waits for its time.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "i_executor.h"
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @brief State shared between a scheduled timer and its `TimerHandle`.
+ */
+struct TimerState
+{
+    std::atomic<bool> cancelled{false}; /**< Set by `TimerHandle::cancel()`. */
+    std::atomic<bool> inFlight{false};  /**< A periodic run is queued or running. */
+    Task              body;             /**< Periodic timers: the task run every period. */
+};
+
+/**
+ * @class TimerHandle
+ * @brief Lets the owner of a scheduled timer cancel it.
+ *
+ * @details
+ * A default-constructed (or refused) handle is not valid. Cancelling is
+ * lazy: the timer is unlinked when its slot comes around, without running.
+ */
+class TimerHandle
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Builds an invalid handle.
+     */
+    TimerHandle() = default;
+
+    /**
+     * @brief Wraps the state of a scheduled timer.
+     */
+    explicit TimerHandle(std::shared_ptr<TimerState> state) : state(std::move(state)) {}
+
+    /**
+     * @brief Prevents any future run of the timer. Runs already dispatched are not affected.
+     */
+    void cancel()
+    {
+        if (state)
+            state->cancelled.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns whether the handle refers to a scheduled timer.
+     */
+    bool valid() const { return state != nullptr; }
+
+    /**
+     * @brief Returns whether `cancel()` was called.
+     */
+    bool cancelled() const { return state && state->cancelled.load(std::memory_order_acquire); }
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Shared timer state (null for an invalid handle).
+     */
+    std::shared_ptr<TimerState> state;
+
+    /******************************************************************/
+};
+
+/**
+ * @class TimerWheel
+ * @brief Delayed and periodic task scheduling with O(1) insert and expiry.
+ */
+class TimerWheel
+{
+    /******************************************************************/
+
+    /* Public Types */
+
+   public:
+    /**
+     * @brief Clock every deadline is expressed in.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Starts the timer thread.
+     *
+     * @param executor Receives every due task (must outlive the wheel).
+     * @param tick     Wheel resolution; timers fire at most one tick late.
+     */
+    explicit TimerWheel(IExecutor&                executor,
+                        std::chrono::milliseconds tick = std::chrono::milliseconds(1));
+
+    /**
+     * @brief Stops the timer thread; pending timers are discarded.
+     */
+    ~TimerWheel();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    TimerWheel(const TimerWheel&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Dispatches `task` once `when` is reached.
+     *
+     * @return Handle to cancel the timer; invalid if the wheel is stopped.
+     */
+    TimerHandle scheduleAt(Clock::time_point when, Task task);
+
+    /**
+     * @brief Dispatches `task` every `period`, starting one period from now.
+     *
+     * @return Handle to cancel the timer; invalid if the wheel is stopped.
+     *
+     * @details
+     * A period is skipped if the previous run is still queued or running,
+     * so a slow job never piles up copies of itself.
+     */
+    TimerHandle scheduleEvery(Clock::duration period, Task task);
+
+    /**
+     * @brief Stops the timer thread and discards every pending timer. Idempotent.
+     */
+    void stop();
+
+    /**
+     * @brief Returns the number of armed timers (including cancelled ones not yet reaped).
+     */
+    size_t size() const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief One armed timer, linked into a wheel slot.
+     */
+    struct Node;
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Timer thread: advances the wheel and dispatches due tasks.
+     */
+    void run();
+
+    /**
+     * @brief Arms `node` (expiry already set). Requires `mtx`.
+     */
+    TimerHandle arm(Node* node, std::shared_ptr<TimerState> state);
+
+    /**
+     * @brief Links `node` into the slot matching its distance to `now`. Requires `mtx`.
+     */
+    void insert(Node* node);
+
+    /**
+     * @brief Moves the clock one tick and collects what expired. Requires `mtx`.
+     */
+    void advance(std::vector<Task>& due);
+
+    /**
+     * @brief Re-inserts the current slot of `level` into lower levels. Requires `mtx`.
+     */
+    void cascade(size_t level);
+
+    /**
+     * @brief Next tick at which the wheel has something to do. Requires `mtx`.
+     */
+    uint64_t nextEventTick() const;
+
+    /**
+     * @brief Tick index of `time` (rounded down).
+     */
+    uint64_t tickOf(Clock::time_point time) const;
+
+    /**
+     * @brief Number of ticks covering `duration` (rounded up, at least 1).
+     */
+    uint64_t ticksIn(Clock::duration duration) const;
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Bits of slot index per level.
+     */
+    static constexpr size_t kSlotBits = 6;
+
+    /**
+     * @brief Slots per level.
+     */
+    static constexpr size_t kSlots = size_t(1) << kSlotBits;
+
+    /**
+     * @brief Number of levels.
+     */
+    static constexpr size_t kLevels = 4;
+
+    /**
+     * @brief Receives due tasks.
+     */
+    IExecutor& executor;
+
+    /**
+     * @brief Wheel resolution.
+     */
+    const Clock::duration tick;
+
+    /**
+     * @brief Time of tick 0.
+     */
+    const Clock::time_point origin;
+
+    /**
+     * @brief Protects every field below.
+     */
+    mutable std::mutex mtx;
+
+    /**
+     * @brief Wakes the timer thread (new earlier timer or stop).
+     */
+    std::condition_variable cv;
+
+    /**
+     * @brief Timer slots, `slots[level][index]` is a singly linked list.
+     */
+    std::array<std::array<Node*, kSlots>, kLevels> slots;
+
+    /**
+     * @brief Bit `i` set when level-0 slot `i` is not empty.
+     */
+    uint64_t level0Occupied;
+
+    /**
+     * @brief Last tick processed.
+     */
+    uint64_t now;
+
+    /**
+     * @brief Tick the timer thread is sleeping until (`UINT64_MAX` when idle).
+     */
+    uint64_t wakeTick;
+
+    /**
+     * @brief Number of linked nodes.
+     */
+    size_t armed;
+
+    /**
+     * @brief Set by `stop()`.
+     */
+    bool stopping;
+
+    /**
+     * @brief Timer thread.
+     */
+    std::thread worker;
+
+    /******************************************************************/
+};
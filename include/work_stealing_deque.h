@@ -0,0 +1,189 @@
+/**
+ * @file        work_stealing_deque.h
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Chase-Lev work-stealing deque of boxed `Task`s.
+ *
+ * @details
+ * Each worker of a work-stealing `ThreadPool` owns one deque:
+ *  - The **owner** pushes and pops at the bottom (LIFO, cache-friendly).
+ *  - **Thieves** steal from the top (FIFO, oldest work first).
+ *
+ * Only the owner ever writes `bottom`, so `push()` and the common case of
+ * `pop()` are plain loads/stores. A CAS on `top` is needed only when a thief
+ * and the owner race for the last element, or between thieves.
+ *
+ * Slots hold `Task*` rather than `Task` values: a thief reads its slot
+ * before winning the CAS on `top`, which is only race-free for something
+ * that can be loaded atomically. Local pushes therefore box the Task.
+ *
+ * The circular buffer grows when full. Old buffers are retired (kept alive
+ * until the deque is destroyed) because a thief may still be reading them.
+ *
+ * Reference: Lê, Pop, Cohen, Zappa Nardelli — "Correct and Efficient
+ * Work-Stealing for Weak Memory Models" (PPoPP 2013).
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#pragma once
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* Project libraries */
+
+#include "cache_line.h"
+#include "task.h"
+
+/*****************************************************************************/
+
+/**
+ * @class WorkStealingDeque
+ * @brief Single-owner, multi-thief deque holding owning `Task*` pointers.
+ *
+ * @details
+ * Ownership of a job is transferred into the deque by `push()` and back out
+ * by `pop()` / `steal()`. Jobs still stored when the deque is destroyed are
+ * deleted.
+ */
+class WorkStealingDeque
+{
+    /******************************************************************/
+
+    /* Public Methods */
+
+   public:
+    /**
+     * @brief Constructs an empty deque.
+     *
+     * @param initial_capacity Initial buffer size (rounded up to a power of two).
+     */
+    explicit WorkStealingDeque(size_t initial_capacity = 64);
+
+    /**
+     * @brief Deletes any job left in the deque.
+     */
+    ~WorkStealingDeque();
+
+    /**
+     * @brief Disable copy constructor.
+     */
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Disable copy assignment operator.
+     */
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Pushes a job at the bottom. Owner thread only.
+     *
+     * @param job Owning pointer (must be non-null).
+     */
+    void push(Task* job);
+
+    /**
+     * @brief Pushes `count` jobs at the bottom, in order, publishing them at once. Owner only.
+     *
+     * @param jobs  Owning pointers (non-null); `jobs[count - 1]` ends up at the bottom.
+     * @param count Number of jobs.
+     */
+    void push(Task* const* jobs, size_t count);
+
+    /**
+     * @brief Pops the most recently pushed job. Owner thread only.
+     *
+     * @return The job, or `nullptr` if the deque is empty.
+     */
+    Task* pop();
+
+    /**
+     * @brief Steals the oldest job. Any thread.
+     *
+     * @return The job, or `nullptr` if the deque is empty or the race was lost.
+     */
+    Task* steal();
+
+    /**
+     * @brief Returns an approximate number of stored jobs (snapshot).
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns whether the deque looks empty (snapshot).
+     */
+    bool empty() const;
+
+    /******************************************************************/
+
+    /* Private Types */
+
+   private:
+    /**
+     * @brief Power-of-two circular buffer of atomic slots.
+     */
+    struct Buffer
+    {
+        explicit Buffer(int64_t capacity);
+
+        Task* get(int64_t index) const;
+        void  put(int64_t index, Task* job);
+
+        const int64_t                    capacity;
+        const int64_t                    mask;
+        std::unique_ptr<std::atomic<Task*>[]> slots;
+    };
+
+    /******************************************************************/
+
+    /* Private Methods */
+
+   private:
+    /**
+     * @brief Doubles the buffer, copying live elements `[top, bottom)`.
+     */
+    Buffer* grow(Buffer* old, int64_t bottom_index, int64_t top_index);
+
+    /******************************************************************/
+
+    /* Private Attributes */
+
+   private:
+    /**
+     * @brief Steal end, written by thieves (CAS) and by the owner on the last element.
+     */
+    std::atomic<int64_t> top;
+
+    /**
+     * @brief Keeps `top` and `bottom` on separate cache lines.
+     */
+    char pad[kCacheLineSize - sizeof(std::atomic<int64_t>)];
+
+    /**
+     * @brief Owner end, written only by the owner.
+     */
+    std::atomic<int64_t> bottom;
+
+    /**
+     * @brief Current buffer.
+     */
+    std::atomic<Buffer*> buffer;
+
+    /**
+     * @brief Every buffer ever allocated (current one included). Owner only.
+     */
+    std::vector<std::unique_ptr<Buffer>> buffers;
+
+    /******************************************************************/
+};
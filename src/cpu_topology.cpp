@@ -0,0 +1,359 @@
+/**
+ * @file        cpu_topology.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of CpuTopology (sysfs parsing, placement orders, pinning).
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/* Project libraries */
+
+#include "cpu_topology.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Reads the first line of `path`; false if it cannot be read.
+ */
+bool readLine(const std::string& path, std::string& line)
+{
+    std::ifstream file(path);
+    return static_cast<bool>(std::getline(file, line));
+}
+
+/**
+ * @brief Reads an integer file, or returns `fallback`.
+ */
+int readInt(const std::string& path, int fallback)
+{
+    std::string line;
+    if (!readLine(path, line))
+        return fallback;
+    try
+    {
+        return std::stoi(line);
+    }
+    catch (const std::exception&)
+    {
+        return fallback;
+    }
+}
+
+/**
+ * @brief Position of a CPU in the placement orders.
+ */
+struct Rank
+{
+    int    cpu;
+    size_t package; /**< Index of its package among the packages. */
+    size_t core;    /**< Index of its core within the package. */
+    size_t sibling; /**< Index among the hyper-threads of its core. */
+};
+
+/**
+ * @brief Ranks every CPU of `cpus` by package, core and sibling.
+ */
+std::vector<Rank> rank(const std::vector<CpuInfo>& cpus)
+{
+    // Ordered by (package, core id); CPUs within a core stay in ascending order.
+    std::map<std::pair<int, int>, std::vector<int>> cores;
+    for (const auto& info : cpus)
+        cores[{info.package, info.core}].push_back(info.cpu);
+
+    std::vector<Rank> ranks;
+    ranks.reserve(cpus.size());
+
+    size_t packageIndex = 0;
+    size_t coreIndex    = 0;
+    int    lastPackage  = cores.empty() ? 0 : cores.begin()->first.first;
+    for (const auto& entry : cores)
+    {
+        if (entry.first.first != lastPackage)
+        {
+            lastPackage = entry.first.first;
+            ++packageIndex;
+            coreIndex = 0;
+        }
+        for (size_t sibling = 0; sibling < entry.second.size(); ++sibling)
+            ranks.push_back(Rank{entry.second[sibling], packageIndex, coreIndex, sibling});
+        ++coreIndex;
+    }
+    return ranks;
+}
+
+/**
+ * @brief CPU numbers of `ranks` sorted by `key`.
+ */
+template <typename Key>
+std::vector<int> orderBy(std::vector<Rank> ranks, Key key)
+{
+    std::stable_sort(ranks.begin(), ranks.end(),
+                     [&key](const Rank& a, const Rank& b) { return key(a) < key(b); });
+
+    std::vector<int> order;
+    order.reserve(ranks.size());
+    for (const auto& r : ranks)
+        order.push_back(r.cpu);
+    return order;
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Stores the CPUs sorted by number.
+ */
+CpuTopology::CpuTopology(std::vector<CpuInfo> cpus) : list(std::move(cpus))
+{
+    std::sort(list.begin(), list.end(),
+              [](const CpuInfo& a, const CpuInfo& b) { return a.cpu < b.cpu; });
+}
+
+/**
+ * @brief Reads `online`, the per-CPU topology files and the node CPU lists, with flat fallbacks.
+ */
+CpuTopology CpuTopology::detect(const std::string& sysfsRoot, const std::string& nodeRoot)
+{
+    std::string      line;
+    std::vector<int> online;
+    if (readLine(sysfsRoot + "/online", line) || readLine(sysfsRoot + "/possible", line))
+        online = parseCpuList(line);
+
+    std::vector<CpuInfo> cpus;
+    if (online.empty())
+    {
+        const unsigned count = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned cpu = 0; cpu < count; ++cpu)
+            cpus.push_back(CpuInfo{static_cast<int>(cpu), static_cast<int>(cpu), 0});
+    }
+    else
+    {
+        for (int cpu : online)
+        {
+            const std::string dir = sysfsRoot + "/cpu" + std::to_string(cpu) + "/topology/";
+            cpus.push_back(CpuInfo{cpu, readInt(dir + "core_id", cpu),
+                                   readInt(dir + "physical_package_id", 0)});
+        }
+    }
+
+    if (readLine(nodeRoot + "/online", line) || readLine(nodeRoot + "/possible", line))
+    {
+        for (int node : parseCpuList(line))
+        {
+            std::string cpulist;
+            if (!readLine(nodeRoot + "/node" + std::to_string(node) + "/cpulist", cpulist))
+                continue;
+            for (int cpu : parseCpuList(cpulist))
+                for (auto& info : cpus)
+                    if (info.cpu == cpu)
+                        info.node = node;
+        }
+    }
+    return CpuTopology(std::move(cpus));
+}
+
+/**
+ * @brief Splits on commas, expands `a-b` ranges, sorts and deduplicates.
+ */
+std::vector<int> CpuTopology::parseCpuList(const std::string& list)
+{
+    std::vector<int>   cpus;
+    std::istringstream in(list);
+    std::string        item;
+
+    while (std::getline(in, item, ','))
+    {
+        try
+        {
+            const size_t dash  = item.find('-');
+            const int    first = std::stoi(item.substr(0, dash));
+            const int    last  = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+            for (int cpu = first; cpu <= last && cpu >= 0; ++cpu)
+                cpus.push_back(cpu);
+        }
+        catch (const std::exception&)
+        {
+            // Skip malformed items (empty, non-numeric).
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+/**
+ * @brief Sets a single-CPU affinity mask on the calling thread.
+ */
+bool CpuTopology::pinCurrentThread(int cpu)
+{
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+        return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/**
+ * @brief Sets an affinity mask of every CPU in `cpus` on the calling thread.
+ */
+bool CpuTopology::pinCurrentThread(const std::vector<int>& cpus)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    bool any = false;
+    for (int cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+            any = true;
+        }
+    }
+    return any && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+/**
+ * @brief Asks the scheduler where the calling thread runs.
+ */
+int CpuTopology::currentCpu()
+{
+#if defined(__linux__)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Collects the package ids.
+ */
+std::vector<int> CpuTopology::packages() const
+{
+    std::vector<int> ids;
+    for (const auto& info : list)
+        ids.push_back(info.package);
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+/**
+ * @brief Collects the node ids.
+ */
+std::vector<int> CpuTopology::nodes() const
+{
+    std::vector<int> ids;
+    for (const auto& info : list)
+        ids.push_back(info.node);
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+/**
+ * @brief Keeps the CPUs of node `id`.
+ */
+CpuTopology CpuTopology::onNode(int id) const
+{
+    std::vector<CpuInfo> kept;
+    for (const auto& info : list)
+        if (info.node == id)
+            kept.push_back(info);
+    return CpuTopology(std::move(kept));
+}
+
+/**
+ * @brief Lists the CPU numbers.
+ */
+std::vector<int> CpuTopology::cpuNumbers() const
+{
+    std::vector<int> numbers;
+    for (const auto& info : list)
+        numbers.push_back(info.cpu);
+    return numbers;
+}
+
+/**
+ * @brief Keeps the CPUs of package `id`.
+ */
+CpuTopology CpuTopology::onPackage(int id) const
+{
+    std::vector<CpuInfo> kept;
+    for (const auto& info : list)
+        if (info.package == id)
+            kept.push_back(info);
+    return CpuTopology(std::move(kept));
+}
+
+/**
+ * @brief Keeps the first CPU seen for every (package, core).
+ */
+CpuTopology CpuTopology::physicalCores() const
+{
+    std::vector<CpuInfo> kept;
+    for (const auto& r : rank(list))
+    {
+        if (r.sibling == 0)
+        {
+            auto info = std::find_if(list.begin(), list.end(),
+                                     [&r](const CpuInfo& c) { return c.cpu == r.cpu; });
+            kept.push_back(*info);
+        }
+    }
+    return CpuTopology(std::move(kept));
+}
+
+/**
+ * @brief Orders by (package, core, sibling).
+ */
+std::vector<int> CpuTopology::compactOrder() const
+{
+    return orderBy(rank(list),
+                   [](const Rank& r) { return std::make_tuple(r.package, r.core, r.sibling); });
+}
+
+/**
+ * @brief Orders by (sibling, core, package).
+ */
+std::vector<int> CpuTopology::scatterOrder() const
+{
+    return orderBy(rank(list),
+                   [](const Rank& r) { return std::make_tuple(r.sibling, r.core, r.package); });
+}
@@ -14,7 +14,14 @@
  * - Safe concurrent access through `std::mutex`.
  * - Blocking pop with condition variable.
  * - Deterministic shutdown: waiting consumers wake up and return nullptr.
- * - Ownership is transferred using `std::unique_ptr<IJob>`.
+ * - Ownership is transferred using `Task` (callables or adapted `IJob`s).
+ * - One FIFO lane per `JobPriority`, selected through a bitmap of non-empty
+ *   lanes, with optional aging against starvation.
+ * - Optional spin-then-block consumers: `queued` can be read without the
+ *   lock, so an idle consumer spins on it before taking `mtx` and blocking.
+ *   A producer skips the notification while the spinning consumers
+ *   outnumber the queued tasks; a spinner that gives up re-checks under
+ *   `mtx`, so it never misses a task pushed while it was spinning.
  */
 
 /*****************************************************************************/
@@ -29,34 +36,89 @@
 
 /*****************************************************************************/
 
+/* Helpers */
+
+namespace
+{
+static_assert(kPriorityLevels <= 4, "firstLane() table covers 4 lanes");
+
+/**
+ * @brief Index of the lowest set bit of a non-zero 4-bit lane mask (highest priority lane).
+ */
+size_t firstLane(unsigned mask)
+{
+    static const unsigned char kFirstSet[16] = {0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0};
+    return kFirstSet[mask & 0xFu];
+}
+
+/**
+ * @brief Index of the highest set bit of a non-zero 4-bit lane mask (lowest priority lane).
+ */
+size_t lastLane(unsigned mask)
+{
+    static const unsigned char kLastSet[16] = {0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3};
+    return kLastSet[mask & 0xFu];
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Creates an empty, open queue.
+ *
+ * @param aging_threshold Times a non-empty lane may be passed over before it
+ *                        is served ahead of higher lanes (0 = strict priority).
+ * @param spin_policy     Spin phase of idle consumers before blocking.
+ */
+JobQueue::JobQueue(size_t aging_threshold, const SpinPolicy& spin_policy)
+    : agingThreshold(aging_threshold), spin(spin_policy)
+{
+}
+
 /**
- * @brief Inserts a job into the queue and wakes one waiting consumer.
+ * @brief Inserts a task into the `Normal` lane and wakes one waiting consumer.
  *
- * @param job A non-null unique_ptr owning the job to insert.
+ * @param task A non-empty task (callable or adapted job).
  *
  * @details
  * ### Concurrency:
  * - Acquires `mtx` exclusively.
- * - Appends the job to the FIFO buffer.
+ * - Appends the task to the `Normal` lane.
  * - Calls `notify_one()` to wake exactly one thread blocked in `pop()`.
  *
  * ### Notes:
  * - There is no rejection of jobs after shutdown; the thread pool
  *   is responsible for preventing enqueue after close.
  */
-void JobQueue::push(std::unique_ptr<IJob> job)
+void JobQueue::pushTask(Task task)
+{
+    pushPriorityTask(std::move(task), JobPriority::Normal);
+}
+
+/**
+ * @brief Inserts a task into the lane of `priority` and wakes one waiting consumer.
+ *
+ * @param task     A non-empty task.
+ * @param priority Lane the task is appended to.
+ */
+void JobQueue::pushPriorityTask(Task task, JobPriority priority)
 {
     std::unique_lock<std::mutex> lock(mtx);
-    buffer.emplace_back(std::move(job));
-    cv.notify_one();
+    pushLocked(std::move(task), laneOf(priority));
+    if (mustNotifyLocked())
+        cv.notify_one();
 }
 
 /**
- * @brief Retrieves the next available job, blocking if necessary.
+ * @brief Retrieves the next available task, blocking if necessary.
+ *
+ * @param task Receives the next task.
  *
  * @return
- * - A `std::unique_ptr<IJob>` containing the next job.
- * - `nullptr` if the queue is closed AND empty.
+ * - `true` with the next task moved into `task`.
+ * - `false` if the queue is closed AND empty.
  *
  * @details
  * ### Blocking behaviour:
@@ -67,57 +129,179 @@ void JobQueue::push(std::unique_ptr<IJob> job)
  *
  * ### Shutdown semantics:
  * - If `closed == true` and there are no jobs remaining,
- *   this function returns `nullptr` immediately.
+ *   this function returns `false` immediately.
+ * - A caller that finds no job but a pending `interrupt()` consumes it and
+ *   returns `false` as well.
  *
  * ### Concurrency:
- * - `buffer` is protected by `mtx`.
- * - Uses a condition-variable predicate (`closed || !buffer.empty()`),
+ * - The lanes are protected by `mtx`.
+ * - Uses a condition-variable predicate (`closed || queued > 0`),
  *   which prevents spurious wakeups causing incorrect behaviour.
  */
-std::unique_ptr<IJob> JobQueue::pop()
+bool JobQueue::popTask(Task& task)
 {
-    std::unique_lock<std::mutex> lock(mtx);
-    std::unique_ptr<IJob>        data;
+    std::unique_lock<std::mutex> lock = waitLocked();
+
+    if (queued == 0)
+    {
+        if (interrupts > 0)
+            --interrupts;
+        return false;
+    }
+
+    LOG_DEBUG("[Queue Job] Job extracted successfully");
+    popLocked(task);
+    return true;
+}
+
+/**
+ * @brief Retrieves the next available task without blocking.
+ *
+ * @param task Receives the next task.
+ * @return `false` if the queue is empty.
+ *
+ * @details
+ * Used by schedulers that poll several sources (e.g. work-stealing workers)
+ * and park on their own synchronization primitive.
+ */
+bool JobQueue::tryPopTask(Task& task)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (queued == 0)
+        return false;
+
+    popLocked(task);
+    return true;
+}
+
+/**
+ * @brief Retrieves the task to drop on overflow without blocking.
+ *
+ * @param task Receives the oldest task of the lowest-priority non-empty lane.
+ * @return `false` if the queue is empty.
+ *
+ * @details
+ * Taken outside the aging rotation: dropping a task is not serving it.
+ */
+bool JobQueue::tryPopVictim(Task& task)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (queued == 0)
+        return false;
+
+    const size_t lane = lastLane(nonEmptyLanes);
+    task              = std::move(lanes[lane].front());
+    lanes[lane].pop_front();
+    --queued;
+
+    if (lanes[lane].empty())
+        nonEmptyLanes &= ~(1u << lane);
+    return true;
+}
+
+/**
+ * @brief Appends a batch of tasks with one lock and one notification.
+ *
+ * @param tasks Array of non-empty tasks, moved from.
+ * @param count Number of tasks.
+ *
+ * @details
+ * A single task wakes one consumer, exactly like `pushTask()`. A larger batch
+ * wakes every waiting consumer: each of them takes its fair share through
+ * `popTasks()`, so nobody is woken for nothing in the common case.
+ */
+void JobQueue::pushTasks(Task* tasks, size_t count)
+{
+    if (count == 0)
+        return;
+
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (size_t i = 0; i < count; ++i)
+            pushLocked(std::move(tasks[i]), laneOf(JobPriority::Normal));
+        notify = mustNotifyLocked();
+    }
+
+    if (!notify)
+        return;
+    if (count == 1)
+        cv.notify_one();
+    else
+        cv.notify_all();
+}
+
+/**
+ * @brief Pops a batch of tasks, blocking until at least one is available.
+ *
+ * @param out       Receives the tasks, oldest first.
+ * @param max_count Capacity of `out`.
+ * @param consumers Number of threads sharing the queue.
+ * @return Number of tasks popped; `0` once the queue is closed and drained, or
+ *         for a pending `interrupt()` with nothing to take.
+ */
+size_t JobQueue::popTasks(Task* out, size_t max_count, size_t consumers)
+{
+    if (max_count == 0)
+        return 0;
 
-    // Wait until new data is added
-    cv.wait(lock, [this] { return closed || !buffer.empty(); });
+    std::unique_lock<std::mutex> lock = waitLocked();
 
-    if (closed && buffer.empty())
-        return data;
+    if (queued == 0)
+    {
+        if (interrupts > 0)
+            --interrupts;
+        return 0;
+    }
 
-    Logger::info("[Queue Job] Job extracted successfully");
-    data = std::move(buffer.front());
-    buffer.pop_front();
-    return data;
+    return takeLocked(out, max_count, consumers);
+}
+
+/**
+ * @brief Pops a batch of tasks without blocking.
+ *
+ * @param out       Receives the tasks, oldest first.
+ * @param max_count Capacity of `out`.
+ * @param consumers Number of threads sharing the queue.
+ * @return Number of tasks popped; `0` if the queue is empty.
+ */
+size_t JobQueue::tryPopTasks(Task* out, size_t max_count, size_t consumers)
+{
+    if (max_count == 0)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (queued == 0)
+        return 0;
+
+    return takeLocked(out, max_count, consumers);
 }
 
 /**
  * @brief Returns whether the queue is empty.
  *
  * @details
- * - Non-blocking.
- * - Requires acquiring `mtx` briefly.
+ * - Non-blocking and lock-free (reads the atomic task count).
  *
  * @warning
  * The result is only a snapshot; another thread may enqueue immediately after.
  */
 bool JobQueue::empty() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    return buffer.empty();
+    return queued == 0;
 }
 
 /**
  * @brief Returns the number of pending jobs currently stored.
  *
  * @details
- * - Thread-safe snapshot.
- * - Does not block waiting consumers or producers for long.
+ * - Thread-safe, lock-free snapshot.
  */
 size_t JobQueue::size() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    return buffer.size();
+    return queued;
 }
 
 /**
@@ -136,8 +320,13 @@ size_t JobQueue::size() const
 void JobQueue::clear()
 {
     std::lock_guard<std::mutex> lock(mtx);
-    Logger::info("[Queue Job] Jobs cleaned");
-    buffer.clear();
+    LOG_INFO("[Queue Job] Jobs cleaned");
+    for (auto& lane : lanes)
+        lane.clear();
+    passedOver.fill(0);
+    queued        = 0;
+    nonEmptyLanes = 0;
+    starvingLanes = 0;
 }
 
 /**
@@ -156,7 +345,7 @@ void JobQueue::shutdown()
 {
     std::lock_guard<std::mutex> lock(mtx);
     closed = true;
-    Logger::info("[Queue Job] Queue job closed");
+    LOG_INFO("[Queue Job] Queue job closed");
     cv.notify_all();
 }
 
@@ -169,5 +358,112 @@ void JobQueue::shutdown()
  */
 bool JobQueue::is_closed()
 {
+    std::lock_guard<std::mutex> lock(mtx);
     return closed;
+}
+
+/**
+ * @brief Adds `count` wake-ups and wakes every blocked consumer.
+ *
+ * @details
+ * Consumers that find a job still take it; up to `count` of the others
+ * return empty-handed.
+ */
+void JobQueue::interrupt(size_t count)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    interrupts += count;
+    cv.notify_all();
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Spins while the queue is empty, then locks `mtx` and blocks until
+ *        there is a task, the queue is closed or an interrupt is pending.
+ */
+std::unique_lock<std::mutex> JobQueue::waitLocked()
+{
+    spin.until([this] { return queued > 0; });
+
+    std::unique_lock<std::mutex> lock(mtx);
+    ++sleepers;
+    cv.wait(lock, [this] { return closed || queued > 0 || interrupts > 0; });
+    --sleepers;
+    return lock;
+}
+
+/**
+ * @brief True when a blocked consumer exists and the spinners cannot take every task.
+ */
+bool JobQueue::mustNotifyLocked() const
+{
+    return sleepers > 0 && queued > spin.spinning();
+}
+
+/**
+ * @brief Moves the next task plus up to `fairShare()` more into `out`.
+ */
+size_t JobQueue::takeLocked(Task* out, size_t max_count, size_t consumers)
+{
+    const size_t count = 1 + fairShare(queued - 1, max_count - 1, consumers);
+    for (size_t i = 0; i < count; ++i)
+        popLocked(out[i]);
+
+    LOG_DEBUG("[Queue Job] " + std::to_string(count) + " job(s) extracted in one batch");
+    return count;
+}
+
+/**
+ * @brief Appends `task` to `lane` and marks the lane non-empty.
+ */
+void JobQueue::pushLocked(Task&& task, size_t lane)
+{
+    lanes[lane].emplace_back(std::move(task));
+    nonEmptyLanes |= 1u << lane;
+    ++queued;
+}
+
+/**
+ * @brief Pops the front task of the lane chosen by `selectLaneLocked()`.
+ */
+void JobQueue::popLocked(Task& task)
+{
+    const size_t lane = selectLaneLocked();
+
+    task = std::move(lanes[lane].front());
+    lanes[lane].pop_front();
+    --queued;
+
+    if (lanes[lane].empty())
+        nonEmptyLanes &= ~(1u << lane);
+}
+
+/**
+ * @brief Picks the lane to serve next in constant time.
+ *
+ * @details
+ * Strict priority is the lowest set bit of `nonEmptyLanes`. With aging on,
+ * every pop charges one "passed over" to each waiting lane below the one
+ * served; a lane reaching `agingThreshold` joins `starvingLanes` and is
+ * served next (highest starving lane first), which resets its charge.
+ */
+size_t JobQueue::selectLaneLocked()
+{
+    const unsigned starving = starvingLanes & nonEmptyLanes;
+    const size_t   lane     = firstLane(starving != 0 ? starving : nonEmptyLanes);
+
+    if (agingThreshold == 0)
+        return lane;
+
+    passedOver[lane] = 0;
+    starvingLanes &= ~(1u << lane);
+    for (size_t lower = lane + 1; lower < kPriorityLevels; ++lower)
+    {
+        if ((nonEmptyLanes & (1u << lower)) && ++passedOver[lower] >= agingThreshold)
+            starvingLanes |= 1u << lower;
+    }
+    return lane;
 }
\ No newline at end of file
@@ -0,0 +1,158 @@
+/**
+ * @file        job_trace.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of the Chrome trace-event writer.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <set>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+/* Project libraries */
+
+#include "job_trace.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Steady-clock ticks to (fractional) microseconds.
+ */
+double toMicros(int64_t ticks)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::duration(ticks))
+        .count();
+}
+
+/**
+ * @brief Readable form of a `typeid().name()` (unchanged where names are not mangled).
+ */
+std::string demangle(const char* name)
+{
+    if (!name)
+        return "job";
+#if defined(__GNUG__)
+    int                                    status = 0;
+    std::unique_ptr<char, void (*)(void*)> readable(
+        abi::__cxa_demangle(name, nullptr, nullptr, &status), std::free);
+    if (status == 0 && readable)
+        return readable.get();
+#endif
+    return name;
+}
+
+/**
+ * @brief Writes `text` as a JSON string literal.
+ */
+void writeString(std::ostream& out, const std::string& text)
+{
+    out << '"';
+    for (char c : text)
+    {
+        switch (c)
+        {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                        << static_cast<int>(c) << std::dec << std::setfill(' ');
+                else
+                    out << c;
+        }
+    }
+    out << '"';
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Stores the event and the worker that ran it.
+ */
+void JobTrace::add(size_t worker, const TraceEvent& event)
+{
+    events.push_back(Entry{worker, event});
+}
+
+/**
+ * @brief Emits metadata events naming each worker track, then one "X" event per job.
+ */
+void JobTrace::write(std::ostream& out) const
+{
+    const std::ios_base::fmtflags flags     = out.flags();
+    const std::streamsize         precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"traceEvents\":[";
+
+    std::set<size_t> workers;
+    for (const Entry& entry : events)
+        workers.insert(entry.worker);
+
+    bool first = true;
+    for (size_t worker : workers)
+    {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << worker
+            << ",\"args\":{\"name\":\"Thread " << worker << "\"}}";
+    }
+
+    for (const Entry& entry : events)
+    {
+        const TraceEvent& event = entry.event;
+        out << (first ? "\n" : ",\n");
+        first = false;
+
+        out << "{\"name\":";
+        writeString(out, demangle(event.type));
+        out << ",\"cat\":\"job\",\"ph\":\"X\",\"pid\":1,\"tid\":" << entry.worker
+            << ",\"ts\":" << toMicros(event.started)
+            << ",\"dur\":" << toMicros(event.finished - event.started) << ",\"args\":{";
+        if (event.submitted != 0)
+            out << "\"queue_wait_us\":" << toMicros(event.started - event.submitted) << ",";
+        out << "\"failed\":" << (event.failed ? "true" : "false") << "}}";
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":" << dropped
+        << "}}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+/**
+ * @brief Opens `path` and delegates to `write()`.
+ */
+bool JobTrace::writeFile(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file)
+        return false;
+    write(file);
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file        latency_histogram.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of the log-linear latency histogram.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <cmath>
+
+/* Project libraries */
+
+#include "latency_histogram.h"
+
+/*****************************************************************************/
+
+/* Static member initialization */
+
+constexpr unsigned LatencyHistogram::kSubBucketBits;
+constexpr uint64_t LatencyHistogram::kSubBuckets;
+constexpr unsigned LatencyHistogram::kMaxBits;
+constexpr size_t   LatencyHistogram::kBuckets;
+
+/*****************************************************************************/
+
+/* HistogramSnapshot */
+
+/**
+ * @brief Creates a snapshot with every bucket at zero.
+ */
+HistogramSnapshot::HistogramSnapshot()
+    : counts(LatencyHistogram::kBuckets, 0), total(0), sumNs(0), maxNs(0)
+{
+}
+
+/**
+ * @brief Bucket-wise sum.
+ */
+void HistogramSnapshot::merge(const HistogramSnapshot& other)
+{
+    for (size_t i = 0; i < counts.size(); ++i)
+        counts[i] += other.counts[i];
+    total += other.total;
+    sumNs += other.sumNs;
+    maxNs = std::max(maxNs, other.maxNs);
+}
+
+/**
+ * @brief Bucket-wise difference, clamped at zero.
+ */
+void HistogramSnapshot::subtract(const HistogramSnapshot& earlier)
+{
+    for (size_t i = 0; i < counts.size(); ++i)
+        counts[i] -= std::min(counts[i], earlier.counts[i]);
+    total -= std::min(total, earlier.total);
+    sumNs -= std::min(sumNs, earlier.sumNs);
+}
+
+/**
+ * @brief Lower bound of the first non-empty bucket.
+ */
+uint64_t HistogramSnapshot::min() const
+{
+    for (size_t i = 0; i < counts.size(); ++i)
+    {
+        if (counts[i] != 0)
+            return LatencyHistogram::lowerBoundOf(i);
+    }
+    return 0;
+}
+
+/**
+ * @brief `sum / count`.
+ */
+double HistogramSnapshot::mean() const
+{
+    return total == 0 ? 0.0 : static_cast<double>(sumNs) / static_cast<double>(total);
+}
+
+/**
+ * @brief Walks the buckets until the cumulative count reaches the requested rank.
+ */
+uint64_t HistogramSnapshot::percentile(double percentile) const
+{
+    if (total == 0)
+        return 0;
+
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    const uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(total))));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+            return std::min(LatencyHistogram::upperBoundOf(i), maxNs);
+    }
+    return maxNs;
+}
+
+/*****************************************************************************/
+
+/* LatencyHistogram */
+
+/**
+ * @brief Creates an empty histogram.
+ */
+LatencyHistogram::LatencyHistogram() : sumNs(0), maxNs(0)
+{
+    for (auto& bucket : buckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Copies every bucket with relaxed loads.
+ */
+HistogramSnapshot LatencyHistogram::snapshot() const
+{
+    HistogramSnapshot copy;
+    for (size_t i = 0; i < kBuckets; ++i)
+    {
+        copy.counts[i] = buckets[i].load(std::memory_order_relaxed);
+        copy.total += copy.counts[i];
+    }
+    copy.sumNs = sumNs.load(std::memory_order_relaxed);
+    copy.maxNs = maxNs.load(std::memory_order_relaxed);
+    return copy;
+}
+
+/**
+ * @brief Last value of bucket `index`.
+ */
+uint64_t LatencyHistogram::upperBoundOf(size_t index)
+{
+    if (index < kSubBuckets)
+        return index;
+    const unsigned shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+    return lowerBoundOf(index) + (uint64_t(1) << shift) - 1;
+}
+
+/**
+ * @brief First value of bucket `index`.
+ */
+uint64_t LatencyHistogram::lowerBoundOf(size_t index)
+{
+    if (index < kSubBuckets)
+        return index;
+    const unsigned shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+    const uint64_t sub   = index % kSubBuckets;
+    return (kSubBuckets + sub) << shift;
+}
@@ -14,26 +14,386 @@
  * - Output from multiple threads is synchronized via a shared `std::mutex`.
  * - Messages are filtered according to the current `minLevel`.
  * - Each log line includes timestamp + severity + message.
+ *
+ * Asynchronous mode:
+ * - Every producing thread lazily registers its own `SpscRing` of records.
+ *   Pushing is a copy into a reused slot plus one release store: no lock,
+ *   no formatting, no I/O on the caller.
+ * - One flush thread wakes every few milliseconds (or on `flush()` /
+ *   a blocked producer), drains all rings into a single buffer, formats the
+ *   timestamps (cached per second) and writes the whole batch at once.
+ * - Rings of exited threads are drained one last time and then released.
  */
 
 /*****************************************************************************/
 
 /* Standard libraries */
 #include <chrono>
+#include <condition_variable>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 /* Project libraries */
 #include "logger.h"
+#include "spsc_ring.h"
+
+/*****************************************************************************/
+
+/* Asynchronous backend */
+
+/**
+ * @brief Per-thread rings, flush thread and flush handshake.
+ */
+struct Logger::AsyncBackend
+{
+    /**
+     * @brief One buffered log line. `text` keeps its capacity between laps.
+     */
+    struct Record
+    {
+        Level                                 level = Level::INFO;
+        std::chrono::system_clock::time_point time;
+        std::string                           text;
+    };
+
+    /**
+     * @brief Ring owned by one producing thread.
+     */
+    struct ThreadRing
+    {
+        explicit ThreadRing(size_t capacity) : ring(capacity), writing(false), orphaned(false) {}
+
+        SpscRing<Record>  ring;
+        std::atomic<bool> writing;  /**< Producer is between its enabled check and its push. */
+        std::atomic<bool> orphaned; /**< Producing thread has exited. */
+    };
+
+    /**
+     * @brief Thread-local registration; flags the ring when the thread exits.
+     */
+    struct ThreadHandle
+    {
+        ~ThreadHandle()
+        {
+            if (ring)
+                ring->orphaned.store(true, std::memory_order_release);
+        }
+
+        std::shared_ptr<ThreadRing> ring;
+        uint64_t                    generation = 0;
+    };
+
+    /**
+     * @brief Maximum time a record waits in its ring before being written.
+     */
+    static constexpr std::chrono::milliseconds kFlushInterval{5};
+
+    ~AsyncBackend() { stop(); }
+
+    void start(size_t ring_capacity, OverflowPolicy overflow_policy);
+    void stop();
+    void flush();
+    bool push(Level lvl, const std::string& msg);
+
+    ThreadRing* localRing();
+    void        run();
+    void        drainAll(std::string& out);
+    void        wake();
+
+    std::atomic<bool>     enabled{false};
+    std::atomic<uint64_t> dropped{0};
+
+    size_t         ringCapacity = 1024;
+    OverflowPolicy policy       = OverflowPolicy::DROP;
+
+    std::mutex                               registryMtx;
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    std::atomic<uint64_t>                    generation{0};
+
+    std::mutex              wakeMtx;
+    std::condition_variable wakeCv;
+    std::condition_variable flushedCv;
+    bool                    wakeRequested  = false;
+    bool                    stopping       = false;
+    bool                    flushing       = false;
+    uint64_t                flushRequested = 0;
+    uint64_t                flushCompleted = 0;
+
+    std::mutex  controlMtx;
+    std::thread worker;
+
+    uint64_t    reportedDrops = 0;
+    std::time_t stampSecond   = -1;
+    char        stamp[32]     = {};
+};
+
+constexpr std::chrono::milliseconds Logger::AsyncBackend::kFlushInterval;
+
+/**
+ * @brief Launches the flush thread for a fresh generation of rings.
+ */
+void Logger::AsyncBackend::start(size_t ring_capacity, OverflowPolicy overflow_policy)
+{
+    std::lock_guard<std::mutex> control(controlMtx);
+    if (worker.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(registryMtx);
+        rings.clear();
+        generation.fetch_add(1, std::memory_order_release);
+        ringCapacity = ring_capacity;
+        policy       = overflow_policy;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wakeMtx);
+        stopping      = false;
+        wakeRequested = false;
+        flushing      = true;
+    }
+    dropped.store(0, std::memory_order_relaxed);
+    reportedDrops = 0;
+
+    worker = std::thread(&AsyncBackend::run, this);
+    enabled.store(true, std::memory_order_seq_cst);
+}
+
+/**
+ * @brief Disables the fast path, waits for in-progress pushes, then lets the
+ *        flush thread do its final drain.
+ */
+void Logger::AsyncBackend::stop()
+{
+    std::lock_guard<std::mutex> control(controlMtx);
+    if (!worker.joinable())
+        return;
+
+    enabled.store(false, std::memory_order_seq_cst);
+
+    std::vector<std::shared_ptr<ThreadRing>> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(registryMtx);
+        snapshot = rings;
+    }
+    for (const auto& ring : snapshot)
+    {
+        while (ring->writing.load(std::memory_order_seq_cst))
+            std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMtx);
+        stopping = true;
+    }
+    wakeCv.notify_one();
+    worker.join();
+
+    std::lock_guard<std::mutex> lock(registryMtx);
+    rings.clear();
+}
+
+/**
+ * @brief Requests a pass of the flush thread and waits for it.
+ */
+void Logger::AsyncBackend::flush()
+{
+    std::unique_lock<std::mutex> lock(wakeMtx);
+    if (!flushing)
+        return;
+
+    const uint64_t target = ++flushRequested;
+    wakeRequested         = true;
+    wakeCv.notify_one();
+    flushedCv.wait(lock, [&] { return flushCompleted >= target || !flushing; });
+}
+
+/**
+ * @brief Fast path of `log()`; returns `false` to fall back to a synchronous write.
+ */
+bool Logger::AsyncBackend::push(Level lvl, const std::string& msg)
+{
+    ThreadRing* local = localRing();
+    if (!local)
+        return false;
+
+    // Dekker handshake with stop(): either stop() sees `writing` or we see !enabled
+    local->writing.store(true, std::memory_order_seq_cst);
+    if (!enabled.load(std::memory_order_seq_cst))
+    {
+        local->writing.store(false, std::memory_order_release);
+        return false;
+    }
+
+    const auto now  = std::chrono::system_clock::now();
+    auto       fill = [&](Record& record)
+    {
+        record.level = lvl;
+        record.time  = now;
+        record.text.assign(msg);
+    };
+
+    bool pushed = local->ring.tryPush(fill);
+    while (!pushed && policy == OverflowPolicy::BLOCK && enabled.load(std::memory_order_acquire))
+    {
+        wake();
+        std::this_thread::yield();
+        pushed = local->ring.tryPush(fill);
+    }
+
+    const bool handled = pushed || policy == OverflowPolicy::DROP;
+    if (!pushed && policy == OverflowPolicy::DROP)
+        dropped.fetch_add(1, std::memory_order_relaxed);
+
+    local->writing.store(false, std::memory_order_release);
+    return handled;
+}
+
+/**
+ * @brief Returns the calling thread's ring for the current generation,
+ *        registering a new one on first use.
+ */
+Logger::AsyncBackend::ThreadRing* Logger::AsyncBackend::localRing()
+{
+    static thread_local ThreadHandle handle;
+
+    if (handle.ring && handle.generation == generation.load(std::memory_order_acquire))
+        return handle.ring.get();
+
+    std::lock_guard<std::mutex> lock(registryMtx);
+    if (handle.ring)
+        handle.ring->orphaned.store(true, std::memory_order_release);
+    handle.ring       = std::make_shared<ThreadRing>(ringCapacity);
+    handle.generation = generation.load(std::memory_order_relaxed);
+    rings.push_back(handle.ring);
+    return handle.ring.get();
+}
+
+/**
+ * @brief Flush thread: sleep, drain everything, repeat; final drain on stop.
+ */
+void Logger::AsyncBackend::run()
+{
+    std::string out;
+
+    std::unique_lock<std::mutex> lock(wakeMtx);
+    for (;;)
+    {
+        wakeCv.wait_for(lock, kFlushInterval, [this] { return wakeRequested || stopping; });
+
+        const bool     last   = stopping;
+        const uint64_t target = flushRequested;
+        wakeRequested         = false;
+        lock.unlock();
+
+        drainAll(out);
+
+        lock.lock();
+        flushCompleted = target;
+        if (last)
+            flushing = false;
+        flushedCv.notify_all();
+
+        if (last)
+            break;
+    }
+}
+
+/**
+ * @brief Drains every ring into `out` and writes it with a single call.
+ */
+void Logger::AsyncBackend::drainAll(std::string& out)
+{
+    std::vector<std::shared_ptr<ThreadRing>> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(registryMtx);
+        snapshot = rings;
+    }
+
+    out.clear();
+    for (const auto& ring : snapshot)
+    {
+        const bool exited = ring->orphaned.load(std::memory_order_acquire);
+
+        ring->ring.consume(
+            [&](Record& record)
+            {
+                const std::time_t second = std::chrono::system_clock::to_time_t(record.time);
+                if (second != stampSecond)
+                {
+                    std::tm tm{};
+#if defined(_WIN32)
+                    localtime_s(&tm, &second);
+#else
+                    localtime_r(&second, &tm);
+#endif
+                    std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &tm);
+                    stampSecond = second;
+                }
+
+                out += '[';
+                out += stamp;
+                out += "] [";
+                out += levelToString(record.level);
+                out += "] ";
+                out += record.text;
+                out += '\n';
+            });
+
+        if (exited)
+        {
+            std::lock_guard<std::mutex> lock(registryMtx);
+            for (auto it = rings.begin(); it != rings.end(); ++it)
+            {
+                if (*it == ring)
+                {
+                    rings.erase(it);
+                    break;
+                }
+            }
+        }
+    }
+
+    const uint64_t drops = dropped.load(std::memory_order_relaxed);
+    if (drops != reportedDrops)
+    {
+        out += "[Logger] ";
+        out += std::to_string(drops - reportedDrops);
+        out += " message(s) dropped: async ring full\n";
+        reportedDrops = drops;
+    }
+
+    if (out.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    std::cout.write(out.data(), static_cast<std::streamsize>(out.size()));
+    std::cout.flush();
+}
+
+/**
+ * @brief Nudges the flush thread (used by blocked producers).
+ */
+void Logger::AsyncBackend::wake()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeMtx);
+        wakeRequested = true;
+    }
+    wakeCv.notify_one();
+}
 
 /*****************************************************************************/
 
 /* Static member initialization */
 
-std::mutex    Logger::mtx;
-Logger::Level Logger::minLevel = Logger::Level::INFO;
+std::mutex                Logger::mtx;
+std::atomic<Logger::Level> Logger::minLevel{Logger::Level::INFO};
+Logger::AsyncBackend       Logger::asyncBackend;
 
 /*****************************************************************************/
 
@@ -50,12 +410,57 @@ Logger::Level Logger::minLevel = Logger::Level::INFO;
  * THEN subsequent calls to `log()` will only print messages with
  * `level >= lvl`.
  *
- * Thread-safe: uses a lock to protect shared configuration.
+ * Thread-safe: `minLevel` is atomic, so the filter check never locks.
  */
 void Logger::set_min_level(Level lvl)
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    minLevel = lvl;
+    minLevel.store(lvl, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Switches to asynchronous logging.
+ */
+void Logger::start_async(size_t ring_capacity, OverflowPolicy policy)
+{
+    asyncBackend.start(ring_capacity, policy);
+}
+
+/**
+ * @brief Drains pending records and returns to synchronous logging.
+ */
+void Logger::stop_async()
+{
+    asyncBackend.stop();
+}
+
+/**
+ * @brief Waits until every record enqueued so far has been written.
+ */
+void Logger::flush()
+{
+    if (is_async())
+        asyncBackend.flush();
+    else
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        std::cout.flush();
+    }
+}
+
+/**
+ * @brief Returns whether the asynchronous backend is active.
+ */
+bool Logger::is_async()
+{
+    return asyncBackend.enabled.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Returns the number of records discarded since the last `start_async()`.
+ */
+uint64_t Logger::dropped_count()
+{
+    return asyncBackend.dropped.load(std::memory_order_relaxed);
 }
 
 /**
@@ -126,26 +531,43 @@ void Logger::error(const std::string& msg)
  *    [YYYY-MM-DD HH:MM:SS] [LEVEL] message
  *    ```
  *
+ * In asynchronous mode the record is only pushed to the calling thread's
+ * ring; it falls back to a synchronous write if the backend is stopping
+ * (or the ring is full under `OverflowPolicy::BLOCK` while stopping).
+ *
  * @note
  * - Thread-safe: all access to `std::cout` is serialized with a mutex.
- * - Uses `std::endl` to flush output immediately.
+ * - Synchronous mode uses `std::endl` to flush output immediately.
  */
 void Logger::log(Level lvl, const std::string& msg)
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    if (static_cast<int>(lvl) < static_cast<int>(minLevel))
+    if (static_cast<int>(lvl) < static_cast<int>(minLevel.load(std::memory_order_relaxed)))
     {
         return;
     }
 
-    std::cout << "[" << timestamp() << "] "
-              << "[" << levelToString(lvl) << "] " << msg << std::endl;
+    if (asyncBackend.enabled.load(std::memory_order_acquire) && asyncBackend.push(lvl, msg))
+    {
+        return;
+    }
+
+    write_sync(lvl, msg);
 }
 
 /*****************************************************************************/
 
 /* Private Methods */
 
+/**
+ * @brief Formats and prints one line on the calling thread.
+ */
+void Logger::write_sync(Level lvl, const std::string& msg)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    std::cout << "[" << timestamp() << "] "
+              << "[" << levelToString(lvl) << "] " << msg << std::endl;
+}
+
 /**
  * @brief Returns the current timestamp in "YYYY-MM-DD HH:MM:SS" format.
  *
@@ -18,6 +18,7 @@
  *   --demo                   Enqueue several PrintJobs
  *   --slow                   Enqueue slow jobs (requires FakeSlowJob)
  *   --immediate-shutdown     Stop immediately (shutdownNow)
+ *   --async-log              Log through the asynchronous Logger backend
  */
 
 #include <chrono>
@@ -40,6 +41,7 @@ int main(int argc, char** argv)
     bool   runDemo           = false;
     bool   runSlow           = false;
     bool   immediateShutdown = false;
+    bool   asyncLog          = false;
 
     // --------------------------
     // Parse CLI arguments
@@ -64,13 +66,18 @@ int main(int argc, char** argv)
         {
             immediateShutdown = true;
         }
+        else if (arg == "--async-log")
+        {
+            asyncLog = true;
+        }
         else if (arg == "--help")
         {
             std::cout << "TaskScheduler usage:\n"
                       << "  --threads N            Number of threads\n"
                       << "  --demo                 Run simple PrintJob demo\n"
                       << "  --slow                 Run FakeSlowJob demo\n"
-                      << "  --immediate-shutdown   Demonstrate shutdownNow()\n";
+                      << "  --immediate-shutdown   Demonstrate shutdownNow()\n"
+                      << "  --async-log            Use the asynchronous logger\n";
             return 0;
         }
         else
@@ -80,6 +87,11 @@ int main(int argc, char** argv)
         }
     }
 
+    if (asyncLog)
+    {
+        Logger::start_async();
+    }
+
     // --------------------------
     // Create and start ThreadPool
     // --------------------------
@@ -121,7 +133,8 @@ int main(int argc, char** argv)
     if (immediateShutdown)
     {
         Logger::warn("[Main] Calling shutdownNow()");
-        pool.shutdownNow();
+        const auto unexecuted = pool.shutdownNow();
+        Logger::warn("[Main] " + std::to_string(unexecuted.size()) + " job(s) never ran");
     }
     else
     {
@@ -130,5 +143,6 @@ int main(int argc, char** argv)
     }
 
     Logger::info("[Main] Exiting program.");
+    Logger::stop_async();
     return 0;
 }
@@ -0,0 +1,312 @@
+/**
+ * @file        numa_job_queue.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of NumaJobQueue.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <utility>
+
+/* Project libraries */
+
+#include "numa_job_queue.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Home shard of the current thread and the queue it belongs to.
+ */
+struct HomeShard
+{
+    const NumaJobQueue* owner = nullptr;
+    size_t              shard = 0;
+};
+
+thread_local HomeShard tlsHome;
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Builds the shards and the CPU-to-shard map.
+ */
+NumaJobQueue::NumaJobQueue(const CpuTopology& topology, size_t priority_aging,
+                           const SpinPolicy& spin_policy)
+    : closed(false), sleepers(0), stolen(0), spin(spin_policy)
+{
+    for (int node : topology.nodes())
+    {
+        const std::vector<int> cpus = topology.onNode(node).cpuNumbers();
+        for (int cpu : cpus)
+        {
+            if (static_cast<size_t>(cpu) >= cpuShard.size())
+                cpuShard.resize(static_cast<size_t>(cpu) + 1, 0);
+            cpuShard[static_cast<size_t>(cpu)] = shards.size();
+        }
+        shards.emplace_back(new Shard(node, cpus, priority_aging));
+    }
+
+    if (shards.empty())
+        shards.emplace_back(new Shard(0, {}, priority_aging));
+}
+
+/**
+ * @brief Looks `cpu` up in the CPU map.
+ */
+size_t NumaJobQueue::shardOf(int cpu) const
+{
+    if (cpu < 0 || static_cast<size_t>(cpu) >= cpuShard.size())
+        return 0;
+    return cpuShard[static_cast<size_t>(cpu)];
+}
+
+/**
+ * @brief Records `shard` as the calling thread's home for this queue.
+ */
+void NumaJobQueue::bindCurrentThread(size_t shard)
+{
+    tlsHome.owner = this;
+    tlsHome.shard = shard < shards.size() ? shard : 0;
+}
+
+/**
+ * @brief Bound shard, else the shard of the CPU the thread runs on.
+ */
+size_t NumaJobQueue::currentShard() const
+{
+    if (tlsHome.owner == this)
+        return tlsHome.shard;
+    return shards.size() == 1 ? 0 : shardOf(CpuTopology::currentCpu());
+}
+
+/**
+ * @brief Pushes into the caller's shard and wakes a sleeper.
+ */
+void NumaJobQueue::pushTask(Task task)
+{
+    shards[currentShard()]->queue.pushTask(std::move(task));
+    wake(1);
+}
+
+/**
+ * @brief Pushes into the caller's shard lane and wakes a sleeper.
+ */
+void NumaJobQueue::pushPriorityTask(Task task, JobPriority priority)
+{
+    shards[currentShard()]->queue.pushPriorityTask(std::move(task), priority);
+    wake(1);
+}
+
+/**
+ * @brief Blocking single pop through `popTasks()`.
+ */
+bool NumaJobQueue::popTask(Task& task)
+{
+    return popTasks(&task, 1) == 1;
+}
+
+/**
+ * @brief Non-blocking single pop, nearest shard first.
+ */
+bool NumaJobQueue::tryPopTask(Task& task)
+{
+    return takeNearest([&task](JobQueue& queue) -> size_t
+                       { return queue.tryPopTask(task) ? 1 : 0; }) == 1;
+}
+
+/**
+ * @brief Non-blocking victim pop, nearest shard first.
+ */
+bool NumaJobQueue::tryPopVictim(Task& task)
+{
+    return takeNearest([&task](JobQueue& queue) -> size_t
+                       { return queue.tryPopVictim(task) ? 1 : 0; }) == 1;
+}
+
+/**
+ * @brief Pushes the batch into the caller's shard and wakes enough sleepers.
+ */
+void NumaJobQueue::pushTasks(Task* tasks, size_t count)
+{
+    if (count == 0)
+        return;
+
+    shards[currentShard()]->queue.pushTasks(tasks, count);
+    wake(count);
+}
+
+/**
+ * @brief Pops from the nearest shard with work, sleeping while all are empty.
+ *
+ * @details
+ * A consumer registers in `sleepers` and re-checks every shard while
+ * holding `sleepMtx`; a producer pushes first and then reads `sleepers`,
+ * notifying under the same mutex. Either the consumer sees the task or the
+ * producer sees the consumer, so no wake-up is lost. A pending `interrupt()`
+ * is consumed instead of sleeping. The spin phase runs first; a spinner
+ * leaves the spinner count before registering as a sleeper, so a producer
+ * that skipped the wake-up for it is seen by its re-check.
+ */
+size_t NumaJobQueue::popTasks(Task* out, size_t max_count, size_t consumers)
+{
+    if (max_count == 0)
+        return 0;
+
+    for (;;)
+    {
+        const size_t popped = tryPopTasks(out, max_count, consumers);
+        if (popped > 0)
+            return popped;
+
+        if (spin.until([this] { return !empty() || closed.load(std::memory_order_acquire); }) &&
+            !empty())
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleepMtx);
+        if (interrupts > 0)
+        {
+            --interrupts;
+            return 0;
+        }
+
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        sleepCv.wait(lock,
+                     [this]
+                     {
+                         return closed.load(std::memory_order_acquire) || !empty() ||
+                                interrupts > 0;
+                     });
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+
+        if (closed.load(std::memory_order_acquire) && empty())
+            return 0;
+    }
+}
+
+/**
+ * @brief Non-blocking batch pop from the nearest shard with work.
+ */
+size_t NumaJobQueue::tryPopTasks(Task* out, size_t max_count, size_t consumers)
+{
+    if (max_count == 0)
+        return 0;
+
+    return takeNearest([out, max_count, consumers](JobQueue& queue)
+                       { return queue.tryPopTasks(out, max_count, consumers); });
+}
+
+/**
+ * @brief True if no shard holds a task.
+ */
+bool NumaJobQueue::empty() const
+{
+    return std::all_of(shards.begin(), shards.end(),
+                       [](const std::unique_ptr<Shard>& shard) { return shard->queue.empty(); });
+}
+
+/**
+ * @brief Sums the shard sizes.
+ */
+size_t NumaJobQueue::size() const
+{
+    size_t total = 0;
+    for (const auto& shard : shards)
+        total += shard->queue.size();
+    return total;
+}
+
+/**
+ * @brief Clears every shard.
+ */
+void NumaJobQueue::clear()
+{
+    for (auto& shard : shards)
+        shard->queue.clear();
+}
+
+/**
+ * @brief Sets the closed flag and wakes every sleeper.
+ */
+void NumaJobQueue::shutdown()
+{
+    closed.store(true, std::memory_order_release);
+    for (auto& shard : shards)
+        shard->queue.shutdown();
+
+    std::lock_guard<std::mutex> lock(sleepMtx);
+    sleepCv.notify_all();
+}
+
+/**
+ * @brief Returns the closed flag.
+ */
+bool NumaJobQueue::is_closed()
+{
+    return closed.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Adds `count` wake-ups and wakes every sleeper.
+ */
+void NumaJobQueue::interrupt(size_t count)
+{
+    std::lock_guard<std::mutex> lock(sleepMtx);
+    interrupts += count;
+    sleepCv.notify_all();
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Notifies under `sleepMtx`, only when a consumer sleeps and the
+ *        spinners cannot take every queued task.
+ */
+void NumaJobQueue::wake(size_t count)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_seq_cst) == 0)
+        return;
+    if (spin.spinning() >= size())
+        return;
+
+    std::lock_guard<std::mutex> lock(sleepMtx);
+    if (count == 1)
+        sleepCv.notify_one();
+    else
+        sleepCv.notify_all();
+}
+
+/**
+ * @brief Tries the caller's shard, then the following ones, counting steals.
+ */
+template <typename Take>
+size_t NumaJobQueue::takeNearest(Take take)
+{
+    const size_t home = currentShard();
+    for (size_t i = 0; i < shards.size(); ++i)
+    {
+        const size_t taken = take(shards[(home + i) % shards.size()]->queue);
+        if (taken > 0)
+        {
+            if (i > 0)
+                stolen.fetch_add(taken, std::memory_order_relaxed);
+            return taken;
+        }
+    }
+    return 0;
+}
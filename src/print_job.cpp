@@ -42,5 +42,5 @@ PrintJob::PrintJob(const std::string& msg) : msg(msg) {}
  */
 void PrintJob::execute()
 {
-    Logger::info("PrintJob executed: " + msg);
+    LOG_INFO("PrintJob executed: " + msg);
 }
\ No newline at end of file
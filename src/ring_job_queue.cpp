@@ -0,0 +1,417 @@
+/**
+ * @file        ring_job_queue.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of the bounded lock-free MPMC ring buffer.
+ *
+ * @details
+ * Slot protocol (capacity `N`, position `pos`, slot `pos & mask`):
+ *  - `sequence == pos`       → slot is free for the producer claiming `pos`.
+ *  - `sequence == pos + 1`   → slot holds a job for the consumer claiming `pos`.
+ *  - `sequence == pos + N`   → slot was released and is free for `pos + N`.
+ *
+ * Producers and consumers claim positions with a CAS on their own cursor,
+ * so the only shared write per operation is the cursor itself plus the
+ * slot sequence.
+ *
+ * Parking handshake (empty ring):
+ *  - Consumer: `waiters++`, full fence, re-check the cursors under `mtx`.
+ *  - Producer: publish the job, full fence, notify under `mtx` only if
+ *    `waiters > 0`.
+ * The two fences guarantee that at least one side observes the other, so a
+ * wake-up can never be lost. A consumer leaves the spinner count before its
+ * fence, so a producer that skips the wake-up because enough consumers are
+ * spinning is likewise seen by each of them.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <thread>
+
+/* Project libraries */
+
+#include "ring_job_queue.h"
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Rounds `value` up to the next power of two (minimum 2).
+ */
+size_t roundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 2;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Allocates the ring and initializes every slot sequence.
+ */
+RingJobQueue::RingJobQueue(size_t capacity, const SpinPolicy& spin_policy)
+    : slots(roundUpToPowerOfTwo(capacity)),
+      mask(slots.size() - 1),
+      padHead(),
+      enqueuePos(0),
+      padTail(),
+      dequeuePos(0),
+      padParking(),
+      waiters(0),
+      closed(false),
+      interrupts(0),
+      spin(spin_policy)
+{
+    for (size_t i = 0; i < slots.size(); ++i)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Destroys the ring; remaining tasks are destroyed with their slots.
+ */
+RingJobQueue::~RingJobQueue() = default;
+
+/**
+ * @brief Inserts a job, yielding while the ring is full.
+ *
+ * @details
+ * Like `JobQueue::push()`, there is no rejection after shutdown; the thread
+ * pool is responsible for preventing enqueue after close.
+ */
+void RingJobQueue::pushTask(Task task)
+{
+    while (!tryEnqueue(task))
+    {
+        std::this_thread::yield();
+    }
+    notifyConsumer();
+}
+
+/**
+ * @brief Inserts a job only if a slot is free.
+ */
+bool RingJobQueue::tryPushPriorityTask(Task& task, JobPriority priority)
+{
+    (void)priority;
+    if (!tryEnqueue(task))
+        return false;
+
+    notifyConsumer();
+    return true;
+}
+
+/**
+ * @brief Retrieves the next task, parking the caller while the ring is empty.
+ *
+ * @param task Receives the next task.
+ * @return `false` once the ring is closed and drained, or for a pending
+ *         `interrupt()` while it is empty.
+ */
+bool RingJobQueue::popTask(Task& task)
+{
+    if (!waitDequeue(task))
+        return false;
+
+    LOG_DEBUG("[Ring Queue] Job extracted successfully");
+    return true;
+}
+
+/**
+ * @brief Pops a batch of tasks, parking only for the first one.
+ *
+ * @param out       Receives the tasks, oldest first.
+ * @param max_count Capacity of `out`.
+ * @param consumers Number of threads sharing the ring.
+ * @return Number of tasks popped; `0` once the ring is closed and drained, or
+ *         for a pending `interrupt()` while it is empty.
+ */
+size_t RingJobQueue::popTasks(Task* out, size_t max_count, size_t consumers)
+{
+    if (max_count == 0 || !waitDequeue(out[0]))
+        return 0;
+
+    const size_t share = fairShare(size(), max_count - 1, consumers);
+    size_t       count = 1;
+    while (count <= share && tryDequeue(out[count]))
+        ++count;
+
+    LOG_DEBUG("[Ring Queue] " + std::to_string(count) + " job(s) extracted in one batch");
+    return count;
+}
+
+/**
+ * @brief Retrieves the next task without blocking.
+ *
+ * @param task Receives the next task.
+ * @return `false` if the ring is empty.
+ */
+bool RingJobQueue::tryPopTask(Task& task)
+{
+    return tryDequeue(task);
+}
+
+/**
+ * @brief Inserts a batch of tasks, paying the parked-consumer check once.
+ *
+ * @param tasks Array of non-empty tasks, moved from.
+ * @param count Number of tasks.
+ */
+void RingJobQueue::pushTasks(Task* tasks, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        while (!tryEnqueue(tasks[i]))
+        {
+            notifyConsumer(true);
+            std::this_thread::yield();
+        }
+    }
+
+    if (count > 0)
+        notifyConsumer(count > 1);
+}
+
+/**
+ * @brief Returns whether the ring is empty.
+ *
+ * @warning The result is only a snapshot.
+ */
+bool RingJobQueue::empty() const
+{
+    return size() == 0;
+}
+
+/**
+ * @brief Returns the number of claimed-but-not-consumed positions.
+ *
+ * @details
+ * Includes slots still being written by a producer, so the value may be
+ * slightly ahead of what `pop()` can return at this exact instant.
+ */
+size_t RingJobQueue::size() const
+{
+    const size_t tail = dequeuePos.load(std::memory_order_seq_cst);
+    const size_t head = enqueuePos.load(std::memory_order_seq_cst);
+    return head >= tail ? head - tail : 0;
+}
+
+/**
+ * @brief Removes and destroys every job currently stored in the ring.
+ *
+ * @details
+ * Does not wake consumers and does not affect the closed state.
+ */
+void RingJobQueue::clear()
+{
+    Task task;
+    while (tryDequeue(task))
+        task.reset();
+    LOG_INFO("[Ring Queue] Jobs cleaned");
+}
+
+/**
+ * @brief Closes the ring and wakes all parked consumers.
+ *
+ * @details
+ * Idempotent. Consumers keep draining the remaining jobs.
+ */
+void RingJobQueue::shutdown()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    closed.store(true, std::memory_order_release);
+    LOG_INFO("[Ring Queue] Queue job closed");
+    cv.notify_all();
+}
+
+/**
+ * @brief Returns whether the ring has been closed.
+ */
+bool RingJobQueue::is_closed()
+{
+    return closed.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Adds `count` wake-ups and wakes every parked consumer.
+ */
+void RingJobQueue::interrupt(size_t count)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    interrupts.fetch_add(count, std::memory_order_release);
+    cv.notify_all();
+}
+
+/**
+ * @brief Returns the ring capacity.
+ */
+size_t RingJobQueue::capacity() const
+{
+    return slots.size();
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Dequeues a task, spinning and then parking while the ring is empty.
+ *
+ * @return `false` once the ring is closed and drained, or for a pending
+ *         `interrupt()` while it is empty.
+ */
+bool RingJobQueue::waitDequeue(Task& task)
+{
+    while (true)
+    {
+        if (tryDequeue(task))
+            break;
+
+        if (closed.load(std::memory_order_acquire))
+        {
+            // A producer may have published right before the close.
+            if (tryDequeue(task))
+                break;
+            return false;
+        }
+
+        if (takeInterrupt())
+            return false;
+
+        if (spin.until([this] { return !empty() || closed.load(std::memory_order_acquire); }))
+            continue;
+
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock,
+                    [this]
+                    {
+                        return closed.load(std::memory_order_acquire) || !empty() ||
+                               interrupts.load(std::memory_order_relaxed) > 0;
+                    });
+        }
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Decrements `interrupts` unless it is already zero.
+ */
+bool RingJobQueue::takeInterrupt()
+{
+    size_t pending = interrupts.load(std::memory_order_acquire);
+    while (pending > 0)
+    {
+        if (interrupts.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Claims the next free slot and moves `task` into it.
+ *
+ * @details
+ * `task` is left untouched when the ring is full.
+ */
+bool RingJobQueue::tryEnqueue(Task& task)
+{
+    size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Slot*  slot;
+
+    while (true)
+    {
+        slot               = &slots[pos & mask];
+        const size_t seq   = slot->sequence.load(std::memory_order_acquire);
+        const auto   delta = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+        if (delta == 0)
+        {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (delta < 0)
+        {
+            return false;  // Full
+        }
+        else
+        {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->task = std::move(task);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Claims the oldest published slot and moves its task out.
+ */
+bool RingJobQueue::tryDequeue(Task& task)
+{
+    size_t pos = dequeuePos.load(std::memory_order_relaxed);
+    Slot*  slot;
+
+    while (true)
+    {
+        slot             = &slots[pos & mask];
+        const size_t seq = slot->sequence.load(std::memory_order_acquire);
+        const auto   delta =
+            static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+        if (delta == 0)
+        {
+            if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (delta < 0)
+        {
+            return false;  // Empty
+        }
+        else
+        {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    task = std::move(slot->task);
+    slot->sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Wakes one parked consumer (every one if `all`) if the handshake says one may be
+ *        waiting and the spinning consumers cannot take every queued job.
+ */
+void RingJobQueue::notifyConsumer(bool all)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_relaxed) == 0)
+        return;
+    if (spin.spinning() >= size())
+        return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (all)
+        cv.notify_all();
+    else
+        cv.notify_one();
+}
@@ -0,0 +1,189 @@
+/**
+ * @file        strand.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of Strand.
+ *
+ * @details
+ * `scheduled` is the strand's only synchronization: it is set by the
+ * submitter that finds the strand idle, which then dispatches the drain,
+ * and cleared by the drain under the same lock once it found the queue
+ * empty. A job pushed after that sees `scheduled == false` and dispatches a
+ * new drain, so no job is left behind and two drains never overlap.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <string>
+
+/* Project libraries */
+
+#include "strand.h"
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Static member initialization */
+
+constexpr size_t Strand::kDrainBatch;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Creates an idle strand.
+ */
+Strand::Strand(ThreadPool& pool) : state(std::make_shared<State>(pool)) {}
+
+/**
+ * @brief Waits for the queued jobs, helping the pool meanwhile.
+ */
+Strand::~Strand()
+{
+    state->pool.helpUntilDone(state->outstanding);
+}
+
+/**
+ * @brief Wraps the job in a callable and queues it.
+ */
+void Strand::enqueue(std::unique_ptr<IJob> job)
+{
+    if (!job)
+    {
+        LOG_WARN("[Strand] Empty job ignored.");
+        return;
+    }
+
+    dispatch(Task(std::move(job)));
+}
+
+/**
+ * @brief Appends the task; the submitter finding the strand idle schedules the drain.
+ */
+void Strand::dispatch(Task task)
+{
+    if (!task)
+    {
+        LOG_WARN("[Strand] Empty task ignored.");
+        return;
+    }
+
+    bool idle;
+    {
+        std::lock_guard<std::mutex> lock(state->mtx);
+        state->outstanding.fetch_add(1, std::memory_order_relaxed);
+        state->tasks.push_back(std::move(task));
+        idle             = !state->scheduled;
+        state->scheduled = true;
+    }
+
+    // Outside the lock: a refused drain settles the strand through abandon()
+    if (idle)
+        state->schedule(state);
+}
+
+/**
+ * @brief Helps until the counter drops to zero.
+ */
+void Strand::wait()
+{
+    state->pool.helpUntilDone(state->outstanding);
+}
+
+/**
+ * @brief Returns the outstanding count.
+ */
+size_t Strand::pending() const
+{
+    return state->outstanding.load(std::memory_order_acquire);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Routed like any job: the finishing worker's own deque in work-stealing mode.
+ */
+void Strand::State::schedule(const std::shared_ptr<State>& self)
+{
+    pool.dispatch(Task(Drain(self)));
+}
+
+/**
+ * @brief Pops and runs jobs until the queue is empty or the batch is used up.
+ *
+ * @details
+ * Each job is destroyed before it is counted as done, so `wait()` only
+ * returns once its captures are gone.
+ */
+bool Strand::State::drain()
+{
+    for (size_t ran = 0; ran < kDrainBatch; ++ran)
+    {
+        {
+            Task task;
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (tasks.empty())
+                {
+                    scheduled = false;
+                    return false;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+
+            try
+            {
+                task();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR(std::string("[Strand] Exception: ") + e.what());
+            }
+        }
+        finish();
+    }
+    return true;
+}
+
+/**
+ * @brief Drops every queued job and marks the strand idle.
+ *
+ * @details
+ * Dropping a future's task completes it with `broken_promise`.
+ */
+void Strand::State::abandon()
+{
+    std::deque<Task> dropped;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        dropped.swap(tasks);
+        scheduled = false;
+    }
+
+    if (!dropped.empty())
+        LOG_WARN("[Strand] Pool refused the strand; " + std::to_string(dropped.size()) +
+                 " job(s) dropped.");
+
+    const size_t count = dropped.size();
+    dropped.clear();
+    for (size_t i = 0; i < count; ++i)
+        finish();
+}
+
+/**
+ * @brief Decrements the counter; the last job wakes the helpers.
+ */
+void Strand::State::finish()
+{
+    if (outstanding.fetch_sub(1, std::memory_order_seq_cst) == 1)
+        pool.wakeHelpers();
+}
@@ -0,0 +1,112 @@
+/**
+ * @file        task.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Non-template parts of `Task`: the `IJob` adapter.
+ *
+ * @details
+ * An adapted job is stored as a `std::unique_ptr<IJob>` placed in the inline
+ * buffer, so wrapping an existing job never allocates.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "task.h"
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Owning pointer stored inline for adapted jobs.
+ */
+using JobPtr = std::unique_ptr<IJob>;
+
+static_assert(sizeof(JobPtr) <= Task::kInlineSize, "unique_ptr<IJob> must fit inline");
+
+template <typename Storage>
+JobPtr& jobOf(Storage& s)
+{
+    return *reinterpret_cast<JobPtr*>(&s);
+}
+
+template <typename Storage>
+const JobPtr& jobOf(const Storage& s)
+{
+    return *reinterpret_cast<const JobPtr*>(&s);
+}
+}  // namespace
+
+/*****************************************************************************/
+
+/* Static member initialization */
+
+const Task::Ops Task::jobOps = {
+    [](Storage& s) { jobOf(s)->execute(); },
+    [](Storage& dst, Storage& src) noexcept
+    {
+        ::new (static_cast<void*>(&dst)) JobPtr(std::move(jobOf(src)));
+        jobOf(src).~JobPtr();
+    },
+    [](Storage& s) noexcept { jobOf(s).~JobPtr(); },
+    [](const Storage& s) -> const char* { return typeid(*jobOf(s)).name(); },
+    [](Storage& s) noexcept -> IJob*
+    {
+        IJob* job = jobOf(s).release();
+        jobOf(s).~JobPtr();
+        return job;
+    },
+    nullptr,
+    nullptr,
+    true};
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Wraps `job` without allocating; a null job yields an empty Task.
+ */
+Task::Task(std::unique_ptr<IJob> job) : ops(nullptr), submitTicks(0)
+{
+    if (!job)
+        return;
+
+    ::new (static_cast<void*>(&storage)) JobPtr(std::move(job));
+    ops = &jobOps;
+}
+
+/**
+ * @brief Wraps `job` in a guarded callable (the pointer stays inline).
+ */
+Task::Task(std::unique_ptr<IJob> job, const JobGuard& guard) : ops(nullptr), submitTicks(0)
+{
+    if (!job)
+        return;
+
+    *this = Task([job = std::move(job)] { job->execute(); }, guard);
+}
+
+/**
+ * @brief Hands the callable back as an owning `IJob`.
+ */
+std::unique_ptr<IJob> Task::releaseJob()
+{
+    if (!ops)
+        return nullptr;
+
+    if (ops->release)
+    {
+        IJob* job = ops->release(storage);
+        ops       = nullptr;
+        return std::unique_ptr<IJob>(job);
+    }
+
+    return std::unique_ptr<IJob>(new TaskJob(std::move(*this)));
+}
@@ -0,0 +1,183 @@
+/**
+ * @file        task_future.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Non-template parts of the future shared block.
+ *
+ * @details
+ * Completion handshake: the producer sets `kReady` with one `fetch_or` and
+ * only takes the mutex if the previous flags show a waiter or a continuation.
+ * Waiters and `setContinuation()` set their own bit with a `fetch_or` under
+ * the mutex; whichever side observes the other's bit handles the hand-over,
+ * so nothing is lost and the common "submit, then get later" path pays no
+ * lock at all on the worker side.
+ *
+ * Inline continuations nest: the continuation completes its own state,
+ * which may launch the next one. A per-thread depth counter turns the
+ * nesting into a dispatch past `kMaxInlineDepth`.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "task_future.h"
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Static member initialization */
+
+constexpr unsigned FutureStateBase::kReady;
+constexpr unsigned FutureStateBase::kWaiter;
+constexpr unsigned FutureStateBase::kContinuation;
+constexpr unsigned FutureStateBase::kMaxInlineDepth;
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Inline continuations currently running on this thread.
+ */
+thread_local unsigned tlsInlineDepth = 0;
+
+/**
+ * @brief Counts one inline continuation for its lifetime.
+ */
+struct InlineScope
+{
+    InlineScope() { ++tlsInlineDepth; }
+    ~InlineScope() { --tlsInlineDepth; }
+};
+}  // namespace
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Starts pending with the caller's reference.
+ */
+FutureStateBase::FutureStateBase(IExecutor* executor) noexcept
+    : refs(1), flags(0), executor(executor)
+{
+}
+
+/**
+ * @brief Blocks until `kReady` is set.
+ */
+void FutureStateBase::wait()
+{
+    if (ready())
+        return;
+
+    std::unique_lock<std::mutex> lock(mtx);
+    if (flags.fetch_or(kWaiter, std::memory_order_acq_rel) & kReady)
+        return;
+
+    cv.wait(lock, [this] { return ready(); });
+}
+
+/**
+ * @brief Blocks until `kReady` is set or `deadline` passes.
+ */
+bool FutureStateBase::waitUntil(std::chrono::steady_clock::time_point deadline)
+{
+    if (ready())
+        return true;
+
+    std::unique_lock<std::mutex> lock(mtx);
+    if (flags.fetch_or(kWaiter, std::memory_order_acq_rel) & kReady)
+        return true;
+
+    return cv.wait_until(lock, deadline, [this] { return ready(); });
+}
+
+/**
+ * @brief Stores `e` and completes the state.
+ */
+void FutureStateBase::setError(std::exception_ptr e) noexcept
+{
+    error = std::move(e);
+    markReady();
+}
+
+/**
+ * @brief Stores the continuation, or launches it if the state is already ready.
+ */
+void FutureStateBase::setContinuation(Task task, bool runInline)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        continuation       = std::move(task);
+        inlineContinuation = runInline;
+        if (!(flags.fetch_or(kContinuation, std::memory_order_acq_rel) & kReady))
+            return;
+
+        task = std::move(continuation);
+    }
+
+    launch(std::move(task), runInline);
+}
+
+/*****************************************************************************/
+
+/* Protected Methods */
+
+/**
+ * @brief Publishes the result; slow path only if someone is listening.
+ */
+void FutureStateBase::markReady() noexcept
+{
+    const unsigned previous = flags.fetch_or(kReady, std::memory_order_acq_rel);
+    if (!(previous & (kWaiter | kContinuation)))
+        return;
+
+    Task next;
+    bool runInline = false;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (previous & kContinuation)
+        {
+            next      = std::move(continuation);
+            runInline = inlineContinuation;
+        }
+    }
+    cv.notify_all();
+
+    if (next)
+        launch(std::move(next), runInline);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Runs inline when asked and shallow enough, or without an executor;
+ *        dispatches otherwise.
+ */
+void FutureStateBase::launch(Task task, bool runInline) noexcept
+{
+    try
+    {
+        if (executor && !(runInline && tlsInlineDepth < kMaxInlineDepth))
+        {
+            executor->dispatch(std::move(task));
+            return;
+        }
+
+        InlineScope scope;
+        task();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(std::string("[Future] Continuation could not be scheduled: ") + e.what());
+    }
+}
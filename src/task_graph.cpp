@@ -0,0 +1,274 @@
+/**
+ * @file        task_graph.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of TaskGraph.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <future>
+
+/* Project libraries */
+
+#include "task_graph.h"
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Creates an empty graph.
+ */
+TaskGraph::TaskGraph(ThreadPool& pool) : pool(pool), outstanding(0), abandoned(false) {}
+
+/**
+ * @brief Waits for the current run, helping the pool meanwhile.
+ */
+TaskGraph::~TaskGraph()
+{
+    pool.helpUntilDone(outstanding);
+}
+
+/**
+ * @brief Wraps the job in a callable node.
+ */
+size_t TaskGraph::add(std::unique_ptr<IJob> job, std::initializer_list<size_t> predecessors)
+{
+    if (!job)
+    {
+        LOG_WARN("[Task Graph] Empty job added as a no-op node.");
+        return addNode(Task([] {}), predecessors);
+    }
+
+    return addNode(Task(std::move(job)), predecessors);
+}
+
+/**
+ * @brief Records the edge on both ends.
+ */
+bool TaskGraph::precede(size_t before, size_t after)
+{
+    if (pending() > 0)
+    {
+        LOG_WARN("[Task Graph] Edge ignored: a run is in progress.");
+        return false;
+    }
+    if (before >= nodes.size() || after >= nodes.size() || before == after)
+    {
+        LOG_WARN("[Task Graph] Edge ignored: unknown node or self edge.");
+        return false;
+    }
+
+    nodes[before]->successors.push_back(nodes[after].get());
+    ++nodes[after]->predecessors;
+    dirty = true;
+    return true;
+}
+
+/**
+ * @brief Resets the countdowns and releases the roots.
+ *
+ * @details
+ * `outstanding` covers every node before the first one is released, so
+ * the run cannot be seen as finished while roots are still being submitted.
+ */
+bool TaskGraph::run()
+{
+    if (pending() > 0)
+    {
+        LOG_WARN("[Task Graph] Run ignored: the previous run is still in progress.");
+        return false;
+    }
+    if (dirty && !validate())
+    {
+        LOG_ERROR("[Task Graph] Run refused: the dependencies form a cycle.");
+        return false;
+    }
+    if (nodes.empty())
+        return true;
+
+    for (auto& node : nodes)
+        node->countdown.store(node->predecessors, std::memory_order_relaxed);
+    abandoned.store(false, std::memory_order_relaxed);
+    outstanding.store(nodes.size(), std::memory_order_seq_cst);
+
+    for (Node* root : roots)
+        release(root);
+    return true;
+}
+
+/**
+ * @brief Helps until every node finished, then reports the first error.
+ */
+void TaskGraph::wait()
+{
+    pool.helpUntilDone(outstanding);
+
+    std::exception_ptr failure;
+    {
+        std::lock_guard<std::mutex> lock(errorMtx);
+        failure.swap(error);
+    }
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Appends the node, then one edge per predecessor.
+ */
+size_t TaskGraph::addNode(Task work, std::initializer_list<size_t> predecessors)
+{
+    const size_t id = nodes.size();
+    nodes.emplace_back(new Node(std::move(work), id));
+    dirty = true;
+
+    for (size_t before : predecessors)
+        precede(before, id);
+    return id;
+}
+
+/**
+ * @brief Kahn's algorithm: every node must be reachable by peeling off nodes without
+ *        unfinished predecessors.
+ */
+bool TaskGraph::validate()
+{
+    roots.clear();
+    std::vector<size_t> remaining(nodes.size());
+    std::vector<Node*>  ready;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        remaining[i] = nodes[i]->predecessors;
+        if (remaining[i] == 0)
+        {
+            roots.push_back(nodes[i].get());
+            ready.push_back(nodes[i].get());
+        }
+    }
+
+    size_t visited = 0;
+    while (!ready.empty())
+    {
+        Node* node = ready.back();
+        ready.pop_back();
+        ++visited;
+        for (Node* next : node->successors)
+        {
+            if (--remaining[next->id] == 0)
+                ready.push_back(next);
+        }
+    }
+
+    dirty = visited != nodes.size();
+    return !dirty;
+}
+
+/**
+ * @brief Runs the node, releases its successors and moves on to the first ready one.
+ *
+ * @details
+ * Every successor whose countdown reaches zero is released exactly once,
+ * by the thread that brought it there. A node is only counted as finished
+ * after its successors were released, so `outstanding` never reaches zero
+ * early and the last `finish()` is the last access to the graph.
+ */
+void TaskGraph::execute(Node* node)
+{
+    while (node != nullptr)
+    {
+        if (!abandoned.load(std::memory_order_acquire))
+        {
+            try
+            {
+                node->work();
+            }
+            catch (...)
+            {
+                fail(std::current_exception());
+            }
+        }
+
+        Node* next = nullptr;
+        for (Node* successor : node->successors)
+        {
+            if (successor->countdown.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                continue;
+            if (next == nullptr)
+                next = successor;
+            else
+                release(successor);
+        }
+
+        finish();
+        node = next;
+    }
+}
+
+/**
+ * @brief Dispatches a callable that runs the node (and its first released successors).
+ */
+void TaskGraph::release(Node* node)
+{
+    pool.dispatch(Task(Release(this, node)));
+}
+
+/**
+ * @brief Marks the run abandoned and settles what the node was holding back.
+ *
+ * @details
+ * Only reached when the pool refused or discarded a node, so the local
+ * work list may allocate.
+ */
+void TaskGraph::abandon(Node* node)
+{
+    abandoned.store(true, std::memory_order_release);
+    fail(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+
+    std::vector<Node*> settling{node};
+    while (!settling.empty())
+    {
+        Node* current = settling.back();
+        settling.pop_back();
+        for (Node* successor : current->successors)
+        {
+            if (successor->countdown.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                settling.push_back(successor);
+        }
+        finish();
+    }
+}
+
+/**
+ * @brief Keeps the first error only.
+ */
+void TaskGraph::fail(std::exception_ptr failure)
+{
+    std::lock_guard<std::mutex> lock(errorMtx);
+    if (!error)
+        error = std::move(failure);
+}
+
+/**
+ * @brief Decrements the counter; the last node wakes the helpers.
+ *
+ * @details
+ * The pool is read before the decrement: once it reaches zero the graph
+ * may be destroyed by the waiter.
+ */
+void TaskGraph::finish()
+{
+    ThreadPool& target = pool;
+    if (outstanding.fetch_sub(1, std::memory_order_seq_cst) == 1)
+        target.wakeHelpers();
+}
@@ -0,0 +1,111 @@
+/**
+ * @file        task_group.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of TaskGroup.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <future>
+
+/* Project libraries */
+
+#include "task_group.h"
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Creates an empty group.
+ */
+TaskGroup::TaskGroup(ThreadPool& pool) : state(std::make_shared<State>(pool)) {}
+
+/**
+ * @brief Waits for the outstanding jobs, helping the pool meanwhile.
+ */
+TaskGroup::~TaskGroup()
+{
+    state->pool.helpUntilDone(state->outstanding);
+}
+
+/**
+ * @brief Wraps the job in a callable and submits it.
+ */
+void TaskGroup::run(std::unique_ptr<IJob> job)
+{
+    if (!job)
+    {
+        LOG_WARN("[Task Group] Empty job ignored.");
+        return;
+    }
+
+    run([job = std::move(job)] { job->execute(); });
+}
+
+/**
+ * @brief Helps until the counter drops to zero, then reports the first error.
+ */
+void TaskGroup::wait()
+{
+    state->pool.helpUntilDone(state->outstanding);
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(state->errorMtx);
+        error.swap(state->error);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+/**
+ * @brief Returns the outstanding count.
+ */
+size_t TaskGroup::pending() const
+{
+    return state->outstanding.load(std::memory_order_acquire);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Keeps the first error only.
+ */
+void TaskGroup::State::fail(std::exception_ptr failure)
+{
+    std::lock_guard<std::mutex> lock(errorMtx);
+    if (!error)
+        error = std::move(failure);
+}
+
+/**
+ * @brief Decrements the counter; the last job wakes the helpers.
+ */
+void TaskGroup::State::finish()
+{
+    if (outstanding.fetch_sub(1, std::memory_order_seq_cst) == 1)
+        pool.wakeHelpers();
+}
+
+/**
+ * @brief Settles the job, as broken if it never ran.
+ */
+TaskGroup::Ticket::~Ticket()
+{
+    if (!state)
+        return;
+
+    if (!ran)
+        state->fail(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+    state->finish();
+}
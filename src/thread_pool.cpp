@@ -13,12 +13,380 @@
 
 /*****************************************************************************/
 
+/* Standard libraries */
+
+#include <algorithm>
+#include <type_traits>
+
 /* Project libraries */
 
 #include "thread_pool.h"
 
+#include "cache_line.h"
+#include "cpu_topology.h"
 #include "i_job.h"
+#include "job_queue.h"
 #include "logger.h"
+#include "numa_job_queue.h"
+#include "ring_job_queue.h"
+#include "spsc_ring.h"
+#include "work_stealing_deque.h"
+
+/*****************************************************************************/
+
+/* Worker state */
+
+/**
+ * @brief Metrics slot of one worker thread.
+ *
+ * @details
+ * Only the owning thread writes (load + store, no locked read-modify-write);
+ * `metrics()` reads concurrently. The padding keeps the hot counters off the
+ * cache lines of neighbouring heap blocks, so workers never false-share.
+ *
+ * The trace ring (only with `traceJobs`) has the worker as producer and
+ * `collectTrace()` as consumer.
+ */
+struct ThreadPool::WorkerStats
+{
+    /**
+     * @brief Increments a single-writer counter.
+     */
+    static void bump(std::atomic<size_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the counters and histograms.
+     */
+    WorkerMetrics snapshot() const
+    {
+        WorkerMetrics copy;
+        copy.executed  = executed.load(std::memory_order_relaxed);
+        copy.failed    = failed.load(std::memory_order_relaxed);
+        copy.stolen    = stolen.load(std::memory_order_relaxed);
+        copy.queueWait = queueWait.snapshot();
+        copy.execution = execution.snapshot();
+        copy.busy      = std::chrono::nanoseconds(copy.execution.sum());
+        return copy;
+    }
+
+    /**
+     * @brief Keeps the counters off the previous heap block's line.
+     */
+    char padFront[kCacheLineSize];
+
+    /**
+     * @brief Jobs run.
+     */
+    std::atomic<size_t> executed{0};
+
+    /**
+     * @brief Jobs that threw.
+     */
+    std::atomic<size_t> failed{0};
+
+    /**
+     * @brief Jobs stolen from other deques.
+     */
+    std::atomic<size_t> stolen{0};
+
+    /**
+     * @brief Trace events lost to a full ring.
+     */
+    std::atomic<size_t> traceDropped{0};
+
+    /**
+     * @brief Clock stamp of when the worker ran out of work; 0 while busy (only with `autoScale`).
+     */
+    std::atomic<int64_t> idleSince{0};
+
+    /**
+     * @brief Submission -> start, ns.
+     */
+    LatencyHistogram queueWait;
+
+    /**
+     * @brief Start -> end, ns.
+     */
+    LatencyHistogram execution;
+
+    /**
+     * @brief Job timeline (`nullptr` when not tracing).
+     */
+    std::unique_ptr<SpscRing<TraceEvent>> trace;
+
+    /**
+     * @brief Part of `traceDropped` already collected (consumer side).
+     */
+    size_t traceDroppedReported = 0;
+
+    /**
+     * @brief Keeps the slot off the next heap block's line.
+     */
+    char padBack[kCacheLineSize];
+};
+
+/**
+ * @brief Scheduling state owned by one work-stealing worker.
+ *
+ * @details
+ * The deque holds `Task*`, so each local job needs a cell. Cells come from
+ * per-worker slabs instead of the heap: the owner recycles the cells it
+ * pops into `freeBoxes`, and a thief hands a stolen cell back through the
+ * lock-free `returnedBoxes` stack, which the owner takes over in one
+ * exchange once its own list runs dry. Only pool workers touch the deques
+ * and all of them are joined before a `Worker` is destroyed.
+ */
+struct ThreadPool::Worker
+{
+    /**
+     * @brief Deque cell; free cells are chained through `next`.
+     */
+    struct Box
+    {
+        Task task;
+        Box* next = nullptr;
+    };
+
+    static_assert(std::is_standard_layout<Box>::value, "a deque Task* must map back to its Box");
+
+    /**
+     * @brief Cells allocated at once when the free lists are empty.
+     */
+    static constexpr size_t kBoxesPerSlab = 64;
+
+    Worker(size_t index, size_t batch_size, WorkerStats& stats)
+        : index(index),
+          inbox(batch_size),
+          spill(batch_size),
+          rngState(0x9E3779B97F4A7C15ULL * (index + 1)),
+          stats(stats),
+          freeBoxes(nullptr),
+          returnedBoxes(nullptr)
+    {
+    }
+
+    /**
+     * @brief Empties the deque; the tasks left are destroyed with their slab.
+     */
+    ~Worker()
+    {
+        while (deque.pop() != nullptr)
+        {
+        }
+    }
+
+    /**
+     * @brief Moves `task` into a free cell. Owner only.
+     */
+    Task* box(Task&& task)
+    {
+        if (freeBoxes == nullptr)
+            freeBoxes = returnedBoxes.exchange(nullptr, std::memory_order_acquire);
+        if (freeBoxes == nullptr)
+            addSlab();
+
+        Box* cell  = freeBoxes;
+        freeBoxes  = cell->next;
+        cell->task = std::move(task);
+        return &cell->task;
+    }
+
+    /**
+     * @brief Moves the task out of one of this worker's cells and frees the cell.
+     *
+     * @param boxed Cell taken from this worker's deque.
+     * @param task  Receives the task.
+     * @param owner Whether the caller owns this worker (otherwise it stole the cell).
+     */
+    void unbox(Task* boxed, Task& task, bool owner)
+    {
+        task      = std::move(*boxed);
+        Box* cell = reinterpret_cast<Box*>(boxed);
+
+        if (owner)
+        {
+            cell->next = freeBoxes;
+            freeBoxes  = cell;
+            return;
+        }
+
+        cell->next = returnedBoxes.load(std::memory_order_relaxed);
+        while (!returnedBoxes.compare_exchange_weak(cell->next, cell, std::memory_order_release,
+                                                    std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * @brief xorshift64 step, used to pick steal victims.
+     */
+    uint64_t nextRandom()
+    {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 7;
+        rngState ^= rngState << 17;
+        return rngState;
+    }
+
+    /**
+     * @brief Allocates `kBoxesPerSlab` cells into `freeBoxes` (empty). Owner only.
+     */
+    void addSlab()
+    {
+        slabs.emplace_back(new Box[kBoxesPerSlab]);
+        Box* slab = slabs.back().get();
+        for (size_t i = 0; i + 1 < kBoxesPerSlab; ++i)
+            slab[i].next = &slab[i + 1];
+        freeBoxes = slab;
+    }
+
+    const size_t       index;    /**< Position in `ThreadPool::workers`. */
+    WorkStealingDeque  deque;    /**< Local jobs; stolen from by other workers. */
+    std::vector<Task>  inbox;    /**< Landing area of a batch popped from the shared queue. */
+    std::vector<Task*> spill;    /**< Cells of the batch moved onto the deque, newest first. */
+    uint64_t           rngState; /**< Victim selection RNG (owner only). */
+    WorkerStats&       stats;    /**< Metrics slot of the owning thread. */
+
+    std::vector<std::unique_ptr<Box[]>> slabs;         /**< Storage of every cell (owner only). */
+    Box*                                freeBoxes;     /**< Cells ready for reuse (owner only). */
+    std::atomic<Box*>                   returnedBoxes; /**< Cells handed back by thieves. */
+};
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Spin phase of idle workers; no spinning on a single-CPU host.
+ */
+SpinPolicy idleSpinPolicy(const ThreadPoolConfig& config)
+{
+    SpinPolicy policy;
+    policy.maxSpins = std::thread::hardware_concurrency() > 1 ? config.idleSpinLimit : 0;
+    policy.yields   = config.idleYields;
+    policy.adaptive = config.idleSpinAdaptive;
+    return policy;
+}
+
+/**
+ * @brief Builds the shared queue requested by the configuration.
+ */
+std::unique_ptr<IJobQueue> makeQueue(const ThreadPoolConfig& config)
+{
+    const SpinPolicy spin = idleSpinPolicy(config);
+    switch (config.queueBackend)
+    {
+        case ThreadPoolConfig::QueueBackend::LockFreeRing:
+            return std::make_unique<RingJobQueue>(config.queueCapacity, spin);
+        case ThreadPoolConfig::QueueBackend::NumaSharded:
+            return std::make_unique<NumaJobQueue>(CpuTopology::detect(), config.priorityAging,
+                                                  spin);
+        case ThreadPoolConfig::QueueBackend::Mutex:
+        default:
+            return std::make_unique<JobQueue>(config.priorityAging, spin);
+    }
+}
+
+/**
+ * @brief Size of a worker's batch buffer (`workerBatchSize`, at least 1).
+ */
+size_t batchCapacity(const ThreadPoolConfig& config)
+{
+    return config.workerBatchSize > 0 ? config.workerBatchSize : 1;
+}
+
+/**
+ * @brief CPUs the workers are pinned to, in worker order (empty = no pinning).
+ */
+std::vector<int> placementOf(const ThreadPoolConfig& config)
+{
+    using Placement = ThreadPoolConfig::CpuPlacement;
+
+    if (config.cpuPlacement == Placement::None)
+        return {};
+    if (config.cpuPlacement == Placement::Explicit)
+        return config.cpuList;
+
+    CpuTopology topology = CpuTopology::detect();
+    if (config.cpuPackage >= 0)
+        topology = topology.onPackage(config.cpuPackage);
+    if (config.physicalCoresOnly)
+        topology = topology.physicalCores();
+
+    return config.cpuPlacement == Placement::Compact ? topology.compactOrder()
+                                                     : topology.scatterOrder();
+}
+
+/**
+ * @brief Current steady-clock time as a `Task` submission stamp.
+ */
+int64_t clockTicks()
+{
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+/**
+ * @brief Adds `from` into `into`.
+ */
+void accumulate(ThreadPool::WorkerMetrics& into, const ThreadPool::WorkerMetrics& from)
+{
+    into.executed += from.executed;
+    into.failed += from.failed;
+    into.stolen += from.stolen;
+    into.busy += from.busy;
+    into.queueWait.merge(from.queueWait);
+    into.execution.merge(from.execution);
+}
+
+/**
+ * @brief Pool whose worker is running on the current thread (if any).
+ */
+thread_local const ThreadPool* tlsPool = nullptr;
+
+/**
+ * @brief Index of the current thread in `tlsPool`'s worker list (work-stealing mode only).
+ */
+thread_local size_t tlsWorkerIndex = 0;
+
+/**
+ * @brief `ThreadPool::WorkerStats` slot of the current worker thread (if any).
+ *
+ * @details
+ * Type-erased because the slot type is private to ThreadPool.
+ */
+thread_local void* tlsWorkerStats = nullptr;
+
+/**
+ * @brief Log name of the current worker thread (if any).
+ */
+thread_local const std::string* tlsWorkerName = nullptr;
+
+/**
+ * @brief Log names of jobs run outside a worker.
+ */
+const std::string kCallerName = "caller";
+const std::string kHelperName = "helper";
+
+/**
+ * @brief Rest of the batch a shared-queue worker is running, `[next, end)`.
+ *
+ * @details
+ * Those tasks left the queue with the running one; a job of the batch that
+ * waits in `ThreadPool::helpUntilDone()` takes them from here.
+ */
+struct BatchCursor
+{
+    Task* next = nullptr;
+    Task* end  = nullptr;
+};
+
+thread_local BatchCursor tlsBatch;
+}  // namespace
 
 /*****************************************************************************/
 
@@ -27,7 +395,43 @@
 /**
  * @brief Creates a non-running thread pool.
  */
-ThreadPool::ThreadPool() : running(false) {}
+ThreadPool::ThreadPool() : ThreadPool(ThreadPoolConfig{}) {}
+
+/**
+ * @brief Creates a non-running thread pool using the given queue backend.
+ */
+ThreadPool::ThreadPool(const ThreadPoolConfig& config)
+    : config(config),
+      queue(makeQueue(config)),
+      numaQueue(dynamic_cast<NumaJobQueue*>(queue.get())),
+      running(false),
+      workerCount(0),
+      workerSlots(0),
+      slotCapacity(0),
+      targetWorkers(0),
+      retireRequests(0),
+      scalerStop(false),
+      parkedWorkers(0),
+      idleSpin(idleSpinPolicy(config)),
+      pendingJobs(0),
+      completedJobs(0),
+      stopping(false),
+      draining(false),
+      discardQueued(false),
+      reclaimQueued(false),
+      queuedJobs(0),
+      blockedProducers(0),
+      blockedCount(0),
+      timedOutCount(0),
+      rejectedCount(0),
+      droppedOldestCount(0),
+      callerRunsCount(0),
+      cancelledCount(0),
+      expiredCount(0),
+      retiredUptime(0),
+      waitingHelpers(0)
+{
+}
 
 /**
  * @brief Ensures all worker threads are stopped and joined.
@@ -42,25 +446,76 @@ ThreadPool::~ThreadPool()
  */
 void ThreadPool::start(size_t number_threads)
 {
+    std::lock_guard<std::mutex> lock(resizeMtx);
     if (running)
         return;
 
     running = true;
+    stopping.store(false, std::memory_order_release);
     if (number_threads == 0)
         number_threads = 1;
-    Logger::info("[Thread Pool] Starting " + std::to_string(number_threads) + " threads");
+    LOG_INFO("[Thread Pool] Starting " + std::to_string(number_threads) + " threads");
+
+    const size_t maxThreads =
+        config.maxThreads != 0 ? config.maxThreads
+                               : std::max<size_t>(1, std::thread::hardware_concurrency());
+    slotCapacity = std::max(number_threads, maxThreads);
+    slotBusy.reset(new std::atomic<bool>[slotCapacity]);
+    threads.reserve(slotCapacity);
+    if (config.schedulingMode == ThreadPoolConfig::SchedulingMode::WorkStealing)
+        workers.reserve(slotCapacity);
+
+    {
+        std::lock_guard<std::mutex> metricsLock(metricsMtx);
+        startedAt = std::chrono::steady_clock::now();
+    }
+
+    placement = placementOf(config);
+    if (config.cpuPlacement != ThreadPoolConfig::CpuPlacement::None && placement.empty())
+        LOG_WARN("[Thread Pool] No CPU matches the placement; workers are not pinned.");
+
+    targetWorkers = number_threads;
     for (size_t i = 0; i < number_threads; ++i)
+        launchWorker();
+
+    if (config.autoScale)
     {
-        threads.emplace_back([this, i]() { threadLoop("Thread " + std::to_string(i)); });
+        scalerStop = false;
+        scaler     = std::thread([this] { scaleLoop(); });
     }
 }
 
+/**
+ * @brief Locks out `start()` / `join()` and resizes.
+ */
+void ThreadPool::resize(size_t number_threads)
+{
+    std::lock_guard<std::mutex> lock(resizeMtx);
+    resizeLocked(number_threads);
+}
+
 /**
  * @brief Enqueues a job for later execution.
  */
 void ThreadPool::enqueue(std::unique_ptr<IJob> job)
 {
-    queue.push(std::move(job));
+    dispatch(Task(std::move(job)));
+}
+
+/**
+ * @brief Enqueues a job into the lane of `priority`.
+ */
+void ThreadPool::enqueue(std::unique_ptr<IJob> job, JobPriority priority)
+{
+    admit(Task(std::move(job)), priority);
+}
+
+/**
+ * @brief Enqueues a job carrying its guard.
+ */
+void ThreadPool::enqueue(std::unique_ptr<IJob> job, const JobGuard& guard)
+{
+    dispatch(Task(std::move(job), guard));
 }
 
 /**
@@ -70,70 +525,243 @@ bool ThreadPool::tryEnqueue(std::unique_ptr<IJob> job)
 {
     if (!running.load(std::memory_order_acquire))
     {
-        Logger::warn("[ThreadPool] Job rejected: pool not running.");
+        LOG_WARN("[ThreadPool] Job rejected: pool not running.");
         return false;
     }
 
-    if (queue.is_closed())
+    if (queue->is_closed())
     {
-        Logger::warn("[ThreadPool] Job rejected: queue is closed.");
+        LOG_WARN("[ThreadPool] Job rejected: queue is closed.");
         return false;
     }
 
-    queue.push(std::move(job));
-    return true;
+    return admit(Task(std::move(job)));
 }
 
 /**
- * @brief Gracefully shuts down the pool.
+ * @brief Publishes a batch of jobs with one shared-queue operation.
  */
-void ThreadPool::shutdown()
+void ThreadPool::enqueueBatch(std::vector<std::unique_ptr<IJob>> jobs)
 {
-    if (!running)
+    const bool stealing =
+        config.schedulingMode == ThreadPoolConfig::SchedulingMode::WorkStealing;
+
+    const bool ring = config.queueBackend == ThreadPoolConfig::QueueBackend::LockFreeRing;
+
+    if (stopping.load(std::memory_order_acquire) && tlsPool != this)
     {
+        LOG_WARN("[Thread Pool] Jobs rejected: pool is shutting down.");
         return;
     }
 
+    if (config.maxQueuedJobs > 0 || ((stealing || ring) && tlsPool == this))
+    {
+        // Per-job admission keeps the overflow policy, local-deque routing and
+        // the full-ring fallback of worker submissions
+        for (auto& job : jobs)
+            admit(Task(std::move(job)));
+        return;
+    }
+
+    std::vector<Task> tasks;
+    tasks.reserve(jobs.size());
+    for (auto& job : jobs)
+    {
+        if (job)
+        {
+            tasks.emplace_back(std::move(job));
+            stamp(tasks.back());
+        }
+        else
+            LOG_WARN("[Thread Pool] Empty job ignored.");
+    }
+
+    if (tasks.empty())
+        return;
+
+    // Counted before they become visible, so a worker can never decrement first
+    pendingJobs.fetch_add(tasks.size(), std::memory_order_relaxed);
+    queue->pushTasks(tasks.data(), tasks.size());
+
+    if (stealing)
+    {
+        if (tasks.size() == 1)
+            wakeIdleWorker();
+        else
+            wakeAllWorkers();
+    }
+    wakeHelpers();
+}
+
+/**
+ * @brief Enqueues a job and returns a future tracking its completion.
+ */
+TaskFuture<void> ThreadPool::submit(std::unique_ptr<IJob> job)
+{
+    TaskFuture<void> future;
+
+    if (!job)
+    {
+        LOG_WARN("[Thread Pool] Empty job ignored.");
+        // Dropping the Task completes the future with broken_promise
+        makeFutureTask<void>(this, [] {}, future);
+        return future;
+    }
+
+    dispatch(makeFutureTask<void>(
+        this, [job = std::move(job)] { job->execute(); }, future));
+    return future;
+}
+
+/**
+ * @brief Arms a one-shot timer that enqueues `job` at `when`.
+ */
+TimerHandle ThreadPool::scheduleAt(std::chrono::steady_clock::time_point when,
+                                   std::unique_ptr<IJob>                 job)
+{
+    if (!job)
+    {
+        LOG_WARN("[Thread Pool] Empty job ignored.");
+        return TimerHandle();
+    }
+
+    std::lock_guard<std::mutex> lock(timerMtx);
+    TimerWheel*                 wheel = timers();
+    if (!wheel)
+        return TimerHandle();
+    return wheel->scheduleAt(when, Task(std::move(job)));
+}
+
+/**
+ * @brief Gracefully shuts down the pool without a deadline.
+ */
+ThreadPool::ShutdownReport ThreadPool::shutdown()
+{
+    return shutdown(std::chrono::steady_clock::time_point::max());
+}
+
+/**
+ * @brief Gracefully shuts down the pool, abandoning queued jobs at `deadline`.
+ *
+ * @details
+ * Drain handshake (same shape as the parking one): this thread raises
+ * `draining` then re-checks `pendingJobs` under `drainMtx`; a worker
+ * decrements `pendingJobs` then notifies under `drainMtx` only if it sees
+ * `draining`. One of the two always observes the other.
+ */
+ThreadPool::ShutdownReport ThreadPool::shutdown(std::chrono::steady_clock::time_point deadline)
+{
+    ShutdownReport report;
+    if (!running)
+    {
+        return report;
+    }
+
+    // Raised first, so anyone who sees `isRunning() == false` is refused
+    stopping.store(true, std::memory_order_release);
     running = false;
+    stopTimers();
+    stopScaler();
 
-    Logger::info("[Thread Pool] Shutdown requested...");
+    LOG_INFO("[Thread Pool] Shutdown requested...");
 
-    auto start = std::chrono::steady_clock::now();
-    while (!queue.empty())
+    const size_t completedBefore = completedJobs.load(std::memory_order_acquire);
+    draining.store(true, std::memory_order_seq_cst);
     {
-        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        std::unique_lock<std::mutex> lock(drainMtx);
+        auto drained = [this] { return pendingJobs.load(std::memory_order_seq_cst) == 0; };
 
-        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(1))
-        {
-            Logger::warn("[Thread Pool] Timeout waiting for queue to drain.");
-            break;
-        }
+        if (deadline == std::chrono::steady_clock::time_point::max())
+            drainCv.wait(lock, drained);
+        else
+            report.drained = drainCv.wait_until(lock, deadline, drained);
+    }
+
+    if (!report.drained)
+    {
+        LOG_WARN("[Thread Pool] Drain deadline reached, abandoning queued jobs.");
+        discardQueued.store(true, std::memory_order_release);
     }
 
-    queue.shutdown();
+    queue->shutdown();
+    wakeAllWorkers();
+    {
+        std::lock_guard<std::mutex> lock(spaceMtx);
+        spaceCv.notify_all();
+    }
 
     join();
-    Logger::info("[Thread Pool] All threads joined. Shutdown complete.");
+    writeTraceFile();
+    draining.store(false, std::memory_order_relaxed);
+    discardQueued.store(false, std::memory_order_relaxed);
+
+    report.completed = completedJobs.load(std::memory_order_acquire) - completedBefore;
+    report.abandoned = pendingJobs.exchange(0, std::memory_order_acq_rel);
+    queuedJobs.store(0, std::memory_order_relaxed);
+
+    LOG_INFO("[Thread Pool] All threads joined. Shutdown complete (" +
+             std::to_string(report.completed) + " completed, " +
+             std::to_string(report.abandoned) + " abandoned).");
+    return report;
 }
 
 /**
- * @brief Immediately stops all threads, discarding queued jobs.
+ * @brief Immediately stops all threads, handing back the queued jobs.
+ *
+ * @details
+ * Raising `reclaimQueued` before closing the queue makes every worker, and
+ * every helping thread, move what it pops into `reclaimed` instead of
+ * running it; the workers still search until no work is visible anywhere,
+ * so the shared queue and the deques end up empty. Whatever is left in the
+ * shared queue after the join (e.g. with no worker alive) is taken here.
  */
-void ThreadPool::shutdownNow()
+std::vector<std::unique_ptr<IJob>> ThreadPool::shutdownNow()
 {
+    std::vector<std::unique_ptr<IJob>> unexecuted;
     if (!running)
     {
-        return;
+        return unexecuted;
     }
 
+    // Raised first, so anyone who sees `isRunning() == false` is refused
+    stopping.store(true, std::memory_order_release);
     running = false;
+    stopTimers();
+    stopScaler();
 
-    Logger::info("[Thread Pool] Shutdown requested...");
+    LOG_INFO("[Thread Pool] Shutdown requested...");
 
-    queue.shutdown();
+    reclaimQueued.store(true, std::memory_order_release);
+    queue->shutdown();
+    wakeAllWorkers();
+    wakeHelpers();
+    {
+        std::lock_guard<std::mutex> lock(spaceMtx);
+        spaceCv.notify_all();
+    }
 
     join();
-    Logger::info("[Thread Pool] All threads joined. Shutdown complete.");
+    writeTraceFile();
+
+    std::vector<Task> leftovers;
+    {
+        std::lock_guard<std::mutex> lock(reclaimMtx);
+        leftovers.swap(reclaimed);
+    }
+    Task task;
+    while (queue->tryPopTasks(&task, 1) == 1)
+        leftovers.push_back(std::move(task));
+
+    unexecuted.reserve(leftovers.size());
+    for (auto& leftover : leftovers)
+        unexecuted.push_back(leftover.releaseJob());
+
+    reclaimQueued.store(false, std::memory_order_relaxed);
+    pendingJobs.store(0, std::memory_order_relaxed);
+    queuedJobs.store(0, std::memory_order_relaxed);
+    LOG_INFO("[Thread Pool] All threads joined. Shutdown complete (" +
+             std::to_string(unexecuted.size()) + " job(s) handed back).");
+    return unexecuted;
 }
 
 /**
@@ -141,14 +769,37 @@ void ThreadPool::shutdownNow()
  */
 void ThreadPool::join()
 {
-    for (auto& thread : threads)
+    // Joined outside `resizeMtx`: the auto-scaler may be waiting for it.
+    std::vector<std::thread> stopped;
+    {
+        std::lock_guard<std::mutex> lock(resizeMtx);
+        stopped.swap(threads);
+    }
+    for (auto& thread : stopped)
     {
         if (thread.joinable())
         {
             thread.join();
         }
     }
-    threads.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(resizeMtx);
+        stopped.clear();
+        threads.swap(stopped);
+        workerSlots.store(0, std::memory_order_relaxed);
+        workers.clear();
+        workerCount.store(0, std::memory_order_relaxed);
+        retireRequests.store(0, std::memory_order_relaxed);
+        targetWorkers = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(metricsMtx);
+    if (startedAt != std::chrono::steady_clock::time_point())
+    {
+        retiredUptime += std::chrono::steady_clock::now() - startedAt;
+        startedAt = std::chrono::steady_clock::time_point();
+    }
 }
 
 /**
@@ -156,7 +807,7 @@ void ThreadPool::join()
  */
 size_t ThreadPool::size() const
 {
-    return threads.size();
+    return workerCount.load(std::memory_order_relaxed);
 }
 
 /**
@@ -167,40 +818,1077 @@ bool ThreadPool::isRunning() const
     return running;
 }
 
-/*****************************************************************************/
+/**
+ * @brief Returns the number of accepted, unfinished jobs.
+ */
+size_t ThreadPool::pending() const
+{
+    return pendingJobs.load(std::memory_order_relaxed);
+}
 
-/* Private Methods */
+/**
+ * @brief Returns a snapshot of the backpressure counters.
+ */
+ThreadPool::BackpressureStats ThreadPool::backpressureStats() const
+{
+    BackpressureStats stats;
+    stats.blocked       = blockedCount.load(std::memory_order_relaxed);
+    stats.timedOut      = timedOutCount.load(std::memory_order_relaxed);
+    stats.rejected      = rejectedCount.load(std::memory_order_relaxed);
+    stats.droppedOldest = droppedOldestCount.load(std::memory_order_relaxed);
+    stats.callerRuns    = callerRunsCount.load(std::memory_order_relaxed);
+    return stats;
+}
 
 /**
- * @brief Worker execution loop.
- *
- * @details
- * Each worker:
- *  - Blocks on queue.pop()
- *  - Exits when pop() returns nullptr (queue closed)
- *  - Catches exceptions thrown by jobs to avoid worker death
+ * @brief Reads every slot and merges them into the totals.
  */
-void ThreadPool::threadLoop(const std::string& worker_name)
+ThreadPool::Metrics ThreadPool::metrics() const
 {
-    Logger::info("[" + worker_name + "] Started");
+    Metrics result;
+    result.pending   = pendingJobs.load(std::memory_order_relaxed);
+    result.cancelled = cancelledCount.load(std::memory_order_relaxed);
+    result.expired   = expiredCount.load(std::memory_order_relaxed);
 
-    while (true)
-    {
-        std::unique_ptr<IJob> job = queue.pop();
+    std::lock_guard<std::mutex> lock(metricsMtx);
+    result.uptime = retiredUptime;
+    if (startedAt != std::chrono::steady_clock::time_point())
+        result.uptime += std::chrono::steady_clock::now() - startedAt;
 
-        if (!job)
-            break;
+    result.workers.reserve(workerStats.size());
+    for (const auto& stats : workerStats)
+    {
+        result.workers.push_back(stats->snapshot());
+        accumulate(result.total, result.workers.back());
+    }
+    return result;
+}
 
-        try
+/**
+ * @brief Drains every worker's trace ring.
+ */
+JobTrace ThreadPool::collectTrace()
+{
+    JobTrace trace;
+
+    std::lock_guard<std::mutex> traceLock(traceMtx);
+    std::lock_guard<std::mutex> lock(metricsMtx);
+    for (size_t i = 0; i < workerStats.size(); ++i)
+    {
+        WorkerStats& stats = *workerStats[i];
+        if (!stats.trace)
+            continue;
+
+        stats.trace->consume([&trace, i](const TraceEvent& event) { trace.add(i, event); });
+
+        const size_t dropped = stats.traceDropped.load(std::memory_order_relaxed);
+        trace.addDropped(dropped - stats.traceDroppedReported);
+        stats.traceDroppedReported = dropped;
+    }
+    return trace;
+}
+
+/**
+ * @brief Collects the trace and writes it to `path`.
+ */
+bool ThreadPool::dumpTrace(const std::string& path)
+{
+    const JobTrace trace = collectTrace();
+    if (!trace.writeFile(path))
+    {
+        LOG_ERROR("[Thread Pool] Could not write trace to " + path);
+        return false;
+    }
+
+    LOG_INFO("[Thread Pool] Trace with " + std::to_string(trace.size()) + " event(s) written to " +
+             path);
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief IExecutor entry point: same as `admit()`, result ignored.
+ */
+void ThreadPool::dispatch(Task task)
+{
+    admit(std::move(task));
+}
+
+/**
+ * @brief Sends a task to the shared queue, or to the local deque when called
+ *        from one of this pool's work-stealing workers, applying backpressure
+ *        to outside submitters when the shared queue is bounded.
+ *
+ * @details
+ * Deques have no lanes, so a worker's submission with an explicit priority
+ * other than `Normal` goes to the shared queue where its lane is honoured.
+ * A worker never waits for room in a full ring, which only the workers
+ * drain: it runs the job itself instead.
+ */
+bool ThreadPool::admit(Task task, JobPriority priority)
+{
+    if (!task)
+    {
+        LOG_WARN("[Thread Pool] Empty job ignored.");
+        return false;
+    }
+
+    const bool stealing =
+        config.schedulingMode == ThreadPoolConfig::SchedulingMode::WorkStealing;
+    const bool fromWorker = tlsPool == this;
+
+    if (stopping.load(std::memory_order_acquire) && !fromWorker)
+    {
+        LOG_WARN("[Thread Pool] Job rejected: pool is shutting down.");
+        return false;
+    }
+
+    stamp(task);
+
+    if (stealing && fromWorker && priority == JobPriority::Normal)
+    {
+        pendingJobs.fetch_add(1, std::memory_order_relaxed);
+        Worker& worker = *workers[tlsWorkerIndex];
+        worker.deque.push(worker.box(std::move(task)));
+        wakeIdleWorker();
+        wakeHelpers();
+        return true;
+    }
+
+    if (config.maxQueuedJobs > 0)
+    {
+        if (fromWorker)
+        {
+            // Never block a worker on its own pool: overshoot the bound instead
+            queuedJobs.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (!tryReserveSlot())
+        {
+            switch (config.overflowPolicy)
+            {
+                case ThreadPoolConfig::OverflowPolicy::Reject:
+                    rejectedCount.fetch_add(1, std::memory_order_relaxed);
+                    LOG_WARN("[Thread Pool] Job rejected: queue full.");
+                    return false;
+
+                case ThreadPoolConfig::OverflowPolicy::CallerRuns:
+                    // Settled like a helper-run job: guard checked, completion counted
+                    callerRunsCount.fetch_add(1, std::memory_order_relaxed);
+                    pendingJobs.fetch_add(1, std::memory_order_relaxed);
+                    runTask(task, kCallerName, nullptr);
+                    return true;
+
+                case ThreadPoolConfig::OverflowPolicy::DropOldest:
+                {
+                    // The victim's slot is handed over to the new task
+                    Task victim;
+                    if (queue->tryPopVictim(victim))
+                    {
+                        droppedOldestCount.fetch_add(1, std::memory_order_relaxed);
+                        victim.reset();
+                        finishPending();
+                        break;
+                    }
+
+                    // The slots belong to jobs already leaving the queue: wait like Block
+                    if (!waitForSlot())
+                    {
+                        rejectedCount.fetch_add(1, std::memory_order_relaxed);
+                        LOG_WARN("[Thread Pool] Job rejected: queue full, no job left to drop.");
+                        return false;
+                    }
+                    break;
+                }
+
+                case ThreadPoolConfig::OverflowPolicy::Block:
+                    blockedCount.fetch_add(1, std::memory_order_relaxed);
+                    if (!waitForSlot())
+                    {
+                        timedOutCount.fetch_add(1, std::memory_order_relaxed);
+                        LOG_WARN("[Thread Pool] Job rejected: timed out waiting for queue space.");
+                        return false;
+                    }
+                    break;
+            }
+        }
+    }
+
+    // Counted before it becomes visible, so a worker can never decrement first
+    pendingJobs.fetch_add(1, std::memory_order_relaxed);
+    if (!fromWorker)
+        queue->pushPriorityTask(std::move(task), priority);
+    else if (!queue->tryPushPriorityTask(task, priority))
+    {
+        // A full ring waits for the workers; this one may be the only one, so run it here
+        releaseSlots(1);
+        runTask(task, *tlsWorkerName, static_cast<WorkerStats*>(tlsWorkerStats));
+        return true;
+    }
+
+    if (stealing)
+        wakeIdleWorker();
+    wakeHelpers();
+    return true;
+}
+
+/**
+ * @brief CAS loop claiming a slot below `maxQueuedJobs`.
+ */
+bool ThreadPool::tryReserveSlot()
+{
+    size_t current = queuedJobs.load(std::memory_order_relaxed);
+    while (current < config.maxQueuedJobs)
+    {
+        if (queuedJobs.compare_exchange_weak(current, current + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Blocks until a slot is claimed, the timeout expires or the queue closes.
+ *
+ * @details
+ * Same handshake as worker parking: the producer announces itself in
+ * `blockedProducers` before re-checking under `spaceMtx`; `releaseSlots()`
+ * frees the slot before checking `blockedProducers`.
+ */
+bool ThreadPool::waitForSlot()
+{
+    blockedProducers.fetch_add(1, std::memory_order_seq_cst);
+
+    bool reserved = false;
+    auto ready    = [&]
+    {
+        reserved = tryReserveSlot();
+        return reserved || queue->is_closed();
+    };
+
+    {
+        std::unique_lock<std::mutex> lock(spaceMtx);
+        if (config.blockTimeout.count() == 0)
+            spaceCv.wait(lock, ready);
+        else
+            spaceCv.wait_for(lock, config.blockTimeout, ready);
+    }
+
+    blockedProducers.fetch_sub(1, std::memory_order_relaxed);
+    return reserved;
+}
+
+/**
+ * @brief Frees `count` slots of the bounded shared queue.
+ */
+void ThreadPool::releaseSlots(size_t count)
+{
+    if (config.maxQueuedJobs == 0 || count == 0)
+        return;
+
+    queuedJobs.fetch_sub(count, std::memory_order_seq_cst);
+    if (blockedProducers.load(std::memory_order_seq_cst) == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(spaceMtx);
+    if (count == 1)
+        spaceCv.notify_one();
+    else
+        spaceCv.notify_all();
+}
+
+/**
+ * @brief Arms a periodic timer; each period dispatches a run of the shared job.
+ */
+TimerHandle ThreadPool::scheduleRepeating(std::chrono::steady_clock::duration period,
+                                          std::unique_ptr<IJob>               job)
+{
+    if (!job)
+    {
+        LOG_WARN("[Thread Pool] Empty job ignored.");
+        return TimerHandle();
+    }
+
+    std::lock_guard<std::mutex> lock(timerMtx);
+    TimerWheel*                 wheel = timers();
+    if (!wheel)
+        return TimerHandle();
+
+    std::shared_ptr<IJob> shared(std::move(job));
+    return wheel->scheduleEvery(period, Task([shared] { shared->execute(); }));
+}
+
+/**
+ * @brief Lazily builds the wheel; refuses while the pool is not running.
+ */
+TimerWheel* ThreadPool::timers()
+{
+    if (!running.load(std::memory_order_acquire))
+    {
+        LOG_WARN("[Thread Pool] Timer rejected: pool not running.");
+        return nullptr;
+    }
+
+    if (!timerWheel)
+        timerWheel.reset(new TimerWheel(*this, config.timerTick));
+    return timerWheel.get();
+}
+
+/**
+ * @brief Stops the timer thread before the queue is drained or closed.
+ */
+void ThreadPool::stopTimers()
+{
+    std::lock_guard<std::mutex> lock(timerMtx);
+    timerWheel.reset();
+}
+
+/**
+ * @brief Sets the submission stamp read back by `runTask()`.
+ */
+void ThreadPool::stamp(Task& task) const
+{
+    if (config.collectMetrics || config.traceJobs)
+        task.setSubmitTime(clockTicks());
+}
+
+/**
+ * @brief Dumps the trace once the workers are joined.
+ */
+void ThreadPool::writeTraceFile()
+{
+    if (config.traceJobs && !config.traceFile.empty())
+        dumpTrace(config.traceFile);
+}
+
+/**
+ * @brief Settles one accepted job; wakes `shutdown()` on the last one while draining.
+ */
+void ThreadPool::finishPending()
+{
+    if (pendingJobs.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+        draining.load(std::memory_order_seq_cst))
+    {
+        std::lock_guard<std::mutex> lock(drainMtx);
+        drainCv.notify_all();
+    }
+}
+
+/**
+ * @brief Node of the worker's CPU, or node `index % nodes` (and its CPUs) when unpinned.
+ */
+void ThreadPool::joinNode(const std::string& worker_name, size_t index, int cpu)
+{
+    const size_t shard = cpu >= 0 ? numaQueue->shardOf(cpu) : index % numaQueue->shardCount();
+    numaQueue->bindCurrentThread(shard);
+
+    if (cpu < 0 && !numaQueue->cpusOf(shard).empty() &&
+        !CpuTopology::pinCurrentThread(numaQueue->cpusOf(shard)))
+    {
+        LOG_WARN("[" + worker_name + "] Could not restrict to the CPUs of NUMA node " +
+                 std::to_string(numaQueue->nodeOf(shard)));
+    }
+    LOG_DEBUG("[" + worker_name + "] Serving NUMA node " +
+              std::to_string(numaQueue->nodeOf(shard)));
+}
+
+/**
+ * @brief Picks a slot, creating its metrics and deque the first time, and starts its thread.
+ *
+ * @details
+ * A slot is free once its thread cleared `slotBusy`; that thread has left
+ * `threadLoop()` and is joined here before the slot is reused. If every
+ * slot is still busy, some of them belong to workers that claimed a
+ * retirement and are about to clear their flag, so the caller spins
+ * briefly (they never need `resizeMtx` to exit).
+ */
+void ThreadPool::launchWorker()
+{
+    const bool stealing = config.schedulingMode == ThreadPoolConfig::SchedulingMode::WorkStealing;
+
+    size_t slot = 0;
+    while (true)
+    {
+        while (slot < threads.size() && slotBusy[slot].load(std::memory_order_acquire))
+            ++slot;
+        if (slot < slotCapacity)
+            break;
+        slot = 0;
+        std::this_thread::yield();
+    }
+
+    if (slot == threads.size())
+    {
         {
-            job->execute();
+            std::lock_guard<std::mutex> lock(metricsMtx);
+            if (workerStats.size() <= slot)
+            {
+                workerStats.emplace_back(new WorkerStats);
+                if (config.traceJobs)
+                    workerStats.back()->trace.reset(
+                        new SpscRing<TraceEvent>(config.traceCapacity));
+            }
         }
-        catch (const std::exception& e)
+        threads.emplace_back();
+        if (stealing)
         {
-            Logger::error("[Thread Pool][" + worker_name + "] Exception: " + e.what());
+            workers.emplace_back(new Worker(slot, batchCapacity(config), *workerStats[slot]));
+            workerSlots.store(workers.size(), std::memory_order_release);
         }
     }
-    Logger::info("[" + worker_name + "] Exiting");
+    else if (threads[slot].joinable())
+    {
+        threads[slot].join();
+    }
+
+    Worker*      worker = stealing ? workers[slot].get() : nullptr;
+    WorkerStats* stats  = workerStats[slot].get();
+    const int    cpu    = placement.empty() ? -1 : placement[slot % placement.size()];
+
+    stats->idleSince.store(0, std::memory_order_relaxed);
+    slotBusy[slot].store(true, std::memory_order_relaxed);
+    workerCount.fetch_add(1, std::memory_order_relaxed);
+    threads[slot] = std::thread(
+        [this, slot, worker, stats, cpu]()
+        {
+            const std::string name = "Thread " + std::to_string(slot);
+            if (cpu >= 0 && !CpuTopology::pinCurrentThread(cpu))
+                LOG_WARN("[" + name + "] Could not pin to CPU " + std::to_string(cpu));
+            if (numaQueue)
+                joinNode(name, slot, cpu);
+            threadLoop(name, worker, *stats);
+
+            stats->idleSince.store(0, std::memory_order_relaxed);
+            slotBusy[slot].store(false, std::memory_order_release);
+        });
+}
+
+/**
+ * @brief Cancels pending retirements or launches workers to grow; requests retirements to shrink.
+ *
+ * @details
+ * Retiring workers are woken through `IJobQueue::interrupt()` (blocked in
+ * the shared queue) or the parking condition (work stealing); busy ones
+ * check `retireRequests` between batches.
+ */
+void ThreadPool::resizeLocked(size_t number_threads)
+{
+    if (!running || queue->is_closed())
+        return;
+
+    const size_t target = std::min(std::max<size_t>(number_threads, 1), slotCapacity);
+    if (target == targetWorkers)
+        return;
+
+    LOG_INFO("[Thread Pool] Resizing from " + std::to_string(targetWorkers) + " to " +
+             std::to_string(target) + " threads");
+
+    if (target > targetWorkers)
+    {
+        size_t missing = target - targetWorkers;
+
+        // Workers that did not leave yet simply stay
+        size_t pending = retireRequests.load(std::memory_order_acquire);
+        while (pending > 0 && missing > 0)
+        {
+            const size_t kept = std::min(pending, missing);
+            if (retireRequests.compare_exchange_weak(pending, pending - kept,
+                                                     std::memory_order_acq_rel))
+            {
+                missing -= kept;
+                break;
+            }
+        }
+
+        targetWorkers = target;
+        for (size_t i = 0; i < missing; ++i)
+            launchWorker();
+        return;
+    }
+
+    const size_t surplus = targetWorkers - target;
+    targetWorkers        = target;
+    retireRequests.fetch_add(surplus, std::memory_order_acq_rel);
+    if (config.schedulingMode == ThreadPoolConfig::SchedulingMode::WorkStealing)
+        wakeAllWorkers();
+    else
+        queue->interrupt(surplus);
+}
+
+/**
+ * @brief Decrements `retireRequests` (and `workerCount`) unless it is already zero.
+ */
+bool ThreadPool::claimRetirement()
+{
+    size_t pending = retireRequests.load(std::memory_order_acquire);
+    while (pending > 0)
+    {
+        if (retireRequests.compare_exchange_weak(pending, pending - 1,
+                                                 std::memory_order_acq_rel))
+        {
+            workerCount.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Compares consecutive `metrics()` snapshots every `scaleInterval`.
+ */
+void ThreadPool::scaleLoop()
+{
+    Metrics previous = metrics();
+
+    std::unique_lock<std::mutex> lock(scalerMtx);
+    while (!scalerCv.wait_for(lock, config.scaleInterval, [this] { return scalerStop; }))
+    {
+        lock.unlock();
+        Metrics current = metrics();
+        autoScaleStep(previous, current);
+        previous = std::move(current);
+        lock.lock();
+    }
+}
+
+/**
+ * @brief One worker more when jobs waited too long; idle workers out after `keepAlive`.
+ *
+ * @details
+ * Workers already asked to retire are still idle, so they are taken off
+ * the idle count before deciding how many more can go.
+ */
+void ThreadPool::autoScaleStep(const Metrics& previous, const Metrics& current)
+{
+    HistogramSnapshot wait = current.total.queueWait;
+    wait.subtract(previous.total.queueWait);
+    const size_t finished = current.total.executed - previous.total.executed;
+
+    const uint64_t target =
+        static_cast<uint64_t>(std::chrono::nanoseconds(config.targetQueueWait).count());
+    const bool behind =
+        wait.count() > 0 ? wait.percentile(90.0) > target : finished == 0 && !queue->empty();
+
+    std::lock_guard<std::mutex> lock(resizeMtx);
+    if (behind)
+    {
+        if (targetWorkers < slotCapacity)
+            resizeLocked(targetWorkers + 1);
+        return;
+    }
+
+    const int64_t now = clockTicks();
+    const int64_t keepAlive =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(config.keepAlive).count();
+    size_t idle = 0;
+    for (size_t slot = 0; slot < threads.size(); ++slot)
+    {
+        const int64_t since = workerStats[slot]->idleSince.load(std::memory_order_relaxed);
+        if (slotBusy[slot].load(std::memory_order_acquire) && since != 0 &&
+            now - since >= keepAlive)
+            ++idle;
+    }
+    idle -= std::min(idle, retireRequests.load(std::memory_order_acquire));
+
+    const size_t floor   = std::max<size_t>(config.minThreads, 1);
+    const size_t surplus = std::min(idle, targetWorkers > floor ? targetWorkers - floor : 0);
+    if (surplus > 0)
+        resizeLocked(targetWorkers - surplus);
+}
+
+/**
+ * @brief Signals `scalerStop` and joins the auto-scaler.
+ */
+void ThreadPool::stopScaler()
+{
+    {
+        std::lock_guard<std::mutex> lock(scalerMtx);
+        scalerStop = true;
+    }
+    scalerCv.notify_all();
+
+    if (scaler.joinable())
+        scaler.join();
+}
+
+/**
+ * @brief Worker execution loop.
+ *
+ * @details
+ * Each worker:
+ *  - Blocks on queue->popTasks() (or acquireTask() when work stealing)
+ *  - Runs the whole local batch before touching the shared queue again
+ *  - Exits when no task is returned (queue closed and drained), or when it
+ *    claims a retirement between two batches or while idle
+ *  - Catches exceptions thrown by jobs to avoid worker death
+ *
+ * With `autoScale`, `stats.idleSince` is stamped when the worker runs out
+ * of work and cleared when it gets some.
+ */
+void ThreadPool::threadLoop(const std::string& worker_name, Worker* worker, WorkerStats& stats)
+{
+    LOG_INFO("[" + worker_name + "] Started");
+
+    tlsPool        = this;
+    tlsWorkerStats = &stats;
+    tlsWorkerName  = &worker_name;
+    if (worker)
+        tlsWorkerIndex = worker->index;
+
+    if (worker)
+    {
+        Task task;
+        while (acquireTask(*worker, task))
+            runTask(task, worker_name, &stats);
+    }
+    else
+    {
+        std::vector<Task> batch(batchCapacity(config));
+        while (true)
+        {
+            if (config.autoScale && stats.idleSince.load(std::memory_order_relaxed) == 0)
+                stats.idleSince.store(clockTicks(), std::memory_order_relaxed);
+
+            // Returns 0 when closed and drained, or woken by a shrink's interrupt()
+            const size_t count = queue->popTasks(batch.data(), batch.size(),
+                                                 workerCount.load(std::memory_order_relaxed));
+            if (count == 0)
+            {
+                if (queue->is_closed() || claimRetirement())
+                    break;
+                continue;
+            }
+            if (config.autoScale)
+                stats.idleSince.store(0, std::memory_order_relaxed);
+            releaseSlots(count);
+
+            tlsBatch.next = batch.data();
+            tlsBatch.end  = batch.data() + count;
+            while (tlsBatch.next != tlsBatch.end)
+                runTask(*tlsBatch.next++, worker_name, &stats);
+
+            if (retireRequests.load(std::memory_order_relaxed) > 0 && claimRetirement())
+                break;
+        }
+    }
+
+    tlsPool        = nullptr;
+    tlsWorkerStats = nullptr;
+    tlsWorkerName  = nullptr;
+    tlsBatch       = BatchCursor();
+    LOG_INFO("[" + worker_name + "] Exiting");
+}
+
+/**
+ * @brief Executes one task and settles the drain counters.
+ *
+ * @details
+ * Discarded tasks (drain deadline expired) stay counted in `pendingJobs`,
+ * which is how `shutdown()` reports them as abandoned.
+ *
+ * A guarded task whose token was cancelled or whose deadline passed while
+ * it was queued is destroyed unrun: it is settled and counted, but neither
+ * measured nor counted as completed. Once `shutdownNow()` started, the
+ * remaining tasks are moved into `reclaimed` unrun, unless `rescue` says a
+ * pool thread needs them to finish a wait; helpers blocked on a wait are
+ * woken, since the task may be one they need.
+ *
+ * When metrics are collected, the queue wait is measured from the stamp
+ * set at submission and the execution time around the call itself.
+ * `stats` is `nullptr` for jobs helped along by a thread outside the pool
+ * (see `runPendingTask()`) and for jobs the submitter runs itself under
+ * `OverflowPolicy::CallerRuns`: they are run and settled but not measured.
+ */
+void ThreadPool::runTask(Task& task, const std::string& worker_name, WorkerStats* stats,
+                         bool rescue)
+{
+    if (discardQueued.load(std::memory_order_acquire))
+    {
+        task.reset();
+        return;
+    }
+
+    const JobGuard::Verdict verdict = task.check();
+    if (verdict != JobGuard::Verdict::Run)
+    {
+        (verdict == JobGuard::Verdict::Cancelled ? cancelledCount : expiredCount)
+            .fetch_add(1, std::memory_order_relaxed);
+        task.reset();
+        finishPending();
+        return;
+    }
+
+    if (!rescue && reclaimQueued.load(std::memory_order_acquire))
+    {
+        {
+            std::lock_guard<std::mutex> lock(reclaimMtx);
+            reclaimed.push_back(std::move(task));
+        }
+        wakeHelpers();
+        return;
+    }
+
+    const bool    measured = stats && config.collectMetrics;
+    const bool    tracing  = stats && stats->trace;
+    const int64_t started  = measured || tracing ? clockTicks() : 0;
+    if (measured && task.submitTime() != 0)
+        stats->queueWait.record(
+            static_cast<uint64_t>(std::max<int64_t>(0, started - task.submitTime())));
+    const char* type = tracing ? task.typeName() : nullptr;
+
+    bool failed = false;
+    try
+    {
+        task();
+    }
+    catch (const std::exception& e)
+    {
+        failed = true;
+        LOG_ERROR("[Thread Pool][" + worker_name + "] Exception: " + e.what());
+    }
+
+    if (stats)
+    {
+        const int64_t finished = measured || tracing ? clockTicks() : 0;
+        if (measured)
+            stats->execution.record(static_cast<uint64_t>(finished - started));
+        if (tracing)
+        {
+            const int64_t submitted = task.submitTime();
+            const bool    recorded  = stats->trace->tryPush(
+                [&](TraceEvent& event)
+                {
+                    event.submitted = submitted;
+                    event.started   = started;
+                    event.finished  = finished;
+                    event.type      = type;
+                    event.failed    = failed;
+                });
+            if (!recorded)
+                WorkerStats::bump(stats->traceDropped);
+        }
+        if (failed)
+            WorkerStats::bump(stats->failed);
+        WorkerStats::bump(stats->executed);
+    }
+    task.reset();
+
+    completedJobs.fetch_add(1, std::memory_order_relaxed);
+    finishPending();
+}
+
+/**
+ * @brief Pops one job the calling thread may run and runs it.
+ *
+ * @details
+ * A shared-queue worker of this pool first runs the rest of its own batch,
+ * which no other thread can reach. A work-stealing worker searches like it
+ * does in its own loop (own deque, shared queue, victims); any other thread
+ * only takes from the shared queue.
+ *
+ * Once the queue is closed only the pool's own threads keep helping, and
+ * only during `shutdownNow()`: the job waiting there cannot return before
+ * the jobs it waits for ran, and the join waits for that job. They take the
+ * newest reclaimed task settling `outstanding` first, then search as usual;
+ * of what they find they run only the tasks settling `outstanding` (nested
+ * waits cover the rest of the chain) and hand every other one back. Any
+ * other helper takes nothing from a closed queue.
+ */
+bool ThreadPool::runPendingTask(const std::atomic<size_t>& outstanding)
+{
+    auto* stats = tlsPool == this ? static_cast<WorkerStats*>(tlsWorkerStats) : nullptr;
+    if (stats && tlsBatch.next != tlsBatch.end)
+    {
+        Task& task = *tlsBatch.next++;
+        runTask(task, *tlsWorkerName, stats, task.counter() == &outstanding);
+        return true;
+    }
+
+    const bool rescuing = stats && reclaimQueued.load(std::memory_order_acquire);
+    if (queue->is_closed() && !rescuing)
+        return false;
+
+    Task task;
+    if (rescuing && takeReclaimed(task, outstanding))
+    {
+        runTask(task, *tlsWorkerName, stats, true);
+        return true;
+    }
+
+    if (stats && config.schedulingMode == ThreadPoolConfig::SchedulingMode::WorkStealing)
+    {
+        if (!findWork(*workers[tlsWorkerIndex], task))
+            return false;
+    }
+    else
+    {
+        if (!queue->tryPopTask(task))
+            return false;
+        releaseSlots(1);
+    }
+
+    runTask(task, stats ? *tlsWorkerName : kHelperName, stats,
+            stats && task.counter() == &outstanding);
+    return true;
+}
+
+/**
+ * @brief Removes the newest task of `reclaimed` settling `outstanding`, under `reclaimMtx`.
+ */
+bool ThreadPool::takeReclaimed(Task& task, const std::atomic<size_t>& outstanding)
+{
+    std::lock_guard<std::mutex> lock(reclaimMtx);
+    for (auto it = reclaimed.rbegin(); it != reclaimed.rend(); ++it)
+    {
+        if (it->counter() == &outstanding)
+        {
+            task = std::move(*it);
+            reclaimed.erase(std::next(it).base());
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Whether `reclaimed` holds a task settling `outstanding`, under `reclaimMtx`.
+ */
+bool ThreadPool::hasReclaimed(const std::atomic<size_t>& outstanding)
+{
+    std::lock_guard<std::mutex> lock(reclaimMtx);
+    return std::any_of(reclaimed.begin(), reclaimed.end(),
+                       [&outstanding](const Task& task) { return task.counter() == &outstanding; });
+}
+
+/**
+ * @brief Helps until `outstanding` reaches zero, parking when nothing is runnable.
+ *
+ * @details
+ * Same handshake as worker parking: the helper announces itself in
+ * `waitingHelpers` and re-checks under `helpMtx`; publishers (and the last
+ * job of a group) publish first, then notify only if a helper is waiting.
+ */
+void ThreadPool::helpUntilDone(const std::atomic<size_t>& outstanding)
+{
+    auto done = [&outstanding] { return outstanding.load(std::memory_order_seq_cst) == 0; };
+
+    while (!done())
+    {
+        if (runPendingTask(outstanding))
+            continue;
+
+        waitingHelpers.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(helpMtx);
+            helpCv.wait(lock, [&] { return done() || helperHasWork(outstanding); });
+        }
+        waitingHelpers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Whether `runPendingTask()` could find something (snapshot).
+ */
+bool ThreadPool::helperHasWork(const std::atomic<size_t>& outstanding)
+{
+    if (tlsPool == this && tlsBatch.next != tlsBatch.end)
+        return true;
+    if (tlsPool == this && reclaimQueued.load(std::memory_order_acquire))
+    {
+        if (hasReclaimed(outstanding))
+            return true;
+    }
+    else if (queue->is_closed())
+    {
+        return false;
+    }
+    if (!queue->empty())
+        return true;
+
+    const bool stealing =
+        config.schedulingMode == ThreadPoolConfig::SchedulingMode::WorkStealing;
+    return stealing && tlsPool == this && hasVisibleWork();
+}
+
+/**
+ * @brief Notifies waiting helpers if the handshake says one may be waiting.
+ */
+void ThreadPool::wakeHelpers()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waitingHelpers.load(std::memory_order_relaxed) == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(helpMtx);
+    helpCv.notify_all();
+}
+
+/**
+ * @brief Work-stealing acquisition loop.
+ *
+ * @details
+ * Parking uses the same handshake as `RingJobQueue`: the worker announces
+ * itself in `parkedWorkers` and re-checks for work under `parkMtx`, while
+ * producers publish first and notify only if someone is parked.
+ *
+ * Once the shared queue is closed the worker keeps helping until no work is
+ * visible anywhere. Jobs pushed later by a still-running job land in that
+ * job's own deque and are drained by its owner before it exits.
+ *
+ * A worker only claims a retirement once its own deque is empty, so a
+ * retired worker leaves no job behind.
+ *
+ * Before parking the worker spins in `idleSpin`; producers skip the wake-up
+ * while someone spins. A spinner that finds work and still sees more wakes
+ * the next worker, so a burst ramps the parked workers up one by one.
+ */
+bool ThreadPool::acquireTask(Worker& worker, Task& task)
+{
+    bool spun = false;
+    while (true)
+    {
+        if (findWork(worker, task))
+        {
+            if (config.autoScale)
+                worker.stats.idleSince.store(0, std::memory_order_relaxed);
+            if (spun && hasVisibleWork())
+                wakeIdleWorker();
+            return true;
+        }
+
+        if (queue->is_closed())
+        {
+            if (!hasVisibleWork())
+                return false;
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (claimRetirement())
+            return false;
+        if (config.autoScale && worker.stats.idleSince.load(std::memory_order_relaxed) == 0)
+            worker.stats.idleSince.store(clockTicks(), std::memory_order_relaxed);
+
+        spun = idleSpin.until(
+            [this]
+            {
+                return hasVisibleWork() || retireRequests.load(std::memory_order_relaxed) > 0;
+            });
+        if (spun)
+            continue;
+
+        parkedWorkers.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(parkMtx);
+            parkCv.wait(lock,
+                        [this]
+                        {
+                            return queue->is_closed() || hasVisibleWork() ||
+                                   retireRequests.load(std::memory_order_relaxed) > 0;
+                        });
+        }
+        parkedWorkers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Own deque first, then a batch from the shared queue, then random victims.
+ */
+bool ThreadPool::findWork(Worker& worker, Task& task)
+{
+    if (Task* boxed = worker.deque.pop())
+    {
+        worker.unbox(boxed, task, true);
+        return true;
+    }
+
+    const size_t count  = workerSlots.load(std::memory_order_acquire);
+    const size_t popped = queue->tryPopTasks(worker.inbox.data(), worker.inbox.size(),
+                                             workerCount.load(std::memory_order_relaxed));
+    if (popped > 0)
+    {
+        releaseSlots(popped);
+        task = std::move(worker.inbox[0]);
+
+        // The rest of the batch stays reachable by thieves; pushed newest first
+        // so the owner's LIFO pops still run it in queue order
+        if (popped > 1)
+        {
+            for (size_t i = 1; i < popped; ++i)
+                worker.spill[popped - 1 - i] = worker.box(std::move(worker.inbox[i]));
+            worker.deque.push(worker.spill.data(), popped - 1);
+            wakeIdleWorker();
+        }
+        return true;
+    }
+
+    if (count < 2)
+        return false;
+
+    const size_t first = static_cast<size_t>(worker.nextRandom() % count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t victim = (first + i) % count;
+        if (victim == worker.index)
+            continue;
+
+        if (Task* boxed = workers[victim]->deque.steal())
+        {
+            WorkerStats::bump(worker.stats.stolen);
+            workers[victim]->unbox(boxed, task, false);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Snapshot check over the shared queue and every local deque.
+ */
+bool ThreadPool::hasVisibleWork() const
+{
+    if (!queue->empty())
+        return true;
+
+    const size_t count = workerSlots.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!workers[i]->deque.empty())
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Notifies one parked worker if the handshake says one may be waiting
+ *        and no worker is spinning.
+ *
+ * @details
+ * A spinner leaves `idleSpin` before announcing itself in `parkedWorkers`,
+ * so if it is still counted here it re-checks for work after our publish.
+ */
+void ThreadPool::wakeIdleWorker()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parkedWorkers.load(std::memory_order_relaxed) == 0)
+        return;
+    if (idleSpin.spinning() > 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(parkMtx);
+    parkCv.notify_one();
+}
+
+/**
+ * @brief Notifies every parked worker (used on shutdown).
+ */
+void ThreadPool::wakeAllWorkers()
+{
+    std::lock_guard<std::mutex> lock(parkMtx);
+    parkCv.notify_all();
 }
 
 /*****************************************************************************/
\ No newline at end of file
@@ -0,0 +1,400 @@
+/**
+ * @file        timer_wheel.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of the hierarchical timing wheel.
+ */
+
+/*****************************************************************************/
+
+/* Standard libraries */
+
+#include <algorithm>
+#include <limits>
+#include <string>
+
+/* Project libraries */
+
+#include "timer_wheel.h"
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+/* Node */
+
+/**
+ * @brief One armed timer.
+ */
+struct TimerWheel::Node
+{
+    uint64_t                    expiry = 0;      /**< Tick at which it fires. */
+    uint64_t                    period = 0;      /**< Ticks between runs (0 = one-shot). */
+    Task                        task;            /**< One-shot timers: the task to dispatch. */
+    std::shared_ptr<TimerState> state;           /**< Cancellation / periodic state. */
+    Node*                       next = nullptr;  /**< Next node in the same slot. */
+};
+
+/*****************************************************************************/
+
+/* Helpers */
+
+namespace
+{
+/**
+ * @brief Callable dispatched for each period; clears `inFlight` when it is
+ *        destroyed, whether it ran or was dropped by the executor.
+ */
+class PeriodicRun
+{
+   public:
+    explicit PeriodicRun(std::shared_ptr<TimerState> state) : state(std::move(state)) {}
+
+    PeriodicRun(PeriodicRun&& other) noexcept : state(std::move(other.state)) {}
+
+    PeriodicRun& operator=(PeriodicRun&&) = delete;
+
+    ~PeriodicRun()
+    {
+        if (state)
+            state->inFlight.store(false, std::memory_order_release);
+    }
+
+    void operator()()
+    {
+        if (!state->cancelled.load(std::memory_order_acquire))
+            state->body();
+    }
+
+   private:
+    std::shared_ptr<TimerState> state;
+};
+
+/**
+ * @brief Tick value meaning "nothing to wait for".
+ */
+constexpr uint64_t kNever = std::numeric_limits<uint64_t>::max();
+}  // namespace
+
+/*****************************************************************************/
+
+/* Static member initialization */
+
+constexpr size_t TimerWheel::kSlotBits;
+constexpr size_t TimerWheel::kSlots;
+constexpr size_t TimerWheel::kLevels;
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Creates an empty wheel and launches its thread.
+ */
+TimerWheel::TimerWheel(IExecutor& executor, std::chrono::milliseconds tick)
+    : executor(executor),
+      tick(tick.count() > 0 ? Clock::duration(tick) : Clock::duration(std::chrono::milliseconds(1))),
+      origin(Clock::now()),
+      slots(),
+      level0Occupied(0),
+      now(0),
+      wakeTick(kNever),
+      armed(0),
+      stopping(false)
+{
+    worker = std::thread([this] { run(); });
+}
+
+/**
+ * @brief Stops the thread and frees the remaining nodes.
+ */
+TimerWheel::~TimerWheel()
+{
+    stop();
+}
+
+/**
+ * @brief Arms a one-shot timer.
+ */
+TimerHandle TimerWheel::scheduleAt(Clock::time_point when, Task task)
+{
+    if (!task)
+    {
+        LOG_WARN("[Timer Wheel] Empty job ignored.");
+        return TimerHandle();
+    }
+
+    Node* node = new Node;
+    node->task = std::move(task);
+
+    std::unique_lock<std::mutex> lock(mtx);
+    if (armed == 0)
+        now = std::max(now, tickOf(Clock::now()));  // idle wheel: skip the empty ticks
+    node->expiry = std::max(ticksIn(when - origin), now + 1);
+    return arm(node, std::make_shared<TimerState>());
+}
+
+/**
+ * @brief Arms a periodic timer.
+ */
+TimerHandle TimerWheel::scheduleEvery(Clock::duration period, Task task)
+{
+    if (!task)
+    {
+        LOG_WARN("[Timer Wheel] Empty job ignored.");
+        return TimerHandle();
+    }
+
+    auto state  = std::make_shared<TimerState>();
+    state->body = std::move(task);
+
+    Node* node   = new Node;
+    node->period = ticksIn(period);
+
+    std::unique_lock<std::mutex> lock(mtx);
+    if (armed == 0)
+        now = std::max(now, tickOf(Clock::now()));
+    node->expiry = now + node->period;
+    return arm(node, std::move(state));
+}
+
+/**
+ * @brief Joins the timer thread, then destroys every pending timer.
+ */
+void TimerWheel::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (stopping)
+            return;
+        stopping = true;
+    }
+    cv.notify_all();
+
+    if (worker.joinable())
+        worker.join();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t                      discarded = 0;
+    for (auto& level : slots)
+    {
+        for (Node*& head : level)
+        {
+            while (head)
+            {
+                Node* node = head;
+                head       = node->next;
+                delete node;
+                ++discarded;
+            }
+        }
+    }
+    armed          = 0;
+    level0Occupied = 0;
+
+    if (discarded > 0)
+        LOG_INFO("[Timer Wheel] " + std::to_string(discarded) + " pending timer(s) discarded");
+}
+
+/**
+ * @brief Returns the number of linked timers.
+ */
+size_t TimerWheel::size() const
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return armed;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Sleeps until the next event, advances the wheel, dispatches due tasks.
+ *
+ * @details
+ * Due tasks are collected under the lock and dispatched after releasing it,
+ * so a slow `dispatch()` (e.g. a bounded pool applying backpressure) never
+ * blocks `scheduleAt()` callers.
+ */
+void TimerWheel::run()
+{
+    std::vector<Task>            due;
+    std::unique_lock<std::mutex> lock(mtx);
+
+    while (!stopping)
+    {
+        const uint64_t target = tickOf(Clock::now());
+        while (now < target && armed > 0)
+            advance(due);
+        if (armed == 0)
+            now = std::max(now, target);
+
+        if (!due.empty())
+        {
+            lock.unlock();
+            for (Task& task : due)
+                executor.dispatch(std::move(task));
+            due.clear();
+            lock.lock();
+            continue;
+        }
+
+        wakeTick = nextEventTick();
+        if (wakeTick == kNever)
+            cv.wait(lock);
+        else
+            cv.wait_until(lock, origin + tick * static_cast<Clock::rep>(wakeTick));
+        wakeTick = kNever;
+    }
+}
+
+/**
+ * @brief Links a freshly built node and wakes the thread if it must fire earlier.
+ */
+TimerHandle TimerWheel::arm(Node* node, std::shared_ptr<TimerState> state)
+{
+    if (stopping)
+    {
+        delete node;
+        LOG_WARN("[Timer Wheel] Timer rejected: wheel stopped.");
+        return TimerHandle();
+    }
+
+    node->state = state;
+    insert(node);
+    ++armed;
+
+    if (node->expiry < wakeTick)
+        cv.notify_one();
+    return TimerHandle(std::move(state));
+}
+
+/**
+ * @brief Picks the level from the distance to expiry and pushes onto the slot list.
+ *
+ * @details
+ * Level `n` holds distances in `[64^n, 64^(n+1))`. Anything beyond the top
+ * level parks in its farthest slot and is re-inserted when it cascades.
+ */
+void TimerWheel::insert(Node* node)
+{
+    const uint64_t delta = node->expiry > now ? node->expiry - now : 0;
+
+    size_t level = 0;
+    while (level + 1 < kLevels && delta >= (uint64_t(1) << (kSlotBits * (level + 1))))
+        ++level;
+
+    const size_t   shift = kSlotBits * level;
+    const uint64_t mask  = kSlots - 1;
+    size_t         index = static_cast<size_t>((node->expiry >> shift) & mask);
+    if (delta >= (uint64_t(1) << (kSlotBits * kLevels)))
+        index = static_cast<size_t>(((now >> shift) + mask) & mask);
+
+    node->next          = slots[level][index];
+    slots[level][index] = node;
+    if (level == 0)
+        level0Occupied |= uint64_t(1) << index;
+}
+
+/**
+ * @brief Moves to the next tick, cascading first when level 0 wraps.
+ */
+void TimerWheel::advance(std::vector<Task>& due)
+{
+    ++now;
+    const size_t index = static_cast<size_t>(now & (kSlots - 1));
+    if (index == 0)
+        cascade(1);
+
+    Node* list      = slots[0][index];
+    slots[0][index] = nullptr;
+    level0Occupied &= ~(uint64_t(1) << index);
+
+    while (list)
+    {
+        Node* node = list;
+        list       = node->next;
+
+        if (node->state->cancelled.load(std::memory_order_acquire))
+        {
+            --armed;
+            delete node;
+            continue;
+        }
+
+        if (node->expiry > now)
+        {
+            insert(node);
+            continue;
+        }
+
+        if (node->period == 0)
+        {
+            due.push_back(std::move(node->task));
+            --armed;
+            delete node;
+            continue;
+        }
+
+        // Skip this period if the previous run has not finished yet
+        if (!node->state->inFlight.exchange(true, std::memory_order_acq_rel))
+            due.emplace_back(PeriodicRun(node->state));
+        node->expiry = now + node->period;
+        insert(node);
+    }
+}
+
+/**
+ * @brief Cascades the slot of `level` the clock just entered (higher levels first).
+ */
+void TimerWheel::cascade(size_t level)
+{
+    const size_t index = static_cast<size_t>((now >> (kSlotBits * level)) & (kSlots - 1));
+    if (index == 0 && level + 1 < kLevels)
+        cascade(level + 1);
+
+    Node* list          = slots[level][index];
+    slots[level][index] = nullptr;
+    while (list)
+    {
+        Node* node = list;
+        list       = node->next;
+        insert(node);
+    }
+}
+
+/**
+ * @brief Next tick worth waking for: the next one if level 0 holds timers,
+ *        otherwise the next cascade boundary.
+ */
+uint64_t TimerWheel::nextEventTick() const
+{
+    if (armed == 0)
+        return kNever;
+    if (level0Occupied != 0)
+        return now + 1;
+    return (now | (kSlots - 1)) + 1;
+}
+
+/**
+ * @brief Ticks elapsed between `origin` and `time` (rounded down).
+ */
+uint64_t TimerWheel::tickOf(Clock::time_point time) const
+{
+    if (time <= origin)
+        return 0;
+    return static_cast<uint64_t>((time - origin) / tick);
+}
+
+/**
+ * @brief `duration` in ticks, rounded up (at least 1).
+ */
+uint64_t TimerWheel::ticksIn(Clock::duration duration) const
+{
+    if (duration <= Clock::duration::zero())
+        return 1;
+    return static_cast<uint64_t>((duration + tick - Clock::duration(1)) / tick);
+}
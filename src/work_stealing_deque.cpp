@@ -0,0 +1,210 @@
+/**
+ * @file        work_stealing_deque.cpp
+ * @author      Sergio Guerrero Blanco
+ * @date        2026-10-16
+ * @version     1.0.0
+ *
+ * @brief Implementation of the Chase-Lev work-stealing deque.
+ *
+ * @details
+ * Memory orderings follow the C11 formulation of Lê et al. The two
+ * `seq_cst` fences (in `pop()` and `steal()`) order the owner's write of
+ * `bottom` against a thief's read of it, which is what prevents the owner
+ * and a thief from both taking the last element.
+ */
+
+/*****************************************************************************/
+
+/* Project libraries */
+
+#include "work_stealing_deque.h"
+
+/*****************************************************************************/
+
+/* Buffer */
+
+/**
+ * @brief Allocates `capacity` empty slots.
+ */
+WorkStealingDeque::Buffer::Buffer(int64_t capacity)
+    : capacity(capacity),
+      mask(capacity - 1),
+      slots(new std::atomic<Task*>[static_cast<size_t>(capacity)])
+{
+}
+
+/**
+ * @brief Reads the slot mapped to `index`.
+ */
+Task* WorkStealingDeque::Buffer::get(int64_t index) const
+{
+    return slots[static_cast<size_t>(index & mask)].load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Writes the slot mapped to `index`.
+ */
+void WorkStealingDeque::Buffer::put(int64_t index, Task* job)
+{
+    slots[static_cast<size_t>(index & mask)].store(job, std::memory_order_relaxed);
+}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @brief Creates an empty deque with a power-of-two buffer.
+ */
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) : top(0), pad(), bottom(0)
+{
+    int64_t capacity = 2;
+    while (capacity < static_cast<int64_t>(initial_capacity))
+        capacity <<= 1;
+
+    buffers.emplace_back(new Buffer(capacity));
+    buffer.store(buffers.back().get(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Deletes every job still stored.
+ */
+WorkStealingDeque::~WorkStealingDeque()
+{
+    while (Task* task = pop())
+        delete task;
+}
+
+/**
+ * @brief Owner push at the bottom, growing the buffer if needed.
+ */
+void WorkStealingDeque::push(Task* job)
+{
+    const int64_t b   = bottom.load(std::memory_order_relaxed);
+    const int64_t t   = top.load(std::memory_order_acquire);
+    Buffer*       buf = buffer.load(std::memory_order_relaxed);
+
+    if (b - t > buf->capacity - 1)
+        buf = grow(buf, b, t);
+
+    buf->put(b, job);
+    bottom.store(b + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Owner push of several jobs: one capacity check, one release of `bottom`.
+ */
+void WorkStealingDeque::push(Task* const* jobs, size_t count)
+{
+    const int64_t b   = bottom.load(std::memory_order_relaxed);
+    const int64_t t   = top.load(std::memory_order_acquire);
+    const int64_t n   = static_cast<int64_t>(count);
+    Buffer*       buf = buffer.load(std::memory_order_relaxed);
+
+    while (b + n - t > buf->capacity)
+        buf = grow(buf, b, t);
+
+    for (int64_t i = 0; i < n; ++i)
+        buf->put(b + i, jobs[i]);
+    bottom.store(b + n, std::memory_order_release);
+}
+
+/**
+ * @brief Owner pop at the bottom.
+ *
+ * @details
+ * Reserves the bottom slot first, then checks whether a thief got there.
+ * Only the last element needs a CAS against thieves.
+ */
+Task* WorkStealingDeque::pop()
+{
+    const int64_t b   = bottom.load(std::memory_order_relaxed) - 1;
+    Buffer*       buf = buffer.load(std::memory_order_relaxed);
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {
+        // Empty: restore bottom.
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Task* job = buf->get(b);
+    if (t == b)
+    {
+        // Last element: race against thieves.
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed))
+        {
+            job = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+/**
+ * @brief Thief steal at the top.
+ */
+Task* WorkStealingDeque::steal()
+{
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom.load(std::memory_order_acquire);
+
+    if (t >= b)
+        return nullptr;
+
+    Buffer* buf = buffer.load(std::memory_order_acquire);
+    Task*   job = buf->get(t);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed))
+    {
+        return nullptr;  // Lost the race to the owner or another thief.
+    }
+    return job;
+}
+
+/**
+ * @brief Returns `bottom - top`, clamped at zero.
+ */
+size_t WorkStealingDeque::size() const
+{
+    const int64_t b = bottom.load(std::memory_order_seq_cst);
+    const int64_t t = top.load(std::memory_order_seq_cst);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+}
+
+/**
+ * @brief Returns whether the deque looks empty.
+ */
+bool WorkStealingDeque::empty() const
+{
+    return size() == 0;
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @brief Replaces the buffer with one twice as large.
+ *
+ * @details
+ * The old buffer is kept in `buffers` because a thief that loaded it before
+ * the swap may still read one slot from it.
+ */
+WorkStealingDeque::Buffer* WorkStealingDeque::grow(Buffer* old, int64_t bottom_index,
+                                                   int64_t top_index)
+{
+    buffers.emplace_back(new Buffer(old->capacity * 2));
+    Buffer* bigger = buffers.back().get();
+
+    for (int64_t i = top_index; i < bottom_index; ++i)
+        bigger->put(i, old->get(i));
+
+    buffer.store(bigger, std::memory_order_release);
+    return bigger;
+}
@@ -0,0 +1,28 @@
+/*
+ * @file        fake_counting_job.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.0.0
+ *
+ * @brief Test job that increments an external counter.
+ *
+ * @details
+ * The counter lives outside the job, so tests can check it after the pool
+ * has destroyed the job.
+ */
+#pragma once
+
+#include <atomic>
+
+#include "i_job.h"
+
+class FakeCountingJob : public IJob
+{
+   public:
+    explicit FakeCountingJob(std::atomic<int>& counter) : counter(counter) {}
+
+    void execute() override { counter.fetch_add(1, std::memory_order_relaxed); }
+
+   private:
+    std::atomic<int>& counter;
+};
@@ -0,0 +1,267 @@
+/**
+ * @file        test_backpressure.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for the bounded shared queue and its overflow policies.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a 1-thread pool whose worker is held by a gate job and whose
+ *           shared queue is full
+ *  - WHEN: one more job is submitted
+ *  - THEN: the configured policy decides its fate and is counted
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "logger.h"
+#include "thread_pool.h"
+#include "worker_gate.h"
+
+/*****************************************************************************/
+
+class BackpressureTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Builds a config bounding the shared queue to `capacity` jobs.
+     */
+    static ThreadPoolConfig bounded(size_t capacity, ThreadPoolConfig::OverflowPolicy policy)
+    {
+        ThreadPoolConfig config;
+        config.maxQueuedJobs  = capacity;
+        config.overflowPolicy = policy;
+        return config;
+    }
+
+    std::atomic<bool> gate{false};
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Reject refuses jobs beyond the bound
+ *
+ * GIVEN a held worker and a queue bounded to 2 jobs with the Reject policy
+ * WHEN 3 jobs are offered with tryEnqueue()
+ * THEN the first 2 are accepted and run, the third is refused and counted
+ */
+TEST_F(BackpressureTest, RejectRefusesWhenFull)
+{
+    // GIVEN
+    ThreadPool       tPool(bounded(2, ThreadPoolConfig::OverflowPolicy::Reject));
+    std::atomic<int> executed{0};
+    tPool.start(1);
+    holdWorker(tPool, gate);
+
+    // WHEN
+    const bool first  = tPool.tryEnqueue(std::make_unique<FakeCountingJob>(executed));
+    const bool second = tPool.tryEnqueue(std::make_unique<FakeCountingJob>(executed));
+    const bool third  = tPool.tryEnqueue(std::make_unique<FakeCountingJob>(executed));
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_TRUE(first);
+    EXPECT_TRUE(second);
+    EXPECT_FALSE(third);
+    EXPECT_EQ(executed.load(), 2);
+    EXPECT_EQ(tPool.backpressureStats().rejected, 1u);
+}
+
+/**
+ * @test CallerRuns executes the overflowing job on the submitting thread
+ *
+ * GIVEN a held worker and a queue bounded to 1 job with the CallerRuns policy
+ * WHEN 2 lambdas recording their thread are posted
+ * THEN the second one ran synchronously on the test thread
+ */
+TEST_F(BackpressureTest, CallerRunsOnSubmitter)
+{
+    // GIVEN
+    ThreadPool      tPool(bounded(1, ThreadPoolConfig::OverflowPolicy::CallerRuns));
+    std::thread::id queuedOn;
+    std::thread::id overflowOn;
+    tPool.start(1);
+    holdWorker(tPool, gate);
+
+    // WHEN
+    tPool.post([&queuedOn] { queuedOn = std::this_thread::get_id(); });
+    tPool.post([&overflowOn] { overflowOn = std::this_thread::get_id(); });
+    const std::thread::id afterPost = overflowOn;
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(afterPost, std::this_thread::get_id());
+    EXPECT_NE(queuedOn, std::this_thread::get_id());
+    EXPECT_EQ(tPool.backpressureStats().callerRuns, 1u);
+}
+
+/**
+ * @test DropOldest discards the oldest queued job to admit the new one
+ *
+ * GIVEN a held worker and a queue bounded to 2 jobs with the DropOldest policy,
+ *       in both scheduling modes
+ * WHEN jobs 1, 2 and 3 are posted
+ * THEN jobs 2 and 3 run, job 1 is discarded and counted
+ */
+TEST_F(BackpressureTest, DropOldestDiscardsOldest)
+{
+    for (auto mode : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                      ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPoolConfig config = bounded(2, ThreadPoolConfig::OverflowPolicy::DropOldest);
+        config.schedulingMode   = mode;
+        ThreadPool       tPool(config);
+        std::mutex       ranMtx;
+        std::vector<int> ran;
+        gate.store(false);
+        tPool.start(1);
+        holdWorker(tPool, gate);
+
+        // WHEN
+        for (int id = 1; id <= 3; ++id)
+        {
+            tPool.post(
+                [id, &ranMtx, &ran]
+                {
+                    std::lock_guard<std::mutex> lock(ranMtx);
+                    ran.push_back(id);
+                });
+        }
+        gate.store(true);
+        tPool.shutdown();
+
+        // THEN
+        EXPECT_EQ(ran, (std::vector<int>{2, 3}));
+        EXPECT_EQ(tPool.backpressureStats().droppedOldest, 1u);
+    }
+}
+
+/**
+ * @test DropOldest sacrifices the lowest priority lane first
+ *
+ * GIVEN a held worker and a queue bounded to 2 jobs with the DropOldest policy,
+ *       in both scheduling modes
+ * WHEN a High job, then a Low job, then a Normal job are enqueued
+ * THEN the Low job is discarded and the High and Normal ones run
+ */
+TEST_F(BackpressureTest, DropOldestSparesHigherPriority)
+{
+    for (auto mode : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                      ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPoolConfig config = bounded(2, ThreadPoolConfig::OverflowPolicy::DropOldest);
+        config.schedulingMode   = mode;
+        ThreadPool       tPool(config);
+        std::atomic<int> high{0};
+        std::atomic<int> low{0};
+        std::atomic<int> normal{0};
+        gate.store(false);
+        tPool.start(1);
+        holdWorker(tPool, gate);
+
+        // WHEN
+        tPool.enqueue(std::make_unique<FakeCountingJob>(high), JobPriority::High);
+        tPool.enqueue(std::make_unique<FakeCountingJob>(low), JobPriority::Low);
+        tPool.enqueue(std::make_unique<FakeCountingJob>(normal), JobPriority::Normal);
+        gate.store(true);
+        tPool.shutdown();
+
+        // THEN
+        EXPECT_EQ(high.load(), 1);
+        EXPECT_EQ(low.load(), 0);
+        EXPECT_EQ(normal.load(), 1);
+        EXPECT_EQ(tPool.backpressureStats().droppedOldest, 1u);
+    }
+}
+
+
+/**
+ * @test Block gives up after blockTimeout
+ *
+ * GIVEN a held worker and a queue bounded to 1 job with Block and a 30 ms timeout
+ * WHEN a second job is offered with tryEnqueue()
+ * THEN the call waits, then refuses the job and counts a block and a timeout
+ */
+TEST_F(BackpressureTest, BlockTimesOut)
+{
+    // GIVEN
+    ThreadPoolConfig config = bounded(1, ThreadPoolConfig::OverflowPolicy::Block);
+    config.blockTimeout     = std::chrono::milliseconds(30);
+    ThreadPool       tPool(config);
+    std::atomic<int> executed{0};
+    tPool.start(1);
+    holdWorker(tPool, gate);
+    tPool.enqueue(std::make_unique<FakeCountingJob>(executed));
+
+    // WHEN
+    const auto begin    = std::chrono::steady_clock::now();
+    const bool accepted = tPool.tryEnqueue(std::make_unique<FakeCountingJob>(executed));
+    const auto waited   = std::chrono::steady_clock::now() - begin;
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_FALSE(accepted);
+    EXPECT_GE(waited, std::chrono::milliseconds(25));
+    EXPECT_EQ(executed.load(), 1);
+    EXPECT_EQ(tPool.backpressureStats().blocked, 1u);
+    EXPECT_EQ(tPool.backpressureStats().timedOut, 1u);
+}
+
+/**
+ * @test Block resumes as soon as a worker frees a slot
+ *
+ * GIVEN a held worker and a full queue bounded to 1 job with Block (no timeout)
+ * WHEN a second job is enqueued and the gate opens 50 ms later
+ * THEN the producer is released, both jobs run and no timeout is counted
+ */
+TEST_F(BackpressureTest, BlockWaitsForRoom)
+{
+    // GIVEN
+    ThreadPool       tPool(bounded(1, ThreadPoolConfig::OverflowPolicy::Block));
+    std::atomic<int> executed{0};
+    tPool.start(1);
+    holdWorker(tPool, gate);
+    tPool.enqueue(std::make_unique<FakeCountingJob>(executed));
+
+    std::thread opener(
+        [this]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            gate.store(true);
+        });
+
+    // WHEN
+    const bool accepted = tPool.tryEnqueue(std::make_unique<FakeCountingJob>(executed));
+    opener.join();
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_TRUE(accepted);
+    EXPECT_EQ(executed.load(), 2);
+    EXPECT_EQ(tPool.backpressureStats().blocked, 1u);
+    EXPECT_EQ(tPool.backpressureStats().timedOut, 0u);
+}
@@ -0,0 +1,286 @@
+/**
+ * @file        test_batch.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for batch push / pop on the queues and ThreadPool::enqueueBatch().
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a queue backend or a pool
+ *  - WHEN: tasks are published or consumed in batches
+ *  - THEN: order, fair share and completeness hold as with single operations
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "job_queue.h"
+#include "logger.h"
+#include "ring_job_queue.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class BatchTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::WARN); }
+
+    /**
+     * @brief Builds `count` tasks appending their index to `ran`.
+     */
+    static std::vector<Task> recordingTasks(int count, std::vector<int>& ran)
+    {
+        std::vector<Task> tasks;
+        for (int id = 0; id < count; ++id)
+            tasks.emplace_back([id, &ran] { ran.push_back(id); });
+        return tasks;
+    }
+
+    /**
+     * @brief Builds `count` jobs incrementing `counter`.
+     */
+    static std::vector<std::unique_ptr<IJob>> countingJobs(int count, std::atomic<int>& counter)
+    {
+        std::vector<std::unique_ptr<IJob>> jobs;
+        for (int i = 0; i < count; ++i)
+            jobs.push_back(std::make_unique<FakeCountingJob>(counter));
+        return jobs;
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Batches keep FIFO order across push and pop
+ *
+ * GIVEN a JobQueue holding 5 tasks pushed with one pushTasks() call
+ * WHEN they are popped with popTasks(3) and then popTasks(8)
+ * THEN the calls return 3 and 2 tasks which run in submission order
+ */
+TEST_F(BatchTest, JobQueueBatchesKeepOrder)
+{
+    // GIVEN
+    JobQueue          queue;
+    std::vector<int>  ran;
+    std::vector<Task> tasks = recordingTasks(5, ran);
+    queue.pushTasks(tasks.data(), tasks.size());
+
+    // WHEN
+    std::vector<Task> out(8);
+    const size_t      first = queue.popTasks(out.data(), 3);
+    for (size_t i = 0; i < first; ++i)
+        out[i]();
+    const size_t second = queue.popTasks(out.data(), 8);
+    for (size_t i = 0; i < second; ++i)
+        out[i]();
+
+    // THEN
+    EXPECT_EQ(first, 3u);
+    EXPECT_EQ(second, 2u);
+    EXPECT_EQ(ran, (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @test A consumer takes no more than its fair share
+ *
+ * GIVEN a JobQueue holding 10 tasks
+ * WHEN one of 4 consumers pops with a batch limit of 8
+ * THEN it takes the first task plus 9 / 4 more, leaving 7 queued
+ */
+TEST_F(BatchTest, PopTasksTakesFairShare)
+{
+    // GIVEN
+    JobQueue          queue;
+    std::vector<int>  ran;
+    std::vector<Task> tasks = recordingTasks(10, ran);
+    queue.pushTasks(tasks.data(), tasks.size());
+
+    // WHEN
+    std::vector<Task> out(8);
+    const size_t      taken = queue.popTasks(out.data(), out.size(), 4);
+
+    // THEN
+    EXPECT_EQ(taken, 3u);
+    EXPECT_EQ(queue.size(), 7u);
+}
+
+/**
+ * @test Ring batches keep FIFO order and the fair share
+ *
+ * GIVEN a 16-slot RingJobQueue holding 10 tasks
+ * WHEN one of 4 consumers pops with a batch limit of 8, then a lone consumer does
+ * THEN the calls return 3 and 7 tasks which run in submission order
+ */
+TEST_F(BatchTest, RingPopTasksKeepsOrderAndFairShare)
+{
+    // GIVEN
+    RingJobQueue      queue(16);
+    std::vector<int>  ran;
+    std::vector<Task> tasks = recordingTasks(10, ran);
+    queue.pushTasks(tasks.data(), tasks.size());
+
+    // WHEN
+    std::vector<Task> out(8);
+    const size_t      first = queue.popTasks(out.data(), out.size(), 4);
+    for (size_t i = 0; i < first; ++i)
+        out[i]();
+    const size_t second = queue.popTasks(out.data(), out.size());
+    for (size_t i = 0; i < second; ++i)
+        out[i]();
+
+    // THEN
+    EXPECT_EQ(first, 3u);
+    EXPECT_EQ(second, 7u);
+    EXPECT_EQ(ran, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @test IJob batch helpers skip null jobs and report the closed state
+ *
+ * GIVEN a JobQueue fed by pushBatch() with 2 jobs and 1 nullptr, then closed
+ * WHEN popBatch(8) is called twice
+ * THEN the first call returns the 2 jobs and the second an empty batch
+ */
+TEST_F(BatchTest, JobBatchHelpers)
+{
+    // GIVEN
+    JobQueue                           queue;
+    std::atomic<int>                   executed{0};
+    std::vector<std::unique_ptr<IJob>> jobs = countingJobs(2, executed);
+    jobs.push_back(nullptr);
+    queue.pushBatch(jobs);
+    queue.shutdown();
+
+    // WHEN
+    std::vector<std::unique_ptr<IJob>> first  = queue.popBatch(8);
+    std::vector<std::unique_ptr<IJob>> second = queue.popBatch(8);
+
+    // THEN
+    ASSERT_EQ(first.size(), 2u);
+    for (auto& job : first)
+        job->execute();
+    EXPECT_EQ(executed.load(), 2);
+    EXPECT_TRUE(second.empty());
+}
+
+/**
+ * @test A ring batch larger than the capacity does not stall
+ *
+ * GIVEN a 4-slot RingJobQueue and a consumer popping batches
+ * WHEN 100 tasks are published with a single pushTasks() call
+ * THEN the consumer receives all of them
+ */
+TEST_F(BatchTest, RingBatchLargerThanCapacity)
+{
+    // GIVEN
+    RingJobQueue      queue(4);
+    std::atomic<int>  executed{0};
+    std::vector<Task> tasks;
+    for (int i = 0; i < 100; ++i)
+        tasks.emplace_back([&executed] { executed.fetch_add(1); });
+
+    std::thread consumer(
+        [&queue]
+        {
+            std::vector<Task> out(8);
+            while (const size_t count = queue.popTasks(out.data(), out.size()))
+            {
+                for (size_t i = 0; i < count; ++i)
+                    out[i]();
+            }
+        });
+
+    // WHEN
+    queue.pushTasks(tasks.data(), tasks.size());
+    while (!queue.empty())
+        std::this_thread::yield();
+    queue.shutdown();
+    consumer.join();
+
+    // THEN
+    EXPECT_EQ(executed.load(), 100);
+}
+
+/**
+ * @test enqueueBatch() runs every job in both scheduling modes
+ *
+ * GIVEN a shared-queue pool and a work-stealing pool with 4 workers each
+ * WHEN 1000 jobs are submitted to each with enqueueBatch() and the pools shut down
+ * THEN every job ran exactly once and the reports count them as completed
+ */
+TEST_F(BatchTest, PoolEnqueueBatchRunsEveryJob)
+{
+    for (auto mode : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                      ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPoolConfig config;
+        config.schedulingMode = mode;
+        ThreadPool       tPool(config);
+        std::atomic<int> executed{0};
+        tPool.start(4);
+
+        // WHEN
+        tPool.enqueueBatch(countingJobs(1000, executed));
+        const ThreadPool::ShutdownReport report = tPool.shutdown();
+
+        // THEN
+        EXPECT_EQ(executed.load(), 1000);
+        EXPECT_EQ(report.abandoned, 0u);
+        EXPECT_EQ(tPool.pending(), 0u);
+    }
+}
+
+/**
+ * @test enqueueBatch() on a bounded pool applies the overflow policy per job
+ *
+ * GIVEN a 1-thread pool bounded to 2 queued jobs with Reject, its worker held
+ * WHEN a batch of 5 jobs is submitted and the worker released
+ * THEN 2 jobs run and 3 are counted as rejected
+ */
+TEST_F(BatchTest, BoundedPoolAppliesPolicyPerJob)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.maxQueuedJobs  = 2;
+    config.overflowPolicy = ThreadPoolConfig::OverflowPolicy::Reject;
+    ThreadPool        tPool(config);
+    std::atomic<int>  executed{0};
+    std::atomic<bool> started{false};
+    std::atomic<bool> gate{false};
+    tPool.start(1);
+    tPool.post(
+        [&started, &gate]
+        {
+            started.store(true);
+            while (!gate.load())
+                std::this_thread::yield();
+        });
+    while (!started.load())
+        std::this_thread::yield();
+
+    // WHEN
+    tPool.enqueueBatch(countingJobs(5, executed));
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(executed.load(), 2);
+    EXPECT_EQ(tPool.backpressureStats().rejected, 3u);
+}
@@ -0,0 +1,340 @@
+/**
+ * @file        test_cancellation.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for cancellation tokens and job deadlines.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a pool whose only worker is held, or a bare Task
+ *  - WHEN: guarded jobs are queued, then cancelled or left to expire
+ *  - THEN: they are skipped at dequeue without running, counted, and their
+ *          futures break; unguarded and still-valid jobs run normally
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "cancellation.h"
+#include "fake_counting_job.h"
+#include "logger.h"
+#include "task.h"
+#include "thread_pool.h"
+#include "worker_gate.h"
+
+/*****************************************************************************/
+
+class CancellationTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Tokens observe their source
+ *
+ * GIVEN a detached token and two tokens of one source
+ * WHEN the source is cancelled
+ * THEN both tokens of the source report it and the detached one never does
+ */
+TEST_F(CancellationTest, TokensObserveSource)
+{
+    // GIVEN
+    CancellationToken  detached;
+    CancellationSource source;
+    CancellationToken  first  = source.token();
+    CancellationToken  second = first;
+    EXPECT_FALSE(detached.cancellable());
+    EXPECT_TRUE(first.cancellable());
+    EXPECT_FALSE(first.isCancelled());
+
+    // WHEN
+    source.cancel();
+
+    // THEN
+    EXPECT_TRUE(source.isCancelled());
+    EXPECT_TRUE(first.isCancelled());
+    EXPECT_TRUE(second.isCancelled());
+    EXPECT_FALSE(detached.isCancelled());
+}
+
+/**
+ * @test A guarded Task reports its verdict and stays inline
+ *
+ * GIVEN Tasks guarded by a token, by a past deadline (inline and on the heap),
+ *       and unguarded
+ * WHEN their guards are checked (before and after cancelling the token)
+ * THEN each reports Run, Cancelled or Expired, and small callables stay inline
+ */
+TEST_F(CancellationTest, GuardedTaskVerdicts)
+{
+    // GIVEN
+    CancellationSource                  source;
+    const auto                          past = JobGuard::Clock::now() - std::chrono::seconds(1);
+    int                                 runs = 0;
+    std::array<char, Task::kInlineSize> big{};
+
+    Task byToken([&runs] { ++runs; }, JobGuard(source.token()));
+    Task late([&runs] { ++runs; }, past);
+    Task large([big, &runs] { runs += big[0]; }, past);
+    Task plain([&runs] { ++runs; });
+    Task job(std::unique_ptr<IJob>(nullptr), JobGuard(source.token()));
+
+    // WHEN / THEN
+    EXPECT_TRUE(byToken.isInline());
+    EXPECT_EQ(byToken.check(), JobGuard::Verdict::Run);
+    EXPECT_EQ(late.check(), JobGuard::Verdict::Expired);
+    EXPECT_FALSE(large.isInline());
+    EXPECT_EQ(large.check(), JobGuard::Verdict::Expired);
+    EXPECT_EQ(plain.check(), JobGuard::Verdict::Run);
+    EXPECT_FALSE(job);
+
+    source.cancel();
+    EXPECT_EQ(byToken.check(), JobGuard::Verdict::Cancelled);
+    byToken();
+    EXPECT_EQ(runs, 1);
+}
+
+/**
+ * @test Cancelled jobs are skipped at dequeue
+ *
+ * GIVEN 1-thread pools (shared-queue and work-stealing) with the worker held
+ * WHEN 100 guarded callables and 100 guarded IJobs are queued, their token is
+ *      cancelled, one unguarded job is queued, and the worker is released
+ * THEN only the unguarded job runs, and 200 jobs are counted as cancelled
+ */
+TEST_F(CancellationTest, CancelledJobsAreSkipped)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPoolConfig config;
+        config.schedulingMode = scheduling;
+        ThreadPool         tPool(config);
+        std::atomic<int>   counter{0};
+        std::atomic<bool>  gate{false};
+        CancellationSource source;
+        tPool.start(1);
+        holdWorker(tPool, gate);
+
+        // WHEN
+        for (int i = 0; i < 100; ++i)
+        {
+            tPool.post([&counter] { counter.fetch_add(1); }, source.token());
+            tPool.enqueue(std::make_unique<FakeCountingJob>(counter), source.token());
+        }
+        source.cancel();
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+        gate.store(true);
+        const ThreadPool::ShutdownReport report = tPool.shutdown();
+
+        // THEN
+        EXPECT_EQ(counter.load(), 1);
+        EXPECT_EQ(tPool.metrics().cancelled, 200u);
+        EXPECT_EQ(tPool.metrics().expired, 0u);
+        EXPECT_EQ(tPool.metrics().pending, 0u);
+        EXPECT_EQ(report.abandoned, 0u);
+    }
+}
+
+/**
+ * @test Jobs dequeued past their deadline are skipped
+ *
+ * GIVEN a 1-thread pool with the worker held
+ * WHEN a job with a 1 ms timeout and a job with a 1 h timeout are queued,
+ *      and the worker is released 20 ms later
+ * THEN only the second job runs and one job is counted as expired
+ */
+TEST_F(CancellationTest, ExpiredJobsAreSkipped)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<int>  counter{0};
+    std::atomic<bool> gate{false};
+    tPool.start(1);
+    holdWorker(tPool, gate);
+
+    // WHEN
+    tPool.enqueue(std::make_unique<FakeCountingJob>(counter), std::chrono::milliseconds(1));
+    tPool.post([&counter] { counter.fetch_add(10); }, std::chrono::hours(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(counter.load(), 10);
+    EXPECT_EQ(tPool.metrics().expired, 1u);
+    EXPECT_EQ(tPool.metrics().cancelled, 0u);
+}
+
+/**
+ * @test CallerRuns honours guards too
+ *
+ * GIVEN a held worker and a queue bounded to 1 job with the CallerRuns policy, already full
+ * WHEN a job under a cancelled token and a job past its deadline overflow the queue
+ * THEN the submitting thread runs neither, and they are counted as cancelled and expired
+ */
+TEST_F(CancellationTest, CallerRunsSkipsGuardedJobs)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.maxQueuedJobs  = 1;
+    config.overflowPolicy = ThreadPoolConfig::OverflowPolicy::CallerRuns;
+    ThreadPool         tPool(config);
+    std::atomic<int>   counter{0};
+    std::atomic<bool>  gate{false};
+    CancellationSource source;
+    tPool.start(1);
+    holdWorker(tPool, gate);
+    tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+
+    // WHEN
+    source.cancel();
+    tPool.post([&counter] { counter.fetch_add(10); }, source.token());
+    tPool.enqueue(std::make_unique<FakeCountingJob>(counter),
+                  JobGuard::Clock::now() - std::chrono::seconds(1));
+    const int ranOnCaller = counter.load();
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(ranOnCaller, 0);
+    EXPECT_EQ(counter.load(), 1);
+    EXPECT_EQ(tPool.backpressureStats().callerRuns, 2u);
+    EXPECT_EQ(tPool.metrics().cancelled, 1u);
+    EXPECT_EQ(tPool.metrics().expired, 1u);
+    EXPECT_EQ(tPool.metrics().pending, 0u);
+}
+
+/**
+ * @test A skipped submission breaks its future
+ *
+ * GIVEN a 1-thread pool with the worker held
+ * WHEN a callable is submitted under a token that is then cancelled
+ * THEN get() throws broken_promise once the worker is released
+ */
+TEST_F(CancellationTest, SkippedSubmitBreaksFuture)
+{
+    // GIVEN
+    ThreadPool         tPool;
+    std::atomic<bool>  gate{false};
+    CancellationSource source;
+    tPool.start(1);
+    holdWorker(tPool, gate);
+
+    // WHEN
+    TaskFuture<int> future = tPool.submit([] { return 1; }, source.token());
+    source.cancel();
+    gate.store(true);
+
+    // THEN
+    try
+    {
+        future.get();
+        ADD_FAILURE() << "get() did not throw";
+    }
+    catch (const std::future_error& e)
+    {
+        EXPECT_EQ(e.code(), std::make_error_code(std::future_errc::broken_promise));
+    }
+    tPool.shutdown();
+}
+
+/**
+ * @test Guarded jobs handed back by shutdownNow() keep their guard
+ *
+ * GIVEN a 1-thread pool busy with a 100 ms job and two guarded FakeCountingJobs
+ *       queued behind it, each under its own token
+ * WHEN shutdownNow() hands them back, one token is cancelled and both are executed
+ * THEN only the job whose token is still valid runs
+ */
+TEST_F(CancellationTest, HandedBackJobsKeepTheirGuard)
+{
+    // GIVEN
+    ThreadPool         tPool;
+    CancellationSource kept;
+    CancellationSource dropped;
+    std::atomic<bool>  started{false};
+    std::atomic<int>   keptRuns{0};
+    std::atomic<int>   droppedRuns{0};
+    tPool.start(1);
+    tPool.post(
+        [&started]
+        {
+            started.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        });
+    tPool.enqueue(std::make_unique<FakeCountingJob>(keptRuns), JobGuard(kept.token()));
+    tPool.enqueue(std::make_unique<FakeCountingJob>(droppedRuns), JobGuard(dropped.token()));
+    while (!started.load())
+        std::this_thread::yield();
+
+    // WHEN
+    std::vector<std::unique_ptr<IJob>> unexecuted = tPool.shutdownNow();
+    dropped.cancel();
+    for (auto& job : unexecuted)
+        job->execute();
+
+    // THEN
+    EXPECT_EQ(unexecuted.size(), 2u);
+    EXPECT_EQ(keptRuns.load(), 1);
+    EXPECT_EQ(droppedRuns.load(), 0);
+}
+
+/**
+ * @test A running job stops by polling its token
+ *
+ * GIVEN a 2-thread pool and a submitted job looping until its token is cancelled
+ * WHEN the token is cancelled once the job runs
+ * THEN the job returns and its future completes normally
+ */
+TEST_F(CancellationTest, RunningJobPollsToken)
+{
+    // GIVEN
+    ThreadPool         tPool;
+    CancellationSource source;
+    std::atomic<bool>  started{false};
+    tPool.start(2);
+
+    TaskFuture<int> future = tPool.submit(
+        [&started, token = source.token()]
+        {
+            int iterations = 0;
+            started.store(true);
+            while (!token.isCancelled())
+            {
+                ++iterations;
+                std::this_thread::yield();
+            }
+            return iterations;
+        },
+        source.token());
+
+    // WHEN
+    while (!started.load())
+        std::this_thread::yield();
+    source.cancel();
+
+    // THEN
+    EXPECT_GE(future.get(), 0);
+    tPool.shutdown();
+    EXPECT_EQ(tPool.metrics().cancelled, 0u);
+}
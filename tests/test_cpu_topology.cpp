@@ -0,0 +1,269 @@
+/**
+ * @file        test_cpu_topology.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for CpuTopology and worker CPU pinning.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a CPU list, a fake `/sys/devices/system/cpu` tree or a pool config
+ *  - WHEN: the topology is read, filtered or ordered, or workers start
+ *  - THEN: the expected CPUs come out, in the expected order
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+/* Project libraries */
+
+#include "cpu_topology.h"
+#include "logger.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class CpuTopologyTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Two packages x two cores x two hyper-threads, numbered like most x86 servers.
+     *
+     * @details
+     * CPU c sits on package (and NUMA node) (c % 4) / 2, core c % 2; CPUs c
+     * and c + 4 are siblings.
+     */
+    static std::vector<CpuInfo> twoSocketMachine()
+    {
+        std::vector<CpuInfo> cpus;
+        for (int c = 0; c < 8; ++c)
+            cpus.push_back(CpuInfo{c, c % 2, (c % 4) / 2, (c % 4) / 2});
+        return cpus;
+    }
+
+#if defined(__linux__)
+    /**
+     * @brief Writes `cpus` as a sysfs CPU tree under `root` and a node tree under `root`/node.
+     */
+    static void writeSysfs(const std::string& root, const std::vector<CpuInfo>& cpus,
+                           const std::string& online)
+    {
+        ASSERT_EQ(std::system(("mkdir -p " + root + "/node/node0 " + root + "/node/node1").c_str()),
+                  0);
+        std::ofstream(root + "/online") << online << "\n";
+        std::ofstream(root + "/node/online") << "0-1\n";
+        std::ofstream(root + "/node/node0/cpulist") << "0-1,4-5\n";
+        std::ofstream(root + "/node/node1/cpulist") << "2-3,6-7\n";
+        for (const auto& info : cpus)
+        {
+            const std::string dir = root + "/cpu" + std::to_string(info.cpu) + "/topology";
+            ASSERT_EQ(std::system(("mkdir -p " + dir).c_str()), 0);
+            std::ofstream(dir + "/core_id") << info.core << "\n";
+            std::ofstream(dir + "/physical_package_id") << info.package << "\n";
+        }
+    }
+
+    /**
+     * @brief First CPU the calling thread may run on.
+     */
+    static int firstAllowedCpu()
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        sched_getaffinity(0, sizeof(set), &set);
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            if (CPU_ISSET(cpu, &set))
+                return cpu;
+        return 0;
+    }
+#endif
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Kernel CPU lists are parsed, sorted and deduplicated
+ *
+ * GIVEN CPU list strings with ranges, singles and malformed items
+ * WHEN they are parsed
+ * THEN the valid CPU numbers come out in ascending order
+ */
+TEST_F(CpuTopologyTest, ParsesCpuLists)
+{
+    EXPECT_EQ(CpuTopology::parseCpuList("0-3,8,10-11\n"),
+              (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(CpuTopology::parseCpuList("5,x,3,3,2-1"), (std::vector<int>{3, 5}));
+    EXPECT_TRUE(CpuTopology::parseCpuList("").empty());
+}
+
+/**
+ * @test Compact and scatter orders follow cores and packages
+ *
+ * GIVEN a 2-package, 2-core, 2-thread topology
+ * WHEN the placement orders are computed
+ * THEN compact fills siblings, then cores, then packages, and scatter
+ *      alternates packages and cores before using any sibling
+ */
+TEST_F(CpuTopologyTest, CompactAndScatterOrders)
+{
+    // GIVEN
+    const CpuTopology topology(twoSocketMachine());
+
+    // WHEN / THEN
+    EXPECT_EQ(topology.compactOrder(), (std::vector<int>{0, 4, 1, 5, 2, 6, 3, 7}));
+    EXPECT_EQ(topology.scatterOrder(), (std::vector<int>{0, 2, 1, 3, 4, 6, 5, 7}));
+}
+
+/**
+ * @test Package and physical-core filters keep the right CPUs
+ *
+ * GIVEN a 2-package, 2-core, 2-thread topology
+ * WHEN it is restricted to package 1, or to physical cores
+ * THEN package 1 holds CPUs 2, 3, 6, 7 and the physical cores are CPUs 0-3
+ */
+TEST_F(CpuTopologyTest, FiltersPackageAndPhysicalCores)
+{
+    // GIVEN
+    const CpuTopology topology(twoSocketMachine());
+
+    // WHEN
+    const CpuTopology socket = topology.onPackage(1);
+    const CpuTopology cores  = topology.physicalCores();
+
+    // THEN
+    EXPECT_EQ(topology.packages(), (std::vector<int>{0, 1}));
+    EXPECT_EQ(socket.compactOrder(), (std::vector<int>{2, 6, 3, 7}));
+    EXPECT_EQ(cores.compactOrder(), (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(topology.onPackage(1).physicalCores().scatterOrder(), (std::vector<int>{2, 3}));
+}
+
+/**
+ * @test Without a sysfs tree every hardware thread is its own core
+ *
+ * GIVEN a directory that does not exist
+ * WHEN the topology is detected from it
+ * THEN it reports hardware_concurrency() CPUs on package 0 and node 0
+ */
+TEST_F(CpuTopologyTest, FallsBackWithoutSysfs)
+{
+    // WHEN
+    const CpuTopology topology = CpuTopology::detect("/nonexistent/cpu");
+
+    // THEN
+    const size_t expected = std::max(1u, std::thread::hardware_concurrency());
+    EXPECT_EQ(topology.size(), expected);
+    EXPECT_EQ(topology.packages(), (std::vector<int>{0}));
+    EXPECT_EQ(CpuTopology::detect("/nonexistent/cpu", "/nonexistent/node").nodes(),
+              (std::vector<int>{0}));
+}
+
+#if defined(__linux__)
+/**
+ * @test The topology is read from a sysfs tree
+ *
+ * GIVEN a fake sysfs tree of the 2-package, 2-node machine with CPU 5 offline
+ * WHEN it is detected
+ * THEN the 7 online CPUs come out with their cores, packages and nodes
+ */
+TEST_F(CpuTopologyTest, ReadsSysfsTree)
+{
+    // GIVEN
+    const std::string root = "test_cpu_topology_sysfs";
+    writeSysfs(root, twoSocketMachine(), "0-4,6-7");
+
+    // WHEN
+    const CpuTopology topology = CpuTopology::detect(root, root + "/node");
+    ASSERT_EQ(std::system(("rm -rf " + root).c_str()), 0);
+
+    // THEN
+    EXPECT_EQ(topology.size(), 7u);
+    EXPECT_EQ(topology.compactOrder(), (std::vector<int>{0, 4, 1, 2, 6, 3, 7}));
+    EXPECT_EQ(topology.cpus()[5].cpu, 6);
+    EXPECT_EQ(topology.cpus()[5].package, 1);
+    EXPECT_EQ(topology.cpus()[5].core, 0);
+    EXPECT_EQ(topology.cpus()[5].node, 1);
+    EXPECT_EQ(topology.nodes(), (std::vector<int>{0, 1}));
+    EXPECT_EQ(topology.onNode(0).cpuNumbers(), (std::vector<int>{0, 1, 4}));
+}
+
+/**
+ * @test Workers of an explicit placement run on their CPU only
+ *
+ * GIVEN a 2-thread pool pinned to the first CPU this process may use
+ * WHEN every worker reports its affinity mask from a job
+ * THEN each mask holds exactly that CPU
+ */
+TEST_F(CpuTopologyTest, PoolPinsWorkers)
+{
+    // GIVEN
+    const int        cpu = firstAllowedCpu();
+    ThreadPoolConfig config;
+    config.cpuPlacement = ThreadPoolConfig::CpuPlacement::Explicit;
+    config.cpuList      = {cpu};
+    ThreadPool       tPool(config);
+    std::atomic<int> pinned{0};
+    tPool.start(2);
+
+    // WHEN
+    for (int i = 0; i < 20; ++i)
+    {
+        tPool.post(
+            [&pinned, cpu]
+            {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                sched_getaffinity(0, sizeof(set), &set);
+                if (CPU_COUNT(&set) == 1 && CPU_ISSET(cpu, &set))
+                    pinned.fetch_add(1);
+            });
+    }
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(pinned.load(), 20);
+}
+#endif
+
+/**
+ * @test A CPU that cannot be used leaves workers unpinned but working
+ *
+ * GIVEN a pool whose explicit placement names a CPU that does not exist
+ * WHEN jobs are submitted
+ * THEN they all run
+ */
+TEST_F(CpuTopologyTest, UnusableCpuStillRuns)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.cpuPlacement = ThreadPoolConfig::CpuPlacement::Explicit;
+    config.cpuList      = {1 << 20};
+    ThreadPool       tPool(config);
+    std::atomic<int> counter{0};
+    tPool.start(2);
+
+    // WHEN
+    for (int i = 0; i < 10; ++i)
+        tPool.post([&counter] { counter.fetch_add(1); });
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(counter.load(), 10);
+}
@@ -0,0 +1,286 @@
+/**
+ * @file        test_elastic_pool.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for runtime resizing (`ThreadPool::resize()`) and the auto-scaler.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a running pool (every queue backend and scheduling mode)
+ *  - WHEN: it is resized, or the auto-scaler sees a backlog or idle workers
+ *  - THEN: the worker count follows and no accepted job is lost
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "logger.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class ElasticPoolTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Every (backend, scheduling mode) pair.
+     */
+    static std::vector<ThreadPoolConfig> allConfigs()
+    {
+        std::vector<ThreadPoolConfig> configs;
+        for (auto backend : {ThreadPoolConfig::QueueBackend::Mutex,
+                             ThreadPoolConfig::QueueBackend::LockFreeRing,
+                             ThreadPoolConfig::QueueBackend::NumaSharded})
+        {
+            for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                                    ThreadPoolConfig::SchedulingMode::WorkStealing})
+            {
+                ThreadPoolConfig config;
+                config.queueBackend    = backend;
+                config.schedulingMode  = scheduling;
+                config.maxThreads      = 4;
+                config.workerBatchSize = 1;  // a held batch would hide queued jobs from the others
+                configs.push_back(config);
+            }
+        }
+        return configs;
+    }
+
+    /**
+     * @brief Polls `condition` for up to 2 s.
+     */
+    static bool eventually(const std::function<bool()>& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Growing starts workers that run concurrently
+ *
+ * GIVEN a 1-thread pool with maxThreads = 4
+ * WHEN it is resized to 3 and 3 jobs wait for each other
+ * THEN size() is 3 and all 3 jobs are running at the same time
+ */
+TEST_F(ElasticPoolTest, GrowRunsMoreJobsAtOnce)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.maxThreads      = 4;
+    config.workerBatchSize = 1;
+    ThreadPool tPool(config);
+    tPool.start(1);
+
+    // WHEN
+    tPool.resize(3);
+    std::atomic<int>  running{0};
+    std::atomic<bool> gate{false};
+    for (int i = 0; i < 3; ++i)
+    {
+        tPool.post(
+            [&]
+            {
+                running.fetch_add(1);
+                while (!gate.load())
+                    std::this_thread::yield();
+            });
+    }
+
+    // THEN
+    EXPECT_EQ(tPool.size(), 3u);
+    EXPECT_TRUE(eventually([&] { return running.load() == 3; }));
+    gate.store(true);
+    tPool.shutdown();
+}
+
+/**
+ * @test Shrinking retires idle workers on every backend
+ *
+ * GIVEN idle 4-thread pools (every backend, both scheduling modes)
+ * WHEN they are resized to 1
+ * THEN size() drops to 1 and the remaining worker still runs 100 jobs
+ */
+TEST_F(ElasticPoolTest, ShrinkRetiresIdleWorkers)
+{
+    for (const auto& config : allConfigs())
+    {
+        // GIVEN
+        ThreadPool       tPool(config);
+        std::atomic<int> counter{0};
+        tPool.start(4);
+
+        // WHEN
+        tPool.resize(1);
+
+        // THEN
+        EXPECT_TRUE(eventually([&] { return tPool.size() == 1; }));
+        for (int i = 0; i < 100; ++i)
+            tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+        tPool.shutdown();
+        EXPECT_EQ(counter.load(), 100);
+    }
+}
+
+/**
+ * @test Shrinking while busy loses no queued job
+ *
+ * GIVEN 3-thread pools whose workers are all blocked, with 60 jobs queued behind them
+ * WHEN they are resized to 1 and the workers are released
+ * THEN every job runs and size() ends at 1
+ */
+TEST_F(ElasticPoolTest, ShrinkWhileBusyKeepsQueuedJobs)
+{
+    for (const auto& config : allConfigs())
+    {
+        // GIVEN
+        ThreadPool        tPool(config);
+        std::atomic<int>  counter{0};
+        std::atomic<int>  blocked{0};
+        std::atomic<bool> gate{false};
+        tPool.start(3);
+        for (int i = 0; i < 3; ++i)
+        {
+            tPool.post(
+                [&]
+                {
+                    blocked.fetch_add(1);
+                    while (!gate.load())
+                        std::this_thread::yield();
+                });
+        }
+        EXPECT_TRUE(eventually([&] { return blocked.load() == 3; }));
+        for (int i = 0; i < 60; ++i)
+            tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+
+        // WHEN
+        tPool.resize(1);
+        gate.store(true);
+
+        // THEN
+        EXPECT_TRUE(eventually([&] { return counter.load() == 60; }));
+        EXPECT_TRUE(eventually([&] { return tPool.size() == 1; }));
+        tPool.shutdown();
+        EXPECT_EQ(counter.load(), 60);
+    }
+}
+
+/**
+ * @test Resize is clamped and reuses the slots of retired workers
+ *
+ * GIVEN a 3-thread pool with maxThreads = 3
+ * WHEN it is resized to 0, then to 10
+ * THEN it keeps 1 worker, then grows back to 3, and metrics() still has 3 slots
+ */
+TEST_F(ElasticPoolTest, ResizeClampsAndReusesSlots)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.maxThreads = 3;
+    ThreadPool tPool(config);
+    tPool.start(3);
+
+    // WHEN / THEN
+    tPool.resize(0);
+    EXPECT_TRUE(eventually([&] { return tPool.size() == 1; }));
+
+    tPool.resize(10);
+    EXPECT_EQ(tPool.size(), 3u);
+    EXPECT_EQ(tPool.metrics().workers.size(), 3u);
+
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 30; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    tPool.shutdown();
+    EXPECT_EQ(counter.load(), 30);
+    EXPECT_EQ(tPool.size(), 0u);
+}
+
+/**
+ * @test The auto-scaler adds workers while jobs wait too long
+ *
+ * GIVEN a 1-thread pool with autoScale, timing, a 1 ms queue-wait target and maxThreads = 3
+ * WHEN 40 jobs of 5 ms each are queued
+ * THEN the pool grows beyond 1 worker
+ */
+TEST_F(ElasticPoolTest, AutoScaleGrowsUnderBacklog)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.autoScale       = true;
+    config.collectMetrics  = true;
+    config.maxThreads      = 3;
+    config.targetQueueWait = std::chrono::milliseconds(1);
+    config.scaleInterval   = std::chrono::milliseconds(10);
+    ThreadPool tPool(config);
+    tPool.start(1);
+
+    // WHEN
+    for (int i = 0; i < 40; ++i)
+        tPool.post([] { std::this_thread::sleep_for(std::chrono::milliseconds(5)); });
+
+    // THEN
+    EXPECT_TRUE(eventually([&] { return tPool.size() > 1; }));
+    tPool.shutdown();
+}
+
+/**
+ * @test The auto-scaler retires workers idle for longer than the keep-alive
+ *
+ * GIVEN idle 4-thread pools with autoScale, minThreads = 2 and a 20 ms keep-alive
+ * WHEN they stay idle
+ * THEN they shrink to 2 workers and still run new jobs
+ */
+TEST_F(ElasticPoolTest, AutoScaleRetiresIdleWorkers)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPoolConfig config;
+        config.schedulingMode = scheduling;
+        config.autoScale      = true;
+        config.maxThreads     = 4;
+        config.minThreads     = 2;
+        config.keepAlive      = std::chrono::milliseconds(20);
+        config.scaleInterval  = std::chrono::milliseconds(10);
+        ThreadPool       tPool(config);
+        std::atomic<int> counter{0};
+        tPool.start(4);
+
+        // WHEN / THEN
+        EXPECT_TRUE(eventually([&] { return tPool.size() == 2; }));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_EQ(tPool.size(), 2u);
+
+        for (int i = 0; i < 20; ++i)
+            tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+        tPool.shutdown();
+        EXPECT_EQ(counter.load(), 20);
+    }
+}
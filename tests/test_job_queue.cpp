@@ -16,11 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <thread>
 
 /* Project libraries */
 
+#include "fake_counting_job.h"
 #include "job_queue.h"
 #include "logger.h"
 #include "print_job.h"
@@ -114,4 +116,42 @@ TEST_F(JobQueueTest, ShutdownBehaviour)
 
     // THEN
     EXPECT_EQ(queue.pop(), nullptr);
-}
\ No newline at end of file
+}
+
+/**
+ * @test interrupt() releases blocked and future consumers of an open queue
+ *
+ * GIVEN an empty, open queue and a consumer blocked in pop()
+ * WHEN interrupt(2) is called
+ * THEN the blocked consumer returns nullptr, one more pop() returns nullptr
+ *      at once, and the queue still delivers pushed jobs afterwards
+ */
+TEST_F(JobQueueTest, InterruptReleasesConsumers)
+{
+    // GIVEN
+    JobQueue queue;
+    std::atomic<bool> released{false};
+    std::thread       consumer(
+        [&]
+        {
+            if (!queue.pop())
+                released.store(true);
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // WHEN
+    queue.interrupt(2);
+    consumer.join();
+
+    // THEN
+    EXPECT_TRUE(released.load());
+    EXPECT_EQ(queue.pop(), nullptr);
+    EXPECT_FALSE(queue.is_closed());
+
+    std::atomic<int> counter{0};
+    queue.push(std::make_unique<FakeCountingJob>(counter));
+    auto job = queue.pop();
+    ASSERT_NE(job, nullptr);
+    job->execute();
+    EXPECT_EQ(counter.load(), 1);
+}
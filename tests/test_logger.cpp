@@ -0,0 +1,219 @@
+/**
+ * @file        test_logger.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for the Logger (synchronous and asynchronous modes).
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a logger in a given mode with stdout captured
+ *  - WHEN: one or several threads log messages
+ *  - THEN: every line is written (or accounted as dropped) in per-thread order
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "logger.h"
+
+/*****************************************************************************/
+
+class LoggerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::INFO); }
+
+    void TearDown() override
+    {
+        Logger::stop_async();
+        Logger::set_min_level(Logger::Level::WARN);
+    }
+
+    /**
+     * @brief Returns the captured lines containing `tag`.
+     */
+    static std::vector<std::string> linesWith(const std::string& output, const std::string& tag)
+    {
+        std::vector<std::string> lines;
+        std::istringstream       in(output);
+        std::string              line;
+        while (std::getline(in, line))
+        {
+            if (line.find(tag) != std::string::npos)
+                lines.push_back(line);
+        }
+        return lines;
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Asynchronous mode writes every message, in order, with the usual format
+ *
+ * GIVEN the logger in asynchronous mode
+ * WHEN one thread logs 200 messages, one DEBUG message and calls flush()
+ * THEN the 200 INFO lines appear in order and the DEBUG one is filtered
+ */
+TEST_F(LoggerTest, AsyncWritesInOrder)
+{
+    // GIVEN
+    testing::internal::CaptureStdout();
+    Logger::start_async();
+    ASSERT_TRUE(Logger::is_async());
+
+    // WHEN
+    for (int i = 0; i < 200; ++i)
+        Logger::info("async-" + std::to_string(i) + ";");
+    Logger::debug("async-hidden;");
+    Logger::flush();
+    const std::string output = testing::internal::GetCapturedStdout();
+
+    // THEN
+    std::vector<std::string> lines = linesWith(output, "async-");
+    ASSERT_EQ(lines.size(), 200u);
+    for (int i = 0; i < 200; ++i)
+    {
+        EXPECT_NE(lines[i].find("[INFO] async-" + std::to_string(i) + ";"), std::string::npos);
+        EXPECT_EQ(lines[i][0], '[');
+    }
+}
+
+/**
+ * @test BLOCK policy never loses a message under contention
+ *
+ * GIVEN the logger in asynchronous mode with 4-slot rings and BLOCK policy
+ * WHEN 4 threads log 500 messages each and the backend is stopped
+ * THEN all 2000 lines are written, per-thread order holds, nothing dropped
+ */
+TEST_F(LoggerTest, AsyncBlockPolicyLosesNothing)
+{
+    // GIVEN
+    testing::internal::CaptureStdout();
+    Logger::start_async(4, Logger::OverflowPolicy::BLOCK);
+
+    // WHEN
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t)
+    {
+        producers.emplace_back(
+            [t]
+            {
+                for (int i = 0; i < 500; ++i)
+                    Logger::info("blk-" + std::to_string(t) + "-" + std::to_string(i) + ";");
+            });
+    }
+    for (auto& producer : producers)
+        producer.join();
+    Logger::stop_async();
+    const std::string output = testing::internal::GetCapturedStdout();
+
+    // THEN
+    EXPECT_FALSE(Logger::is_async());
+    EXPECT_EQ(Logger::dropped_count(), 0u);
+    EXPECT_EQ(linesWith(output, "blk-").size(), 2000u);
+    for (int t = 0; t < 4; ++t)
+    {
+        std::vector<std::string> lines = linesWith(output, "blk-" + std::to_string(t) + "-");
+        ASSERT_EQ(lines.size(), 500u);
+        for (int i = 0; i < 500; ++i)
+            ASSERT_NE(lines[i].find("-" + std::to_string(i) + ";"), std::string::npos);
+    }
+}
+
+/**
+ * @test DROP policy accounts for every message it does not write
+ *
+ * GIVEN the logger in asynchronous mode with 2-slot rings and DROP policy
+ * WHEN one thread logs 1000 messages in a burst and the backend is stopped
+ * THEN written + dropped == 1000, and drops are reported in the output
+ */
+TEST_F(LoggerTest, AsyncDropPolicyCountsOverflow)
+{
+    // GIVEN
+    testing::internal::CaptureStdout();
+    Logger::start_async(2, Logger::OverflowPolicy::DROP);
+
+    // WHEN
+    for (int i = 0; i < 1000; ++i)
+        Logger::info("drop-" + std::to_string(i) + ";");
+    Logger::stop_async();
+    const std::string output = testing::internal::GetCapturedStdout();
+
+    // THEN
+    const uint64_t dropped = Logger::dropped_count();
+    EXPECT_EQ(linesWith(output, "drop-").size() + dropped, 1000u);
+    if (dropped > 0)
+        EXPECT_FALSE(linesWith(output, "message(s) dropped").empty());
+}
+
+/**
+ * @test stop_async() returns to synchronous logging
+ *
+ * GIVEN a logger that was asynchronous and has been stopped
+ * WHEN a message is logged
+ * THEN it is written immediately, without flush()
+ */
+TEST_F(LoggerTest, StopRestoresSyncMode)
+{
+    // GIVEN
+    Logger::start_async();
+    Logger::stop_async();
+    testing::internal::CaptureStdout();
+
+    // WHEN
+    Logger::warn("sync-after-stop");
+    const std::string output = testing::internal::GetCapturedStdout();
+
+    // THEN
+    EXPECT_FALSE(Logger::is_async());
+    EXPECT_EQ(linesWith(output, "[WARN] sync-after-stop").size(), 1u);
+}
+
+/**
+ * @test LOG_* macros do not evaluate the message of a disabled level
+ *
+ * GIVEN a logger filtering below WARN
+ * WHEN LOG_DEBUG / LOG_INFO and LOG_WARN are given a message with a side effect
+ * THEN only the WARN message is built and printed
+ */
+TEST_F(LoggerTest, MacrosSkipDisabledMessages)
+{
+    // GIVEN
+    Logger::set_min_level(Logger::Level::WARN);
+    int  built   = 0;
+    auto message = [&built](const char* text)
+    {
+        ++built;
+        return std::string(text);
+    };
+    testing::internal::CaptureStdout();
+
+    // WHEN
+    LOG_DEBUG(message("lazy-debug"));
+    LOG_INFO(message("lazy-info"));
+    LOG_WARN(message("lazy-warn"));
+    const std::string output = testing::internal::GetCapturedStdout();
+
+    // THEN
+    EXPECT_TRUE(linesWith(output, "lazy-debug").empty());
+    EXPECT_TRUE(linesWith(output, "lazy-info").empty());
+#if LOGGER_COMPILE_LEVEL <= 2
+    EXPECT_EQ(built, 1);
+    EXPECT_EQ(linesWith(output, "[WARN] lazy-warn").size(), 1u);
+#else
+    EXPECT_EQ(built, 0);
+#endif
+}
@@ -0,0 +1,268 @@
+/**
+ * @file        test_metrics.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for LatencyHistogram and ThreadPool::metrics().
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a histogram, or a pool running a known set of jobs
+ *  - WHEN: samples are recorded or a metrics snapshot is taken
+ *  - THEN: counts are exact and percentiles within the bucket resolution
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "latency_histogram.h"
+#include "logger.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+using std::chrono::milliseconds;
+
+class MetricsTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Relative error allowed by 32 sub-buckets per power of two.
+     */
+    static constexpr double kResolution = 1.0 / 32.0;
+
+    /**
+     * @brief Config with job timing enabled.
+     */
+    static ThreadPoolConfig timed()
+    {
+        ThreadPoolConfig config;
+        config.collectMetrics = true;
+        return config;
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Percentiles of a uniform distribution stay within the bucket resolution
+ *
+ * GIVEN a histogram
+ * WHEN the values 1..100000 ns are recorded once each
+ * THEN count, max and sum are exact and p50 / p99 are within ~3 %
+ */
+TEST_F(MetricsTest, HistogramPercentilesWithinResolution)
+{
+    // GIVEN
+    LatencyHistogram histogram;
+
+    // WHEN
+    for (uint64_t ns = 1; ns <= 100000; ++ns)
+        histogram.record(ns);
+    const HistogramSnapshot snapshot = histogram.snapshot();
+
+    // THEN
+    EXPECT_EQ(snapshot.count(), 100000u);
+    EXPECT_EQ(snapshot.max(), 100000u);
+    EXPECT_EQ(snapshot.min(), 1u);
+    EXPECT_EQ(snapshot.sum(), 100000ull * 100001ull / 2);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(50)), 50000.0, 50000.0 * kResolution);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(99)), 99000.0, 99000.0 * kResolution);
+    EXPECT_EQ(snapshot.percentile(100), 100000u);
+}
+
+/**
+ * @test Every value maps to a bucket whose bounds contain it
+ *
+ * GIVEN values across the whole range, including the clamped top
+ * WHEN each value is mapped to its bucket
+ * THEN lowerBoundOf(bucket) <= value <= upperBoundOf(bucket) (below the clamp)
+ */
+TEST_F(MetricsTest, BucketBoundsContainValue)
+{
+    // GIVEN
+    const uint64_t values[] = {0, 1, 31, 32, 33, 63, 64, 65, 1000, 123456789, (1ull << 44) - 1};
+
+    for (uint64_t value : values)
+    {
+        // WHEN
+        const size_t bucket = LatencyHistogram::bucketOf(value);
+
+        // THEN
+        ASSERT_LT(bucket, LatencyHistogram::kBuckets);
+        EXPECT_LE(LatencyHistogram::lowerBoundOf(bucket), value);
+        EXPECT_GE(LatencyHistogram::upperBoundOf(bucket), value);
+    }
+    EXPECT_EQ(LatencyHistogram::bucketOf(1ull << 50), LatencyHistogram::kBuckets - 1);
+}
+
+/**
+ * @test Merged snapshots add up
+ *
+ * GIVEN two histograms with disjoint samples
+ * WHEN their snapshots are merged
+ * THEN the result holds every sample and the larger maximum
+ */
+TEST_F(MetricsTest, SnapshotsMerge)
+{
+    // GIVEN
+    LatencyHistogram fast;
+    LatencyHistogram slow;
+    for (int i = 0; i < 90; ++i)
+        fast.record(100);
+    for (int i = 0; i < 10; ++i)
+        slow.record(1000000);
+
+    // WHEN
+    HistogramSnapshot merged = fast.snapshot();
+    merged.merge(slow.snapshot());
+
+    // THEN
+    EXPECT_EQ(merged.count(), 100u);
+    EXPECT_EQ(merged.max(), 1000000u);
+    EXPECT_NEAR(static_cast<double>(merged.percentile(90)), 100.0, 100.0 * kResolution);
+    EXPECT_NEAR(static_cast<double>(merged.percentile(95)), 1000000.0, 1000000.0 * kResolution);
+    EXPECT_DOUBLE_EQ(merged.mean(), (90.0 * 100 + 10.0 * 1000000) / 100);
+}
+
+/**
+ * @test The pool counts every job per worker and keeps totals after shutdown
+ *
+ * GIVEN a 2-thread pool timing its jobs
+ * WHEN 90 counting jobs and 10 throwing jobs run
+ * THEN both snapshots list 2 workers, and after shutdown the totals show
+ *      100 executed, 10 failed and 100 timed samples in each histogram
+ */
+TEST_F(MetricsTest, PoolCountsEveryJob)
+{
+    // GIVEN
+    ThreadPool       tPool(timed());
+    std::atomic<int> counter{0};
+    tPool.start(2);
+
+    // WHEN
+    for (int i = 0; i < 90; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    for (int i = 0; i < 10; ++i)
+        tPool.post([] { throw std::runtime_error("boom"); });
+    const ThreadPool::Metrics live = tPool.metrics();
+    tPool.shutdown();
+    const ThreadPool::Metrics after = tPool.metrics();
+
+    // THEN
+    EXPECT_EQ(live.workers.size(), 2u);
+    EXPECT_EQ(after.workers.size(), 2u);
+    EXPECT_EQ(after.workers[0].executed + after.workers[1].executed, 100u);
+    EXPECT_EQ(after.total.executed, 100u);
+    EXPECT_EQ(after.total.failed, 10u);
+    EXPECT_EQ(after.total.queueWait.count(), 100u);
+    EXPECT_EQ(after.total.execution.count(), 100u);
+    EXPECT_EQ(after.pending, 0u);
+    EXPECT_GT(after.uptime.count(), 0);
+    EXPECT_GT(after.throughput(), 0.0);
+}
+
+/**
+ * @test Queue wait and execution time reflect what the jobs did
+ *
+ * GIVEN a 1-thread pool timing its jobs
+ * WHEN two 20 ms jobs are enqueued back to back
+ * THEN both executions take >= 20 ms and the second one waited >= 20 ms
+ */
+TEST_F(MetricsTest, LatenciesReflectJobDuration)
+{
+    // GIVEN
+    ThreadPool tPool(timed());
+    tPool.start(1);
+
+    // WHEN
+    for (int i = 0; i < 2; ++i)
+        tPool.post([] { std::this_thread::sleep_for(milliseconds(20)); });
+    tPool.shutdown();
+    const ThreadPool::Metrics metrics = tPool.metrics();
+
+    // THEN
+    const uint64_t twentyMs = std::chrono::nanoseconds(milliseconds(20)).count();
+    EXPECT_GE(metrics.total.execution.min(), twentyMs * (1.0 - kResolution));
+    EXPECT_GE(metrics.total.queueWait.max(), twentyMs);
+    EXPECT_GE(metrics.total.busy, milliseconds(40));
+}
+
+/**
+ * @test metrics() can be called while workers run, and counters never go back
+ *
+ * GIVEN a 2-thread pool processing 20000 empty jobs
+ * WHEN metrics() is sampled repeatedly during the run
+ * THEN `executed` is monotonic and reaches 20000
+ */
+TEST_F(MetricsTest, SnapshotWhileRunning)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(2);
+    std::thread producer(
+        [&tPool]
+        {
+            for (int i = 0; i < 20000; ++i)
+                tPool.post([] {});
+        });
+
+    // WHEN
+    size_t previous  = 0;
+    bool   monotonic = true;
+    for (int i = 0; i < 200; ++i)
+    {
+        const size_t executed = tPool.metrics().total.executed;
+        monotonic             = monotonic && executed >= previous;
+        previous              = executed;
+    }
+    producer.join();
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_TRUE(monotonic);
+    EXPECT_EQ(tPool.metrics().total.executed, 20000u);
+}
+
+/**
+ * @test With collectMetrics off, counters still work but nothing is timed
+ *
+ * GIVEN a pool configured with collectMetrics = false
+ * WHEN 10 jobs run
+ * THEN executed == 10 and both histograms are empty
+ */
+TEST_F(MetricsTest, TimingCanBeDisabled)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.collectMetrics = false;
+    ThreadPool       tPool(config);
+    std::atomic<int> counter{0};
+    tPool.start(1);
+
+    // WHEN
+    for (int i = 0; i < 10; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    tPool.shutdown();
+    const ThreadPool::Metrics metrics = tPool.metrics();
+
+    // THEN
+    EXPECT_EQ(metrics.total.executed, 10u);
+    EXPECT_EQ(metrics.total.queueWait.count(), 0u);
+    EXPECT_EQ(metrics.total.execution.count(), 0u);
+}
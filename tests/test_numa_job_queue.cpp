@@ -0,0 +1,235 @@
+/**
+ * @file        test_numa_job_queue.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for NumaJobQueue and the NumaSharded pool backend.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a two-node topology (CPUs 0-1 on node 0, CPUs 2-3 on node 1)
+ *  - WHEN: threads bound to a node push and pop
+ *  - THEN: tasks stay on their node's shard and are only stolen when a shard is empty
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "cpu_topology.h"
+#include "fake_counting_job.h"
+#include "logger.h"
+#include "numa_job_queue.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class NumaJobQueueTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief CPUs 0-1 on node 0 and CPUs 2-3 on node 1.
+     */
+    static CpuTopology twoNodes()
+    {
+        std::vector<CpuInfo> cpus;
+        for (int c = 0; c < 4; ++c)
+            cpus.push_back(CpuInfo{c, c, c / 2, c / 2});
+        return CpuTopology(cpus);
+    }
+
+    /**
+     * @brief Task that stores `id` into `ran` when executed.
+     */
+    static Task tagged(std::atomic<int>& ran, int id)
+    {
+        return Task([&ran, id] { ran.store(id); });
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test One shard per node, with its CPUs
+ *
+ * GIVEN a two-node topology
+ * WHEN a NumaJobQueue is built from it
+ * THEN it has two shards mapping CPUs 0-1 and 2-3; unknown CPUs map to shard 0
+ */
+TEST_F(NumaJobQueueTest, ShardsFollowNodes)
+{
+    // WHEN
+    NumaJobQueue queue(twoNodes());
+
+    // THEN
+    ASSERT_EQ(queue.shardCount(), 2u);
+    EXPECT_EQ(queue.nodeOf(1), 1);
+    EXPECT_EQ(queue.cpusOf(1), (std::vector<int>{2, 3}));
+    EXPECT_EQ(queue.shardOf(1), 0u);
+    EXPECT_EQ(queue.shardOf(3), 1u);
+    EXPECT_EQ(queue.shardOf(99), 0u);
+}
+
+/**
+ * @test Pushes go to the caller's shard
+ *
+ * GIVEN a two-node queue and a thread bound to shard 1
+ * WHEN that thread pushes 3 tasks (one by one and as a batch)
+ * THEN shard 1 holds all of them and shard 0 none
+ */
+TEST_F(NumaJobQueueTest, PushGoesToCallerShard)
+{
+    // GIVEN
+    NumaJobQueue     queue(twoNodes());
+    std::atomic<int> ran{0};
+
+    // WHEN
+    std::thread producer(
+        [&]
+        {
+            queue.bindCurrentThread(1);
+            queue.pushTask(tagged(ran, 1));
+            Task batch[2] = {tagged(ran, 2), tagged(ran, 3)};
+            queue.pushTasks(batch, 2);
+        });
+    producer.join();
+
+    // THEN
+    EXPECT_EQ(queue.shardSize(1), 3u);
+    EXPECT_EQ(queue.shardSize(0), 0u);
+    EXPECT_EQ(queue.size(), 3u);
+}
+
+/**
+ * @test A consumer drains its own shard before stealing
+ *
+ * GIVEN task 10 in shard 0 and task 20 in shard 1
+ * WHEN a consumer bound to shard 1 pops twice
+ * THEN it gets 20 first (no steal), then 10 (one steal)
+ */
+TEST_F(NumaJobQueueTest, PopPrefersLocalShard)
+{
+    // GIVEN
+    NumaJobQueue     queue(twoNodes());
+    std::atomic<int> ran{0};
+    queue.bindCurrentThread(0);
+    queue.pushTask(tagged(ran, 10));
+    queue.bindCurrentThread(1);
+    queue.pushTask(tagged(ran, 20));
+
+    // WHEN / THEN
+    Task task;
+    ASSERT_TRUE(queue.tryPopTask(task));
+    task();
+    EXPECT_EQ(ran.load(), 20);
+    EXPECT_EQ(queue.stolenCount(), 0u);
+
+    ASSERT_TRUE(queue.tryPopTask(task));
+    task();
+    EXPECT_EQ(ran.load(), 10);
+    EXPECT_EQ(queue.stolenCount(), 1u);
+    EXPECT_FALSE(queue.tryPopTask(task));
+}
+
+/**
+ * @test A sleeping consumer wakes up for work pushed on another node
+ *
+ * GIVEN a consumer bound to shard 0 blocked in popTask()
+ * WHEN a thread bound to shard 1 pushes a task
+ * THEN the consumer takes it (as a steal)
+ */
+TEST_F(NumaJobQueueTest, SleeperWakesForRemotePush)
+{
+    // GIVEN
+    NumaJobQueue     queue(twoNodes());
+    std::atomic<int> ran{0};
+    std::thread      consumer(
+        [&]
+        {
+            queue.bindCurrentThread(0);
+            Task task;
+            if (queue.popTask(task))
+                task();
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // WHEN
+    queue.bindCurrentThread(1);
+    queue.pushTask(tagged(ran, 7));
+    consumer.join();
+
+    // THEN
+    EXPECT_EQ(ran.load(), 7);
+    EXPECT_EQ(queue.stolenCount(), 1u);
+}
+
+/**
+ * @test Closing drains the shards, then pops fail
+ *
+ * GIVEN a closed queue with one task in each shard
+ * WHEN popTask() is called three times
+ * THEN the first two return the tasks and the third returns false without blocking
+ */
+TEST_F(NumaJobQueueTest, ShutdownDrainsThenStops)
+{
+    // GIVEN
+    NumaJobQueue     queue(twoNodes());
+    std::atomic<int> ran{0};
+    queue.bindCurrentThread(0);
+    queue.pushTask(tagged(ran, 1));
+    queue.bindCurrentThread(1);
+    queue.pushTask(tagged(ran, 2));
+    queue.shutdown();
+
+    // WHEN / THEN
+    Task task;
+    EXPECT_TRUE(queue.popTask(task));
+    EXPECT_TRUE(queue.popTask(task));
+    EXPECT_FALSE(queue.popTask(task));
+    EXPECT_TRUE(queue.is_closed());
+}
+
+/**
+ * @test A pool with the NumaSharded backend runs every job
+ *
+ * GIVEN pools with the NumaSharded backend (shared-queue and work-stealing modes)
+ * WHEN 200 jobs are submitted from the test thread
+ * THEN all of them run
+ */
+TEST_F(NumaJobQueueTest, PoolRunsEveryJob)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPoolConfig config;
+        config.queueBackend   = ThreadPoolConfig::QueueBackend::NumaSharded;
+        config.schedulingMode = scheduling;
+        ThreadPool       tPool(config);
+        std::atomic<int> counter{0};
+        tPool.start(3);
+
+        // WHEN
+        for (int i = 0; i < 100; ++i)
+        {
+            tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+            tPool.post([&counter] { counter.fetch_add(1); });
+        }
+        tPool.shutdown();
+
+        // THEN
+        EXPECT_EQ(counter.load(), 200);
+    }
+}
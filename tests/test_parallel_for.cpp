@@ -0,0 +1,254 @@
+/**
+ * @file        test_parallel_for.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for parallelFor / parallelReduce.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a pool and an index range
+ *  - WHEN: a parallel loop or reduction runs over it
+ *  - THEN: every index is visited exactly once and results match a sequential loop
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/* Project libraries */
+
+#include "logger.h"
+#include "parallel_for.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class ParallelForTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Every index is visited exactly once
+ *
+ * GIVEN a 4-thread pool and 100000 counters
+ * WHEN parallelFor increments the counter of every index it is given
+ * THEN every counter is 1
+ */
+TEST_F(ParallelForTest, VisitsEveryIndexOnce)
+{
+    // GIVEN
+    const size_t                  count = 100000;
+    std::vector<std::atomic<int>> hits(count);
+    ThreadPool                    tPool;
+    tPool.start(4);
+
+    // WHEN
+    parallelFor(tPool, 0, count,
+                [&hits](size_t first, size_t last)
+                {
+                    for (size_t i = first; i < last; ++i)
+                        hits[i].fetch_add(1, std::memory_order_relaxed);
+                });
+    tPool.shutdown();
+
+    // THEN
+    size_t visitedOnce = 0;
+    for (const auto& hit : hits)
+        visitedOnce += hit.load() == 1 ? 1 : 0;
+    EXPECT_EQ(visitedOnce, count);
+}
+
+/**
+ * @test An explicit grain bounds the sub-ranges handed to the body
+ *
+ * GIVEN a 2-thread pool and a grain of 7
+ * WHEN parallelFor runs over 1000 indices
+ * THEN no sub-range is empty or larger than 7 and together they cover 1000 indices
+ */
+TEST_F(ParallelForTest, GrainBoundsSubRanges)
+{
+    // GIVEN
+    ThreadPool          tPool;
+    std::atomic<size_t> covered{0};
+    std::atomic<bool>   outOfBounds{false};
+    tPool.start(2);
+
+    // WHEN
+    parallelFor(
+        tPool, 0, 1000,
+        [&](size_t first, size_t last)
+        {
+            if (last <= first || last - first > 7)
+                outOfBounds.store(true);
+            covered.fetch_add(last - first);
+        },
+        7);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_FALSE(outOfBounds.load());
+    EXPECT_EQ(covered.load(), 1000u);
+}
+
+/**
+ * @test parallelReduce matches the sequential sum
+ *
+ * GIVEN a 4-thread pool
+ * WHEN the indices 0..999999 are summed with parallelReduce
+ * THEN the result is n (n - 1) / 2
+ */
+TEST_F(ParallelForTest, ReduceSumsRange)
+{
+    // GIVEN
+    const std::uint64_t count = 1000000;
+    ThreadPool          tPool;
+    tPool.start(4);
+
+    // WHEN
+    const std::uint64_t sum = parallelReduce(
+        tPool, 0, count, std::uint64_t{0},
+        [](size_t first, size_t last, std::uint64_t partial)
+        {
+            for (size_t i = first; i < last; ++i)
+                partial += i;
+            return partial;
+        },
+        [](std::uint64_t a, std::uint64_t b) { return a + b; });
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(sum, count * (count - 1) / 2);
+}
+
+/**
+ * @test Partials are combined in index order
+ *
+ * GIVEN a 3-thread pool and a non-commutative combine (string concatenation)
+ * WHEN the indices 0..299 are reduced with a grain of 1
+ * THEN the result equals the sequential concatenation
+ */
+TEST_F(ParallelForTest, ReduceKeepsIndexOrder)
+{
+    // GIVEN
+    ThreadPool  tPool;
+    std::string expected;
+    for (size_t i = 0; i < 300; ++i)
+        expected += std::to_string(i) + ",";
+    tPool.start(3);
+
+    // WHEN
+    const std::string joined = parallelReduce(
+        tPool, 0, 300, std::string(),
+        [](size_t first, size_t last, std::string partial)
+        {
+            for (size_t i = first; i < last; ++i)
+                partial += std::to_string(i) + ",";
+            return partial;
+        },
+        [](std::string a, const std::string& b) { return a + b; }, 1);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(joined, expected);
+}
+
+/**
+ * @test Empty ranges do nothing
+ *
+ * GIVEN a running pool
+ * WHEN parallelFor and parallelReduce get an empty range
+ * THEN the body is never called and the reduction returns the identity
+ */
+TEST_F(ParallelForTest, EmptyRangeIsNoOp)
+{
+    // GIVEN
+    ThreadPool       tPool;
+    std::atomic<int> calls{0};
+    tPool.start(2);
+
+    // WHEN
+    parallelFor(tPool, 5, 5, [&calls](size_t, size_t) { calls.fetch_add(1); });
+    const int result = parallelReduce(
+        tPool, 9, 3, 42,
+        [&calls](size_t, size_t, int partial)
+        {
+            calls.fetch_add(1);
+            return partial;
+        },
+        [](int a, int b) { return a + b; });
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(calls.load(), 0);
+    EXPECT_EQ(result, 42);
+}
+
+/**
+ * @test An exception thrown by the body reaches the caller
+ *
+ * GIVEN a 2-thread pool
+ * WHEN the body throws for one index
+ * THEN parallelFor rethrows it
+ */
+TEST_F(ParallelForTest, BodyExceptionPropagates)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(2);
+
+    // WHEN / THEN
+    EXPECT_THROW(parallelFor(
+                     tPool, 0, 1000,
+                     [](size_t first, size_t last)
+                     {
+                         if (first <= 500 && 500 < last)
+                             throw std::runtime_error("index 500");
+                     },
+                     10),
+                 std::runtime_error);
+    tPool.shutdown();
+}
+
+/**
+ * @test A loop started from inside a job of a 1-thread pool completes
+ *
+ * GIVEN a 1-thread pool
+ * WHEN a submitted job runs parallelFor over 10000 indices
+ * THEN the job finishes within 2 s and every index was visited
+ */
+TEST_F(ParallelForTest, NestedInsideJob)
+{
+    // GIVEN
+    ThreadPool          tPool;
+    std::atomic<size_t> covered{0};
+    tPool.start(1);
+
+    // WHEN
+    TaskFuture<void> outer = tPool.submit(
+        [&tPool, &covered]
+        {
+            parallelFor(tPool, 0, 10000,
+                        [&covered](size_t first, size_t last) { covered.fetch_add(last - first); });
+        });
+    const bool finished = outer.waitFor(std::chrono::seconds(2));
+
+    // THEN
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(covered.load(), 10000u);
+    tPool.shutdown();
+}
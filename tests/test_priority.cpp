@@ -0,0 +1,218 @@
+/**
+ * @file        test_priority.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for the priority lanes of JobQueue and ThreadPool::enqueue(job, priority).
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: tasks queued in several priority lanes
+ *  - WHEN: they are popped (directly or by a pool worker)
+ *  - THEN: higher lanes go first, FIFO holds per lane, aging lets low lanes through
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "job_queue.h"
+#include "logger.h"
+#include "thread_pool.h"
+#include "worker_gate.h"
+
+/*****************************************************************************/
+
+class PriorityTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::WARN); }
+
+    /**
+     * @brief Pushes a task recording `id` into the lane of `priority`.
+     */
+    void push(JobQueue& queue, int id, JobPriority priority)
+    {
+        queue.pushPriorityTask(Task([this, id] { ran.push_back(id); }), priority);
+    }
+
+    /**
+     * @brief Pops and runs every queued task.
+     */
+    static void drain(JobQueue& queue)
+    {
+        Task task;
+        while (queue.tryPopTask(task))
+            task();
+    }
+
+    std::vector<int> ran;
+};
+
+/**
+ * @brief Job appending its id to a shared vector.
+ */
+class RecordingJob : public IJob
+{
+   public:
+    RecordingJob(int id, std::mutex& mtx, std::vector<int>& ran) : id(id), mtx(mtx), ran(ran) {}
+
+    void execute() override
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        ran.push_back(id);
+    }
+
+   private:
+    int               id;
+    std::mutex&       mtx;
+    std::vector<int>& ran;
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Higher lanes are served first, FIFO within a lane
+ *
+ * GIVEN a strict-priority JobQueue holding Low 1, Normal 2, Critical 3, Normal 4, High 5
+ * WHEN every task is popped
+ * THEN they run as 3, 5, 2, 4, 1
+ */
+TEST_F(PriorityTest, HighestLaneFirstFifoWithinLane)
+{
+    // GIVEN
+    JobQueue queue;
+    push(queue, 1, JobPriority::Low);
+    push(queue, 2, JobPriority::Normal);
+    push(queue, 3, JobPriority::Critical);
+    push(queue, 4, JobPriority::Normal);
+    push(queue, 5, JobPriority::High);
+
+    // WHEN
+    drain(queue);
+
+    // THEN
+    EXPECT_EQ(ran, (std::vector<int>{3, 5, 2, 4, 1}));
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @test Without aging a low lane waits for every higher job
+ *
+ * GIVEN a strict-priority JobQueue with one Low job queued before 6 Critical jobs
+ * WHEN every task is popped
+ * THEN the Low job runs last
+ */
+TEST_F(PriorityTest, StrictPriorityServesLowLast)
+{
+    // GIVEN
+    JobQueue queue;
+    push(queue, 0, JobPriority::Low);
+    for (int id = 1; id <= 6; ++id)
+        push(queue, id, JobPriority::Critical);
+
+    // WHEN
+    drain(queue);
+
+    // THEN
+    EXPECT_EQ(ran.back(), 0);
+}
+
+/**
+ * @test Aging lets a passed-over lane through
+ *
+ * GIVEN a JobQueue with aging threshold 2, one Low job and 6 Critical jobs
+ * WHEN every task is popped
+ * THEN the Low job runs third, after being passed over twice
+ */
+TEST_F(PriorityTest, AgingPreventsStarvation)
+{
+    // GIVEN
+    JobQueue queue(2);
+    push(queue, 0, JobPriority::Low);
+    for (int id = 1; id <= 6; ++id)
+        push(queue, id, JobPriority::Critical);
+
+    // WHEN
+    drain(queue);
+
+    // THEN
+    EXPECT_EQ(ran, (std::vector<int>{1, 2, 0, 3, 4, 5, 6}));
+}
+
+/**
+ * @test ThreadPool::enqueue(job, priority) reorders queued work
+ *
+ * GIVEN 1-thread pools (shared-queue and work-stealing) whose worker is busy
+ * WHEN Low, two Normal, Critical and High jobs are enqueued in that order and the worker freed
+ * THEN they run as Critical, High, Normal (in FIFO order), Low
+ */
+TEST_F(PriorityTest, PoolRunsHigherPriorityFirst)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPoolConfig config;
+        config.schedulingMode = scheduling;
+        ThreadPool        tPool(config);
+        std::mutex        ranMtx;
+        std::vector<int>  order;
+        std::atomic<bool> gate{false};
+        tPool.start(1);
+        holdWorker(tPool, gate);
+
+        // WHEN
+        tPool.enqueue(std::make_unique<RecordingJob>(5, ranMtx, order), JobPriority::Low);
+        tPool.enqueue(std::make_unique<RecordingJob>(3, ranMtx, order), JobPriority::Normal);
+        tPool.enqueue(std::make_unique<RecordingJob>(4, ranMtx, order), JobPriority::Normal);
+        tPool.enqueue(std::make_unique<RecordingJob>(1, ranMtx, order), JobPriority::Critical);
+        tPool.enqueue(std::make_unique<RecordingJob>(2, ranMtx, order), JobPriority::High);
+        gate.store(true);
+        tPool.shutdown();
+
+        // THEN
+        EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4, 5}));
+    }
+}
+
+/**
+ * @test A work-stealing worker's prioritized submissions keep their lanes
+ *
+ * GIVEN a 1-thread work-stealing pool
+ * WHEN a job enqueues a Low job, then a High job
+ * THEN the High job runs first, instead of the deque's LIFO order deciding
+ */
+TEST_F(PriorityTest, WorkerSubmissionsKeepPriority)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.schedulingMode = ThreadPoolConfig::SchedulingMode::WorkStealing;
+    ThreadPool       tPool(config);
+    std::mutex       ranMtx;
+    std::vector<int> order;
+    tPool.start(1);
+
+    // WHEN
+    tPool.post(
+        [&]
+        {
+            tPool.enqueue(std::make_unique<RecordingJob>(2, ranMtx, order), JobPriority::Low);
+            tPool.enqueue(std::make_unique<RecordingJob>(1, ranMtx, order), JobPriority::High);
+        });
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+}
@@ -0,0 +1,227 @@
+/**
+ * @file        test_ring_job_queue.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for the lock-free RingJobQueue backend.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a ring with a given capacity
+ *  - WHEN: producers / consumers operate on it
+ *  - THEN: it keeps the same semantics as JobQueue
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "fake_job.h"
+#include "logger.h"
+#include "ring_job_queue.h"
+
+/*****************************************************************************/
+
+class RingJobQueueTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::WARN); }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Capacity is rounded up to a power of two
+ *
+ * GIVEN a requested capacity of 100
+ * WHEN the ring is built
+ * THEN its capacity is 128
+ */
+TEST_F(RingJobQueueTest, CapacityIsPowerOfTwo)
+{
+    // GIVEN / WHEN
+    RingJobQueue queue(100);
+
+    // THEN
+    EXPECT_EQ(queue.capacity(), 128u);
+}
+
+/**
+ * @test Push and pop preserve FIFO order
+ *
+ * GIVEN an empty ring
+ * WHEN two jobs are pushed
+ * THEN they are popped in the same order
+ */
+TEST_F(RingJobQueueTest, PushPopKeepsOrder)
+{
+    // GIVEN
+    RingJobQueue queue(4);
+    auto         first    = std::make_unique<FakeJob>();
+    auto         second   = std::make_unique<FakeJob>();
+    IJob*        firstPtr = first.get();
+    IJob*        secondPtr = second.get();
+
+    // WHEN
+    queue.push(std::move(first));
+    queue.push(std::move(second));
+
+    // THEN
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue.pop().get(), firstPtr);
+    EXPECT_EQ(queue.pop().get(), secondPtr);
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @test Shutdown drains remaining jobs before returning nullptr
+ *
+ * GIVEN a ring with one pending job
+ * WHEN shutdown() is called
+ * THEN pop() still returns the job, and nullptr afterwards
+ */
+TEST_F(RingJobQueueTest, ShutdownDrainsThenReturnsNull)
+{
+    // GIVEN
+    RingJobQueue queue(4);
+    queue.push(std::make_unique<FakeJob>());
+
+    // WHEN
+    queue.shutdown();
+
+    // THEN
+    EXPECT_TRUE(queue.is_closed());
+    EXPECT_NE(queue.pop(), nullptr);
+    EXPECT_EQ(queue.pop(), nullptr);
+}
+
+/**
+ * @test Shutdown wakes a parked consumer
+ *
+ * GIVEN a consumer blocked on pop() of an empty ring
+ * WHEN shutdown() is called
+ * THEN pop() returns nullptr
+ */
+TEST_F(RingJobQueueTest, ShutdownWakesParkedConsumer)
+{
+    // GIVEN
+    RingJobQueue          queue(4);
+    std::atomic<bool>     done{false};
+    std::unique_ptr<IJob> popped = std::make_unique<FakeJob>();
+
+    std::thread consumer(
+        [&]()
+        {
+            popped = queue.pop();
+            done.store(true, std::memory_order_release);
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // WHEN
+    queue.shutdown();
+    consumer.join();
+
+    // THEN
+    EXPECT_TRUE(done.load(std::memory_order_acquire));
+    EXPECT_EQ(popped, nullptr);
+}
+
+/**
+ * @test Multiple producers and consumers on a small ring
+ *
+ * GIVEN a ring of capacity 8, 4 producers and 4 consumers
+ * WHEN each producer pushes 2000 jobs (forcing wrap-around and full-ring waits)
+ * THEN every job is popped and executed exactly once
+ */
+TEST_F(RingJobQueueTest, MultiProducerMultiConsumer)
+{
+    // GIVEN
+    constexpr int    kProducers = 4;
+    constexpr int    kConsumers = 4;
+    constexpr int    kPerProducer = 2000;
+    RingJobQueue     queue(8);
+    std::atomic<int> executed{0};
+
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < kConsumers; ++i)
+    {
+        consumers.emplace_back(
+            [&]()
+            {
+                while (auto job = queue.pop())
+                    job->execute();
+            });
+    }
+
+    // WHEN
+    std::vector<std::thread> producers;
+    for (int i = 0; i < kProducers; ++i)
+    {
+        producers.emplace_back(
+            [&]()
+            {
+                for (int j = 0; j < kPerProducer; ++j)
+                    queue.push(std::make_unique<FakeCountingJob>(executed));
+            });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    queue.shutdown();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // THEN
+    EXPECT_EQ(executed.load(), kProducers * kPerProducer);
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @test interrupt() releases blocked and future consumers of an open queue
+ *
+ * GIVEN an empty, open queue and a consumer blocked in pop()
+ * WHEN interrupt(2) is called
+ * THEN the blocked consumer returns nullptr, one more pop() returns nullptr
+ *      at once, and the queue still delivers pushed jobs afterwards
+ */
+TEST_F(RingJobQueueTest, InterruptReleasesConsumers)
+{
+    // GIVEN
+    RingJobQueue queue(8);
+    std::atomic<bool> released{false};
+    std::thread       consumer(
+        [&]
+        {
+            if (!queue.pop())
+                released.store(true);
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // WHEN
+    queue.interrupt(2);
+    consumer.join();
+
+    // THEN
+    EXPECT_TRUE(released.load());
+    EXPECT_EQ(queue.pop(), nullptr);
+    EXPECT_FALSE(queue.is_closed());
+
+    std::atomic<int> counter{0};
+    queue.push(std::make_unique<FakeCountingJob>(counter));
+    auto job = queue.pop();
+    ASSERT_NE(job, nullptr);
+    job->execute();
+    EXPECT_EQ(counter.load(), 1);
+}
@@ -0,0 +1,283 @@
+/**
+ * @file        test_spin_wait.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for SpinWait and the spin-then-park consumers of the queue backends.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a spin policy (disabled, fixed or adaptive), or queues using one
+ *  - WHEN: consumers wait for work
+ *  - THEN: they spin within the budget, the budget follows the waits, and no
+ *          task is lost when producers skip waking parked consumers
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "cpu_topology.h"
+#include "fake_counting_job.h"
+#include "job_queue.h"
+#include "logger.h"
+#include "numa_job_queue.h"
+#include "ring_job_queue.h"
+#include "spin_wait.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class SpinWaitTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Adaptive policy with room to grow.
+     */
+    static SpinPolicy adaptivePolicy()
+    {
+        SpinPolicy policy;
+        policy.maxSpins = 1024;
+        policy.yields   = 2;
+        return policy;
+    }
+
+    /**
+     * @brief 2 producers push 2000 tasks each, one by one and in batches, to 3 consumers.
+     *
+     * @return Tasks run.
+     */
+    static int transfer(IJobQueue& queue)
+    {
+        std::atomic<int>         counter{0};
+        std::vector<std::thread> consumers;
+        for (int c = 0; c < 3; ++c)
+        {
+            consumers.emplace_back(
+                [&]
+                {
+                    Task batch[4];
+                    while (const size_t count = queue.popTasks(batch, 4, 3))
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                            batch[i]();
+                    }
+                });
+        }
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < 2; ++p)
+        {
+            producers.emplace_back(
+                [&]
+                {
+                    for (int i = 0; i < 1000; ++i)
+                        queue.pushTask(Task([&counter] { counter.fetch_add(1); }));
+                    for (int i = 0; i < 500; ++i)
+                    {
+                        Task pair[2] = {Task([&counter] { counter.fetch_add(1); }),
+                                        Task([&counter] { counter.fetch_add(1); })};
+                        queue.pushTasks(pair, 2);
+                    }
+                });
+        }
+
+        for (auto& producer : producers)
+            producer.join();
+        queue.shutdown();
+        for (auto& consumer : consumers)
+            consumer.join();
+        return counter.load();
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test The default policy never spins
+ *
+ * GIVEN a SpinWait with the default policy
+ * WHEN until() waits for a condition that never holds
+ * THEN the condition is checked once and until() returns false
+ */
+TEST_F(SpinWaitTest, DefaultPolicyChecksOnce)
+{
+    // GIVEN
+    SpinWait spin;
+    int      checks = 0;
+
+    // WHEN
+    const bool ready = spin.until(
+        [&]
+        {
+            ++checks;
+            return false;
+        });
+
+    // THEN
+    EXPECT_FALSE(ready);
+    EXPECT_EQ(checks, 1);
+    EXPECT_EQ(spin.budget(), 0u);
+}
+
+/**
+ * @test until() stops as soon as the condition holds
+ *
+ * GIVEN a fixed policy of 1000 spins
+ * WHEN the condition holds on its 10th check
+ * THEN until() returns true after exactly 10 checks and no spinner is left
+ */
+TEST_F(SpinWaitTest, SpinsUntilReady)
+{
+    // GIVEN
+    SpinPolicy policy;
+    policy.maxSpins = 1000;
+    policy.adaptive = false;
+    SpinWait spin(policy);
+    int      checks = 0;
+
+    // WHEN
+    const bool ready = spin.until([&] { return ++checks == 10; });
+
+    // THEN
+    EXPECT_TRUE(ready);
+    EXPECT_EQ(checks, 10);
+    EXPECT_EQ(spin.spinning(), 0u);
+    EXPECT_EQ(spin.budget(), 1000u);
+}
+
+/**
+ * @test The yield phase follows the spin phase
+ *
+ * GIVEN a policy of 5 spins and 3 yields
+ * WHEN the condition never holds
+ * THEN it is checked 1 + 5 + 3 times and until() returns false
+ */
+TEST_F(SpinWaitTest, YieldsBeforeGivingUp)
+{
+    // GIVEN
+    SpinPolicy policy;
+    policy.maxSpins = 5;
+    policy.yields   = 3;
+    policy.adaptive = false;
+    SpinWait spin(policy);
+    int      checks = 0;
+
+    // WHEN
+    const bool ready = spin.until(
+        [&]
+        {
+            ++checks;
+            return false;
+        });
+
+    // THEN
+    EXPECT_FALSE(ready);
+    EXPECT_EQ(checks, 9);
+}
+
+/**
+ * @test The adaptive budget decays on misses and grows back on late hits
+ *
+ * GIVEN an adaptive policy of at most 1024 spins
+ * WHEN 100 waits miss, then 40 waits are only met during the yield phase
+ * THEN the budget drops to kMinSpins, then grows well above it, never past 1024
+ */
+TEST_F(SpinWaitTest, AdaptiveBudgetFollowsWaits)
+{
+    // GIVEN
+    SpinWait spin(adaptivePolicy());
+    EXPECT_EQ(spin.budget(), 1024u);
+
+    // WHEN / THEN
+    for (int i = 0; i < 100; ++i)
+        spin.until([] { return false; });
+    EXPECT_EQ(spin.budget(), size_t{SpinWait::kMinSpins});
+
+    for (int i = 0; i < 40; ++i)
+    {
+        const size_t due    = spin.budget() + 2;  // first check of the yield phase
+        size_t       checks = 0;
+        EXPECT_TRUE(spin.until([&] { return ++checks == due; }));
+    }
+    EXPECT_GT(spin.budget(), 256u);
+    EXPECT_LE(spin.budget(), 1024u);
+}
+
+/**
+ * @test Spinning consumers lose no task on any backend
+ *
+ * GIVEN a JobQueue, a RingJobQueue and a NumaJobQueue with a spin policy
+ * WHEN 2 producers push 4000 tasks to 3 consumers
+ * THEN every task runs exactly once
+ */
+TEST_F(SpinWaitTest, SpinningQueuesDeliverEveryTask)
+{
+    // GIVEN
+    std::vector<std::unique_ptr<IJobQueue>> queues;
+    queues.emplace_back(new JobQueue(0, adaptivePolicy()));
+    queues.emplace_back(new RingJobQueue(256, adaptivePolicy()));
+    queues.emplace_back(new NumaJobQueue(CpuTopology::detect(), 0, adaptivePolicy()));
+
+    for (auto& queue : queues)
+    {
+        // WHEN / THEN
+        EXPECT_EQ(transfer(*queue), 4000);
+    }
+}
+
+/**
+ * @test Pools with idle spinning run every job
+ *
+ * GIVEN pools on every backend and scheduling mode, with and without idle spinning
+ * WHEN 300 jobs are submitted in small bursts
+ * THEN all of them run
+ */
+TEST_F(SpinWaitTest, SpinningPoolsRunEveryJob)
+{
+    for (auto backend : {ThreadPoolConfig::QueueBackend::Mutex,
+                         ThreadPoolConfig::QueueBackend::LockFreeRing,
+                         ThreadPoolConfig::QueueBackend::NumaSharded})
+    {
+        for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                                ThreadPoolConfig::SchedulingMode::WorkStealing})
+        {
+            for (size_t yields : {0u, 4u})
+            {
+                // GIVEN
+                ThreadPoolConfig config;
+                config.queueBackend   = backend;
+                config.schedulingMode = scheduling;
+                config.idleSpinLimit  = 1024;
+                config.idleYields     = yields;
+                ThreadPool       tPool(config);
+                std::atomic<int> counter{0};
+                tPool.start(3);
+
+                // WHEN
+                for (int i = 0; i < 300; ++i)
+                {
+                    tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+                    if (i % 10 == 0)
+                        std::this_thread::yield();
+                }
+                tPool.shutdown();
+
+                // THEN
+                EXPECT_EQ(counter.load(), 300);
+            }
+        }
+    }
+}
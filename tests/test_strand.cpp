@@ -0,0 +1,326 @@
+/**
+ * @file        test_strand.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for Strand and KeyedStrands (serial executors).
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a pool and one or more strands over it
+ *  - WHEN: jobs are posted, enqueued or submitted from several threads
+ *  - THEN: jobs of one strand run one at a time in FIFO order, different
+ *          strands run in parallel, and refusals break futures instead of hanging
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "logger.h"
+#include "strand.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class StrandTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Config for the given scheduling mode.
+     */
+    static ThreadPoolConfig mode(ThreadPoolConfig::SchedulingMode scheduling)
+    {
+        ThreadPoolConfig config;
+        config.schedulingMode = scheduling;
+        return config;
+    }
+
+    /**
+     * @brief Yields until `flag` is set or 5 s elapse; returns whether it was set.
+     */
+    static bool awaitFlag(const std::atomic<bool>& flag)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!flag.load())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::yield();
+        }
+        return true;
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Jobs of one strand run one at a time, in submission order
+ *
+ * GIVEN 4-thread pools (shared-queue and work-stealing) and one strand
+ * WHEN 2000 jobs are posted, every 10th one also posting a follow-up from inside
+ * THEN no two jobs overlap, the posted jobs run in order, and every job runs
+ */
+TEST_F(StrandTest, FifoOneAtATime)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPool tPool(mode(scheduling));
+        tPool.start(4);
+        Strand           strand(tPool);
+        std::atomic<int> active{0};
+        std::atomic<int> overlaps{0};
+        int              next       = 0;  // only touched on the strand
+        int              outOfOrder = 0;
+        int              followUps  = 0;
+
+        // WHEN
+        for (int i = 0; i < 2000; ++i)
+        {
+            strand.post(
+                [&, i]
+                {
+                    if (active.fetch_add(1) != 0)
+                        overlaps.fetch_add(1);
+                    if (i != next++)
+                        ++outOfOrder;
+                    if (i % 10 == 0)
+                        strand.post([&followUps] { ++followUps; });
+                    active.fetch_sub(1);
+                });
+        }
+        strand.wait();
+
+        // THEN
+        EXPECT_EQ(overlaps.load(), 0);
+        EXPECT_EQ(outOfOrder, 0);
+        EXPECT_EQ(next, 2000);
+        EXPECT_EQ(followUps, 200);
+        EXPECT_EQ(strand.pending(), 0u);
+        tPool.shutdown();
+    }
+}
+
+/**
+ * @test Different strands run in parallel
+ *
+ * GIVEN a 2-thread pool and two strands
+ * WHEN a job on the first strand waits for a job on the second one to start
+ * THEN the second job starts while the first is still running
+ */
+TEST_F(StrandTest, StrandsRunInParallel)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(2);
+    Strand            first(tPool);
+    Strand            second(tPool);
+    std::atomic<bool> firstStarted{false};
+    std::atomic<bool> secondStarted{false};
+    std::atomic<bool> overlapped{false};
+
+    // WHEN
+    first.post(
+        [&]
+        {
+            firstStarted.store(true);
+            overlapped.store(awaitFlag(secondStarted));
+        });
+    EXPECT_TRUE(awaitFlag(firstStarted));
+    second.post([&secondStarted] { secondStarted.store(true); });
+
+    // THEN
+    first.wait();
+    second.wait();
+    EXPECT_TRUE(overlapped.load());
+    tPool.shutdown();
+}
+
+/**
+ * @test submit() and enqueue() go through the strand
+ *
+ * GIVEN a 3-thread pool and one strand
+ * WHEN a value is submitted and chained with then(), a throwing callable is
+ *      submitted, and FakeCountingJobs are enqueued
+ * THEN the chain yields its value, get() rethrows, and the jobs all run
+ */
+TEST_F(StrandTest, SubmitAndEnqueue)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(3);
+    Strand           strand(tPool);
+    std::atomic<int> counter{0};
+
+    // WHEN
+    TaskFuture<int>  value  = strand.submit([] { return 20; }).then([](int v) { return v + 22; });
+    TaskFuture<void> failed = strand.submit([] { throw std::runtime_error("boom"); });
+    for (int i = 0; i < 100; ++i)
+        strand.enqueue(std::make_unique<FakeCountingJob>(counter));
+    strand.enqueue(nullptr);
+
+    // THEN
+    EXPECT_EQ(value.get(), 42);
+    EXPECT_THROW(failed.get(), std::runtime_error);
+    strand.wait();
+    EXPECT_EQ(counter.load(), 100);
+    tPool.shutdown();
+}
+
+/**
+ * @test Keyed strands serialize each key without locks in the jobs
+ *
+ * GIVEN a 4-thread pool and 8 keyed strands
+ * WHEN 4 threads each post 500 increments of a plain int for each of 32 keys
+ * THEN every key counts 2000, and no key ever had two jobs running at once
+ */
+TEST_F(StrandTest, KeyedStrandsSerializePerKey)
+{
+    // GIVEN
+    ThreadPool tPool(mode(ThreadPoolConfig::SchedulingMode::WorkStealing));
+    tPool.start(4);
+    KeyedStrands<int> accounts(tPool, 8);
+    std::vector<int>  balances(32, 0);
+    std::atomic<int>  active[32];
+    std::atomic<int>  overlaps{0};
+    for (auto& a : active)
+        a.store(0);
+
+    // WHEN
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; ++p)
+    {
+        producers.emplace_back(
+            [&]
+            {
+                for (int i = 0; i < 500; ++i)
+                {
+                    for (int key = 0; key < 32; ++key)
+                    {
+                        accounts.post(key,
+                                      [&, key]
+                                      {
+                                          if (active[key].fetch_add(1) != 0)
+                                              overlaps.fetch_add(1);
+                                          ++balances[key];
+                                          active[key].fetch_sub(1);
+                                      });
+                    }
+                }
+            });
+    }
+    for (auto& producer : producers)
+        producer.join();
+    accounts.wait();
+
+    // THEN
+    EXPECT_EQ(accounts.size(), 8u);
+    EXPECT_EQ(&accounts.strand(7), &accounts.strand(7));
+    EXPECT_EQ(overlaps.load(), 0);
+    EXPECT_EQ(balances, std::vector<int>(32, 2000));
+    EXPECT_EQ(accounts.pending(), 0u);
+    tPool.shutdown();
+}
+
+/**
+ * @test A strand the pool refuses breaks its futures and recovers
+ *
+ * GIVEN a held worker and a queue bounded to 1 job with the Reject policy, already full
+ * WHEN a callable is submitted to a strand, then the worker is released
+ * THEN get() throws std::future_error without hanging, and the strand runs later jobs
+ */
+TEST_F(StrandTest, RefusedStrandBreaksFutures)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.maxQueuedJobs  = 1;
+    config.overflowPolicy = ThreadPoolConfig::OverflowPolicy::Reject;
+    ThreadPool        tPool(config);
+    std::atomic<int>  counter{0};
+    std::atomic<bool> started{false};
+    std::atomic<bool> gate{false};
+    tPool.start(1);
+    tPool.post(
+        [&]
+        {
+            started.store(true);
+            while (!gate.load())
+                std::this_thread::yield();
+        });
+    EXPECT_TRUE(awaitFlag(started));
+    tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    Strand strand(tPool);
+
+    // WHEN
+    TaskFuture<int> refused = strand.submit([] { return 1; });
+    EXPECT_EQ(strand.pending(), 0u);
+    gate.store(true);
+
+    // THEN
+    EXPECT_THROW(refused.get(), std::future_error);
+    while (counter.load() == 0)  // the queued job frees the only slot
+        std::this_thread::yield();
+    strand.enqueue(std::make_unique<FakeCountingJob>(counter));
+    strand.wait();
+    tPool.shutdown();
+    EXPECT_EQ(counter.load(), 2);
+}
+
+/**
+ * @test A long strand does not hold its worker
+ *
+ * GIVEN a 1-thread pool and a strand with 10 * kDrainBatch jobs queued behind a held job
+ * WHEN a plain pool job is posted and the strand is released
+ * THEN the plain job runs before the strand has finished
+ */
+TEST_F(StrandTest, LongStrandYieldsWorker)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.workerBatchSize = 1;
+    ThreadPool tPool(config);
+    tPool.start(1);
+    Strand            strand(tPool);
+    std::atomic<bool> gate{false};
+    std::atomic<int>  strandRan{0};
+    std::atomic<int>  seenByPoolJob{-1};
+    const int         jobs = static_cast<int>(10 * Strand::kDrainBatch);
+
+    strand.post(
+        [&gate]
+        {
+            while (!gate.load())
+                std::this_thread::yield();
+        });
+    for (int i = 0; i < jobs; ++i)
+        strand.post([&strandRan] { strandRan.fetch_add(1); });
+
+    // WHEN
+    tPool.post([&] { seenByPoolJob.store(strandRan.load()); });
+    gate.store(true);
+
+    // THEN
+    strand.wait();
+    tPool.shutdown();
+    EXPECT_GE(seenByPoolJob.load(), 0);
+    EXPECT_LT(seenByPoolJob.load(), jobs);
+    EXPECT_EQ(strandRan.load(), jobs);
+}
@@ -0,0 +1,162 @@
+/**
+ * @file        test_task.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for Task and ThreadPool::post().
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a callable or an IJob
+ *  - WHEN: it is wrapped in a Task, moved, invoked or submitted
+ *  - THEN: storage choice and behaviour match the small-buffer contract
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+/* Project libraries */
+
+#include "fake_job.h"
+#include "logger.h"
+#include "task.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class TaskTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::WARN); }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Small lambdas are stored inline and survive moves
+ *
+ * GIVEN a lambda capturing one pointer
+ * WHEN it is wrapped in a Task, moved to another Task and invoked
+ * THEN it is stored inline, the source is empty and the lambda runs
+ */
+TEST_F(TaskTest, SmallLambdaIsInline)
+{
+    // GIVEN
+    int  calls = 0;
+    Task source([&calls] { ++calls; });
+
+    // WHEN
+    Task target(std::move(source));
+    target();
+
+    // THEN
+    EXPECT_TRUE(target.isInline());
+    EXPECT_FALSE(static_cast<bool>(source));
+    EXPECT_EQ(calls, 1);
+}
+
+/**
+ * @test Large callables fall back to the heap
+ *
+ * GIVEN a lambda capturing 128 bytes
+ * WHEN it is wrapped in a Task
+ * THEN it is not inline but still runs
+ */
+TEST_F(TaskTest, LargeLambdaFallsBackToHeap)
+{
+    // GIVEN
+    std::array<char, 128> payload{};
+    payload[127] = 7;
+    int sum      = 0;
+
+    // WHEN
+    Task task([payload, &sum] { sum += payload[127]; });
+    task();
+
+    // THEN
+    EXPECT_FALSE(task.isInline());
+    EXPECT_EQ(sum, 7);
+}
+
+/**
+ * @test IJob adapter keeps the original job object
+ *
+ * GIVEN a FakeJob wrapped in a Task
+ * WHEN the Task is invoked and the job released back
+ * THEN the same FakeJob instance was executed and is returned
+ */
+TEST_F(TaskTest, JobAdapterRoundTrip)
+{
+    // GIVEN
+    auto     job    = std::make_unique<FakeJob>();
+    FakeJob* jobPtr = job.get();
+    Task     task(std::move(job));
+
+    // WHEN
+    task();
+    std::unique_ptr<IJob> released = task.releaseJob();
+
+    // THEN
+    EXPECT_EQ(released.get(), jobPtr);
+    EXPECT_TRUE(jobPtr->wasExecuted());
+    EXPECT_FALSE(static_cast<bool>(task));
+}
+
+/**
+ * @test Destroying a Task destroys its captures exactly once
+ *
+ * GIVEN a lambda capturing a shared_ptr
+ * WHEN the Task is moved twice and destroyed
+ * THEN the shared_ptr is released exactly once
+ */
+TEST_F(TaskTest, DestroysCapturesOnce)
+{
+    // GIVEN
+    auto                token = std::make_shared<int>(1);
+    std::weak_ptr<int>  watch = token;
+
+    {
+        Task first([token] {});
+        token.reset();
+
+        // WHEN
+        Task second(std::move(first));
+        Task third;
+        third = std::move(second);
+        EXPECT_FALSE(watch.expired());
+    }
+
+    // THEN
+    EXPECT_TRUE(watch.expired());
+}
+
+/**
+ * @test ThreadPool::post() runs lambdas
+ *
+ * GIVEN a pool with 2 threads
+ * WHEN 100 lambdas are posted and the pool is shut down
+ * THEN all of them ran
+ */
+TEST_F(TaskTest, PoolPostRunsLambdas)
+{
+    // GIVEN
+    std::atomic<int> counter{0};
+    ThreadPool       tPool;
+    tPool.start(2);
+
+    // WHEN
+    for (int i = 0; i < 100; ++i)
+        tPool.post([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(counter.load(), 100);
+}
@@ -0,0 +1,330 @@
+/**
+ * @file        test_task_future.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for TaskFuture and ThreadPool::submit().
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a running pool
+ *  - WHEN: callables or jobs are submitted, awaited, polled or chained
+ *  - THEN: results, exceptions and continuations reach the caller, inline
+ *          continuations run on the completing worker
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_throwing_job.h"
+#include "logger.h"
+#include "task_future.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class TaskFutureTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test submit() returns the callable's value
+ *
+ * GIVEN a pool with 2 threads
+ * WHEN 100 lambdas returning their index are submitted
+ * THEN each future yields its index and is invalid afterwards
+ */
+TEST_F(TaskFutureTest, SubmitReturnsValue)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(2);
+
+    // WHEN
+    std::vector<TaskFuture<int>> futures;
+    for (int i = 0; i < 100; ++i)
+        futures.push_back(tPool.submit([i] { return i; }));
+
+    // THEN
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(futures[i].get(), i);
+        EXPECT_FALSE(futures[i].valid());
+    }
+    tPool.shutdown();
+}
+
+/**
+ * @test Exceptions thrown by the callable reach get()
+ *
+ * GIVEN a pool with 1 thread
+ * WHEN a lambda throwing std::runtime_error is submitted
+ * THEN get() rethrows the same exception
+ */
+TEST_F(TaskFutureTest, ExceptionPropagatesToGet)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(1);
+
+    // WHEN
+    TaskFuture<int> future = tPool.submit([]() -> int { throw std::runtime_error("boom"); });
+
+    // THEN
+    try
+    {
+        future.get();
+        FAIL() << "get() did not throw";
+    }
+    catch (const std::runtime_error& e)
+    {
+        EXPECT_EQ(std::string(e.what()), "boom");
+    }
+    tPool.shutdown();
+}
+
+/**
+ * @test Exceptions thrown by IJob::execute() reach the caller
+ *
+ * GIVEN a pool with 1 thread
+ * WHEN a FakeThrowingJob is submitted
+ * THEN wait() returns and get() rethrows
+ */
+TEST_F(TaskFutureTest, JobExceptionPropagates)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(1);
+
+    // WHEN
+    TaskFuture<void> future = tPool.submit(std::make_unique<FakeThrowingJob>());
+    future.wait();
+
+    // THEN
+    EXPECT_TRUE(future.ready());
+    EXPECT_THROW(future.get(), std::runtime_error);
+    tPool.shutdown();
+}
+
+/**
+ * @test ready() polls without blocking; waitFor() honours its timeout
+ *
+ * GIVEN a pool whose only thread is blocked on a gate
+ * WHEN a second callable is submitted behind it
+ * THEN its future is not ready and waitFor() times out until the gate opens
+ */
+TEST_F(TaskFutureTest, PollAndTimedWait)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<bool> gate{false};
+    tPool.start(1);
+    tPool.post(
+        [&gate]
+        {
+            while (!gate.load())
+                std::this_thread::yield();
+        });
+
+    // WHEN
+    TaskFuture<int> future = tPool.submit([] { return 7; });
+
+    // THEN
+    EXPECT_FALSE(future.ready());
+    EXPECT_FALSE(future.waitFor(std::chrono::milliseconds(20)));
+
+    gate.store(true);
+    EXPECT_TRUE(future.waitFor(std::chrono::seconds(5)));
+    EXPECT_EQ(future.get(), 7);
+    tPool.shutdown();
+}
+
+/**
+ * @test then() chains continuations and forwards errors past them
+ *
+ * GIVEN a pool with 2 threads
+ * WHEN a value is chained through two continuations, and a failing future
+ *      is chained through one
+ * THEN the value is transformed twice and the failure skips the continuation
+ */
+TEST_F(TaskFutureTest, ThenChainsAndForwardsErrors)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<bool> skippedRan{false};
+    tPool.start(2);
+
+    // WHEN
+    TaskFuture<std::string> chained = tPool.submit([] { return 20; })
+                                          .then([](int v) { return v + 1; })
+                                          .then([](int v) { return std::to_string(v * 2); });
+
+    TaskFuture<void> failed = tPool.submit([]() -> int { throw std::logic_error("bad"); })
+                                  .then([&skippedRan](int) { skippedRan.store(true); });
+
+    // THEN
+    EXPECT_EQ(chained.get(), "42");
+    EXPECT_THROW(failed.get(), std::logic_error);
+    EXPECT_FALSE(skippedRan.load());
+    tPool.shutdown();
+}
+
+/**
+ * @test then() on an already completed future still runs
+ *
+ * GIVEN a future that is already ready
+ * WHEN a continuation is attached
+ * THEN it is dispatched immediately and yields its result
+ */
+TEST_F(TaskFutureTest, ThenOnReadyFuture)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(1);
+    TaskFuture<int> first = tPool.submit([] { return 1; });
+    first.wait();
+
+    // WHEN
+    TaskFuture<int> second = first.then([](int v) { return v + 1; });
+
+    // THEN
+    EXPECT_FALSE(first.valid());
+    EXPECT_EQ(second.get(), 2);
+    tPool.shutdown();
+}
+
+/**
+ * @test thenInline() runs the follow-up on the worker that completed the job
+ *
+ * GIVEN a 2-thread pool and a job held until its continuations are attached
+ * WHEN two inline stages are chained to it, the second one failing
+ * THEN both stages run on the job's worker and the error reaches get()
+ */
+TEST_F(TaskFutureTest, ThenInlineRunsOnCompletingWorker)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<bool> gate{false};
+    std::thread::id   stageThreads[3];
+    tPool.start(2);
+
+    TaskFuture<int> first = tPool.submit(
+        [&]
+        {
+            while (!gate.load())
+                std::this_thread::yield();
+            stageThreads[0] = std::this_thread::get_id();
+            return 1;
+        });
+
+    // WHEN
+    TaskFuture<void> last = first
+                                .thenInline(
+                                    [&](int v)
+                                    {
+                                        stageThreads[1] = std::this_thread::get_id();
+                                        return v + 1;
+                                    })
+                                .thenInline(
+                                    [&](int v)
+                                    {
+                                        stageThreads[2] = std::this_thread::get_id();
+                                        if (v == 2)
+                                            throw std::runtime_error("stage failed");
+                                    });
+    gate.store(true);
+
+    // THEN
+    EXPECT_THROW(last.get(), std::runtime_error);
+    EXPECT_NE(stageThreads[0], std::this_thread::get_id());
+    EXPECT_EQ(stageThreads[1], stageThreads[0]);
+    EXPECT_EQ(stageThreads[2], stageThreads[0]);
+    tPool.shutdown();
+}
+
+/**
+ * @test A long inline chain falls back to the pool past the depth limit
+ *
+ * GIVEN a 1-thread pool and a job held until its continuations are attached
+ * WHEN 100 inline stages, each adding 1, are chained to it
+ * THEN the result is 100, and the worker ran more than the first job but far
+ *      fewer than one job per stage
+ */
+TEST_F(TaskFutureTest, ThenInlineDeepChainFallsBackToPool)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<bool> gate{false};
+    tPool.start(1);
+
+    TaskFuture<int> chain = tPool.submit(
+        [&gate]
+        {
+            while (!gate.load())
+                std::this_thread::yield();
+            return 0;
+        });
+
+    // WHEN
+    for (int stage = 0; stage < 100; ++stage)
+        chain = chain.thenInline([](int v) { return v + 1; });
+    gate.store(true);
+
+    // THEN
+    EXPECT_EQ(chain.get(), 100);
+    tPool.shutdown();
+    const size_t executed = tPool.metrics().total.executed;
+    EXPECT_GT(executed, 1u);
+    EXPECT_LT(executed, 101u);
+}
+
+/**
+ * @test A task discarded without running breaks its promise
+ *
+ * GIVEN a pool that was never started
+ * WHEN a job is submitted and the pool is shut down immediately
+ * THEN the future completes with broken_promise instead of hanging
+ */
+TEST_F(TaskFutureTest, DiscardedTaskBreaksPromise)
+{
+    // GIVEN
+    TaskFuture<int> future;
+    {
+        ThreadPool tPool;
+
+        // WHEN
+        future = tPool.submit([] { return 1; });
+        tPool.shutdownNow();
+    }
+
+    // THEN
+    ASSERT_TRUE(future.ready());
+    try
+    {
+        future.get();
+        FAIL() << "get() did not throw";
+    }
+    catch (const std::future_error& e)
+    {
+        EXPECT_EQ(e.code(), std::make_error_code(std::future_errc::broken_promise));
+    }
+}
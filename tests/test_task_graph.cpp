@@ -0,0 +1,310 @@
+/**
+ * @file        test_task_graph.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for TaskGraph (job dependency graphs).
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a pool and a graph of jobs with predecessors
+ *  - WHEN: the graph is run (possibly many times) and waited on
+ *  - THEN: every job runs once per run, never before its predecessors, and
+ *          errors, cycles and refusals are reported
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "logger.h"
+#include "task_graph.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class TaskGraphTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Config for the given scheduling mode.
+     */
+    static ThreadPoolConfig mode(ThreadPoolConfig::SchedulingMode scheduling)
+    {
+        ThreadPoolConfig config;
+        config.schedulingMode = scheduling;
+        return config;
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test A diamond runs in dependency order
+ *
+ * GIVEN 4-thread pools (shared-queue and work-stealing) and a diamond a -> {b, c} -> d
+ * WHEN the graph is run and waited on
+ * THEN a runs first, d last, and every node runs once
+ */
+TEST_F(TaskGraphTest, DiamondRunsInOrder)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPool tPool(mode(scheduling));
+        tPool.start(4);
+        std::atomic<int> step{0};
+        int              order[4] = {-1, -1, -1, -1};
+
+        TaskGraph    graph(tPool);
+        const size_t a = graph.add([&] { order[0] = step.fetch_add(1); });
+        const size_t b = graph.add([&] { order[1] = step.fetch_add(1); }, {a});
+        const size_t c = graph.add([&] { order[2] = step.fetch_add(1); }, {a});
+        graph.add([&] { order[3] = step.fetch_add(1); }, {b, c});
+
+        // WHEN
+        EXPECT_TRUE(graph.run());
+        graph.wait();
+
+        // THEN
+        EXPECT_EQ(order[0], 0);
+        EXPECT_GT(order[1], 0);
+        EXPECT_GT(order[2], 0);
+        EXPECT_EQ(order[3], 3);
+        EXPECT_EQ(graph.pending(), 0u);
+        tPool.shutdown();
+    }
+}
+
+/**
+ * @test The same graph can be run many times
+ *
+ * GIVEN a chain of 100 nodes, each checking that it runs right after its predecessor
+ * WHEN the graph is run and waited on 50 times
+ * THEN every run executes the 100 nodes in order
+ */
+TEST_F(TaskGraphTest, ReRunsWithoutRebuilding)
+{
+    // GIVEN
+    ThreadPool tPool(mode(ThreadPoolConfig::SchedulingMode::WorkStealing));
+    tPool.start(4);
+    std::atomic<int> position{0};
+    std::atomic<int> outOfOrder{0};
+
+    TaskGraph graph(tPool);
+    size_t    previous = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto step = [&position, &outOfOrder, i]
+        {
+            if (position.fetch_add(1) % 100 != i)
+                outOfOrder.fetch_add(1);
+        };
+        previous = i == 0 ? graph.add(step) : graph.add(step, {previous});
+    }
+
+    // WHEN
+    for (int run = 0; run < 50; ++run)
+    {
+        EXPECT_TRUE(graph.run());
+        graph.wait();
+    }
+
+    // THEN
+    EXPECT_EQ(position.load(), 5000);
+    EXPECT_EQ(outOfOrder.load(), 0);
+    tPool.shutdown();
+}
+
+/**
+ * @test Wide fan-out / fan-in with IJob nodes
+ *
+ * GIVEN a root, 200 FakeCountingJob nodes after it, and a sink after all of them
+ * WHEN the graph is run twice
+ * THEN the sink sees the 200 jobs done each time
+ */
+TEST_F(TaskGraphTest, FanOutFanIn)
+{
+    // GIVEN
+    ThreadPool tPool(mode(ThreadPoolConfig::SchedulingMode::WorkStealing));
+    tPool.start(4);
+    std::atomic<int> counter{0};
+    std::vector<int> seenBySink;
+
+    TaskGraph    graph(tPool);
+    const size_t root = graph.add([&counter] { counter.store(0); });
+    const size_t sink = graph.add([&] { seenBySink.push_back(counter.load()); });
+    for (int i = 0; i < 200; ++i)
+    {
+        const size_t job = graph.add(std::make_unique<FakeCountingJob>(counter), {root});
+        EXPECT_TRUE(graph.precede(job, sink));
+    }
+
+    // WHEN
+    for (int run = 0; run < 2; ++run)
+    {
+        EXPECT_TRUE(graph.run());
+        graph.wait();
+    }
+
+    // THEN
+    EXPECT_EQ(graph.size(), 202u);
+    EXPECT_EQ(seenBySink, (std::vector<int>{200, 200}));
+    tPool.shutdown();
+}
+
+/**
+ * @test Cycles and bad edges are refused
+ *
+ * GIVEN a graph a -> b -> c
+ * WHEN an edge c -> a, a self edge and an edge to an unknown node are added
+ * THEN the self edge and the unknown node are refused, and run() submits nothing
+ */
+TEST_F(TaskGraphTest, RefusesCycles)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(2);
+    std::atomic<int> counter{0};
+
+    TaskGraph    graph(tPool);
+    const size_t a = graph.add([&counter] { counter.fetch_add(1); });
+    const size_t b = graph.add([&counter] { counter.fetch_add(1); }, {a});
+    const size_t c = graph.add([&counter] { counter.fetch_add(1); }, {b});
+
+    // WHEN
+    EXPECT_FALSE(graph.precede(a, a));
+    EXPECT_FALSE(graph.precede(a, 42));
+    EXPECT_TRUE(graph.precede(c, a));
+
+    // THEN
+    EXPECT_FALSE(graph.run());
+    EXPECT_EQ(graph.pending(), 0u);
+    graph.wait();
+    tPool.shutdown();
+    EXPECT_EQ(counter.load(), 0);
+}
+
+/**
+ * @test A throwing node still releases its successors
+ *
+ * GIVEN a graph where a throws and b follows a
+ * WHEN the graph is run twice
+ * THEN b runs both times and each wait() rethrows the runtime_error
+ */
+TEST_F(TaskGraphTest, ExceptionReachesWait)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(2);
+    std::atomic<int> counter{0};
+
+    TaskGraph    graph(tPool);
+    const size_t a = graph.add([] { throw std::runtime_error("boom"); });
+    graph.add([&counter] { counter.fetch_add(1); }, {a});
+
+    // WHEN / THEN
+    for (int run = 0; run < 2; ++run)
+    {
+        EXPECT_TRUE(graph.run());
+        EXPECT_THROW(graph.wait(), std::runtime_error);
+    }
+    EXPECT_EQ(counter.load(), 2);
+    tPool.shutdown();
+}
+
+/**
+ * @test A node the pool refuses ends the run with broken_promise
+ *
+ * GIVEN a held worker and a queue bounded to 1 job with the Reject policy, already full
+ * WHEN a graph a -> b is run and waited on
+ * THEN wait() returns (no hang) and throws std::future_error; neither node runs
+ */
+TEST_F(TaskGraphTest, RefusedNodeBreaksRun)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.maxQueuedJobs  = 1;
+    config.overflowPolicy = ThreadPoolConfig::OverflowPolicy::Reject;
+    ThreadPool        tPool(config);
+    std::atomic<int>  counter{0};
+    std::atomic<bool> started{false};
+    std::atomic<bool> gate{false};
+    tPool.start(1);
+    tPool.post(
+        [&]
+        {
+            started.store(true);
+            while (!gate.load())
+                std::this_thread::yield();
+        });
+    while (!started.load())
+        std::this_thread::yield();
+    tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+
+    TaskGraph    graph(tPool);
+    const size_t a = graph.add([&counter] { counter.fetch_add(100); });
+    graph.add([&counter] { counter.fetch_add(100); }, {a});
+
+    // WHEN
+    EXPECT_TRUE(graph.run());
+
+    // THEN
+    EXPECT_THROW(graph.wait(), std::future_error);
+    EXPECT_EQ(graph.pending(), 0u);
+    gate.store(true);
+    tPool.shutdown();
+    EXPECT_EQ(counter.load(), 1);
+}
+
+/**
+ * @test A graph run from inside a job does not deadlock a 1-thread pool
+ *
+ * GIVEN a 1-thread pool
+ * WHEN a job builds a 3-node chain, runs it and waits on it
+ * THEN the waiting worker runs the chain itself and the job completes
+ */
+TEST_F(TaskGraphTest, NestedRunHelps)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPool tPool(mode(scheduling));
+        tPool.start(1);
+        std::atomic<int> counter{0};
+
+        // WHEN
+        auto done = tPool.submit(
+            [&]
+            {
+                TaskGraph    graph(tPool);
+                const size_t a = graph.add([&counter] { counter.fetch_add(1); });
+                const size_t b = graph.add([&counter] { counter.fetch_add(1); }, {a});
+                graph.add([&counter] { counter.fetch_add(1); }, {b});
+                graph.run();
+                graph.wait();
+            });
+
+        // THEN
+        EXPECT_NO_THROW(done.get());
+        EXPECT_EQ(counter.load(), 3);
+        tPool.shutdown();
+    }
+}
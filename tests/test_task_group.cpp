@@ -0,0 +1,319 @@
+/**
+ * @file        test_task_group.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for TaskGroup (fork / join with a helping waiter).
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a pool and a group of jobs (possibly nested)
+ *  - WHEN: the group is waited on
+ *  - THEN: every job has finished, errors surface, and nothing deadlocks
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "logger.h"
+#include "task_group.h"
+#include "thread_pool.h"
+#include "worker_gate.h"
+
+/*****************************************************************************/
+
+class TaskGroupTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Config for the given scheduling mode.
+     */
+    static ThreadPoolConfig mode(ThreadPoolConfig::SchedulingMode scheduling)
+    {
+        ThreadPoolConfig config;
+        config.schedulingMode = scheduling;
+        return config;
+    }
+
+    std::atomic<bool> gate{false};
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test wait() returns once every job of the group has run
+ *
+ * GIVEN a 4-thread pool and a group
+ * WHEN 50 IJobs and 50 lambdas are run and the group is waited on
+ * THEN all 100 have run and nothing is pending
+ */
+TEST_F(TaskGroupTest, WaitRunsEveryJob)
+{
+    // GIVEN
+    ThreadPool       tPool;
+    std::atomic<int> counter{0};
+    tPool.start(4);
+    TaskGroup group(tPool);
+
+    // WHEN
+    for (int i = 0; i < 50; ++i)
+    {
+        group.run(std::make_unique<FakeCountingJob>(counter));
+        group.run([&counter] { counter.fetch_add(1); });
+    }
+    group.wait();
+
+    // THEN
+    EXPECT_EQ(counter.load(), 100);
+    EXPECT_EQ(group.pending(), 0u);
+    tPool.shutdown();
+}
+
+/**
+ * @test The first exception is rethrown by wait() and the group stays usable
+ *
+ * GIVEN a group with one throwing job among ten
+ * WHEN the group is waited on, then reused for one more job
+ * THEN the first wait() throws, every other job still ran, the second wait() does not throw
+ */
+TEST_F(TaskGroupTest, WaitRethrowsFirstError)
+{
+    // GIVEN
+    ThreadPool       tPool;
+    std::atomic<int> counter{0};
+    tPool.start(2);
+    TaskGroup group(tPool);
+    for (int i = 0; i < 9; ++i)
+        group.run([&counter] { counter.fetch_add(1); });
+    group.run([] { throw std::runtime_error("boom"); });
+
+    // WHEN / THEN
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(counter.load(), 9);
+
+    group.run([&counter] { counter.fetch_add(1); });
+    EXPECT_NO_THROW(group.wait());
+    EXPECT_EQ(counter.load(), 10);
+    tPool.shutdown();
+}
+
+/**
+ * @test Nested fork / join on a single worker does not deadlock
+ *
+ * GIVEN a 1-thread pool (shared-queue and work-stealing modes)
+ * WHEN a job fans out 8 children that each fan out 4 grandchildren and wait
+ * THEN every job runs and the outer job completes within 2 s
+ */
+TEST_F(TaskGroupTest, NestedForkJoinOnOneWorker)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPool       tPool(mode(scheduling));
+        std::atomic<int> leaves{0};
+        tPool.start(1);
+
+        // WHEN
+        TaskFuture<void> outer = tPool.submit(
+            [&tPool, &leaves]
+            {
+                TaskGroup children(tPool);
+                for (int i = 0; i < 8; ++i)
+                {
+                    children.run(
+                        [&tPool, &leaves]
+                        {
+                            TaskGroup grandchildren(tPool);
+                            for (int j = 0; j < 4; ++j)
+                                grandchildren.run([&leaves] { leaves.fetch_add(1); });
+                            grandchildren.wait();
+                        });
+                }
+                children.wait();
+            });
+        const bool finished = outer.waitFor(std::chrono::seconds(2));
+
+        // THEN
+        EXPECT_TRUE(finished);
+        EXPECT_EQ(leaves.load(), 32);
+        tPool.shutdown();
+    }
+}
+
+/**
+ * @test The waiting thread executes the group's jobs itself when workers are busy
+ *
+ * GIVEN a 1-thread pool whose worker is held
+ * WHEN the test thread runs 5 jobs in a group and waits
+ * THEN wait() returns while the worker is still held and all 5 ran on the test thread
+ */
+TEST_F(TaskGroupTest, CallerHelpsWhileWaiting)
+{
+    // GIVEN
+    ThreadPool tPool;
+    tPool.start(1);
+    holdWorker(tPool, gate);
+
+    // WHEN
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<int>      onCaller{0};
+    TaskGroup             group(tPool);
+    for (int i = 0; i < 5; ++i)
+    {
+        group.run(
+            [&onCaller, caller]
+            {
+                if (std::this_thread::get_id() == caller)
+                    onCaller.fetch_add(1);
+            });
+    }
+    group.wait();
+    const bool workerStillHeld = !gate.load();
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_TRUE(workerStillHeld);
+    EXPECT_EQ(onCaller.load(), 5);
+}
+
+/**
+ * @test A job the pool refuses completes the group with broken_promise
+ *
+ * GIVEN a held worker and a queue bounded to 1 job with the Reject policy, already full
+ * WHEN a group job is run and the group is waited on
+ * THEN wait() returns (no hang) and throws std::future_error; only the queued job runs
+ */
+TEST_F(TaskGroupTest, RefusedJobBreaksGroup)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.maxQueuedJobs  = 1;
+    config.overflowPolicy = ThreadPoolConfig::OverflowPolicy::Reject;
+    ThreadPool       tPool(config);
+    std::atomic<int> counter{0};
+    tPool.start(1);
+    holdWorker(tPool, gate);
+    tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+
+    // WHEN
+    TaskGroup group(tPool);
+    group.run([&counter] { counter.fetch_add(100); });
+
+    // THEN
+    EXPECT_THROW(group.wait(), std::future_error);
+    gate.store(true);
+    tPool.shutdown();
+    EXPECT_EQ(counter.load(), 1);
+}
+
+/**
+ * @test A waiting job runs the group jobs popped in its own batch
+ *
+ * GIVEN a 1-thread pool popping batches of up to 8 tasks, whose worker is held
+ * WHEN a group job, a job waiting on the group and a second group job are
+ *      queued in that order and the worker is released
+ * THEN the worker pops all three at once and the waiting job still returns,
+ *      running the second group job itself
+ */
+TEST_F(TaskGroupTest, WaiterRunsJobsOfItsBatch)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.workerBatchSize = 8;
+    ThreadPool tPool(config);
+    tPool.start(1);
+    holdWorker(tPool, gate);
+
+    // WHEN
+    std::atomic<int>  counter{0};
+    std::atomic<bool> waited{false};
+    TaskGroup         group(tPool);
+    group.run([&counter] { counter.fetch_add(1); });
+    tPool.post(
+        [&group, &waited]
+        {
+            group.wait();
+            waited.store(true);
+        });
+    group.run([&counter] { counter.fetch_add(1); });
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_TRUE(waited.load());
+    EXPECT_EQ(counter.load(), 2);
+}
+
+/**
+ * @test shutdownNow() while a job waits on its group does not hang
+ *
+ * GIVEN 1-thread pools (shared-queue and work-stealing) running a job that
+ *       runs 4 group jobs and posts 3 unrelated ones, sleeps 100 ms, then
+ *       waits on the group, with 2 more unrelated jobs posted from outside
+ * WHEN shutdownNow() is called while the job sleeps
+ * THEN the waiting job runs its group jobs itself, returns, and the pool joins;
+ *      the 5 unrelated jobs are handed back without running
+ */
+TEST_F(TaskGroupTest, ShutdownNowLetsWaitingJobFinish)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPool        tPool(mode(scheduling));
+        std::atomic<int>  counter{0};
+        std::atomic<int>  unrelated{0};
+        std::atomic<bool> started{false};
+        std::atomic<bool> waited{false};
+        tPool.start(1);
+        tPool.post(
+            [&]
+            {
+                TaskGroup group(tPool);
+                for (int i = 0; i < 4; ++i)
+                {
+                    group.run([&counter] { counter.fetch_add(1); });
+                    if (i % 2 == 0)
+                        tPool.post([&unrelated] { unrelated.fetch_add(1); });
+                }
+                tPool.post([&unrelated] { unrelated.fetch_add(1); });
+                started.store(true);
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                group.wait();
+                waited.store(true);
+            });
+        while (!started.load())
+            std::this_thread::yield();
+        for (int i = 0; i < 2; ++i)
+            tPool.post([&unrelated] { unrelated.fetch_add(1); });
+
+        // WHEN
+        const std::vector<std::unique_ptr<IJob>> unexecuted = tPool.shutdownNow();
+
+        // THEN
+        EXPECT_TRUE(waited.load());
+        EXPECT_EQ(counter.load(), 4);
+        EXPECT_EQ(unrelated.load(), 0);
+        EXPECT_EQ(unexecuted.size(), 5u);
+        EXPECT_EQ(tPool.size(), 0);
+    }
+}
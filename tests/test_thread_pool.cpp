@@ -18,10 +18,16 @@
 /* Standard libraries */
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
 
 /* Project libraries */
 
+#include "fake_counting_job.h"
 #include "fake_job.h"
 #include "fake_slow_job.h"
 #include "fake_throwing_job.h"
@@ -217,4 +223,282 @@ TEST_F(ThreadPoolTest, threadsurvivesExceptionAndContinues)
 
     ASSERT_TRUE(normalPtr->wasExecuted())
         << "The thread stopped after the previous exception — it continued and executed the next job";
-}
\ No newline at end of file
+}
+/**
+ * @test
+ * @brief The pool runs jobs on the lock-free ring backend.
+ *
+ * @details
+ * GIVEN a pool configured with the LockFreeRing backend and 2 threads
+ * WHEN a FakeCountingJob is enqueued and the pool is shut down
+ * THEN the job was executed
+ */
+TEST_F(ThreadPoolTest, LockFreeRingBackendExecutesJob)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.queueBackend  = ThreadPoolConfig::QueueBackend::LockFreeRing;
+    config.queueCapacity = 16;
+
+    ThreadPool tPool(config);
+    tPool.start(2);
+
+    std::atomic<int> executed{0};
+
+    // WHEN
+    tPool.enqueue(std::make_unique<FakeCountingJob>(executed));
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(executed.load(), 1);
+    EXPECT_EQ(tPool.size(), 0);
+}
+
+/**
+ * @test
+ * @brief A worker overflowing the lock-free ring does not wait for itself.
+ *
+ * @details
+ * GIVEN a 1-thread pool on a LockFreeRing backend of capacity 4
+ * WHEN a job posts 10 jobs one by one and enqueues a batch of 10 more
+ * THEN the job returns and all 20 jobs run
+ */
+TEST_F(ThreadPoolTest, WorkerOverflowingRingDoesNotHang)
+{
+    // GIVEN
+    ThreadPoolConfig config;
+    config.queueBackend  = ThreadPoolConfig::QueueBackend::LockFreeRing;
+    config.queueCapacity = 4;
+
+    ThreadPool tPool(config);
+    tPool.start(1);
+
+    std::atomic<int> executed{0};
+
+    // WHEN
+    tPool.post(
+        [&tPool, &executed]
+        {
+            for (int i = 0; i < 10; ++i)
+                tPool.post([&executed] { executed.fetch_add(1); });
+
+            std::vector<std::unique_ptr<IJob>> batch;
+            for (int i = 0; i < 10; ++i)
+                batch.push_back(std::make_unique<FakeCountingJob>(executed));
+            tPool.enqueueBatch(std::move(batch));
+        });
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(executed.load(), 20);
+}
+
+/**
+ * @test shutdown() drains every accepted job and reports it
+ *
+ * @details
+ * GIVEN a 1-thread pool busy with a 100 ms job and 50 FakeCountingJobs queued behind it
+ * WHEN shutdown() is called without a deadline
+ * THEN all 51 complete during the call, none is abandoned, nothing is pending
+ */
+TEST_F(ThreadPoolTest, ShutdownDrainsAndReports)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<bool> started{false};
+    std::atomic<int>  executed{0};
+    tPool.start(1);
+    tPool.post(
+        [&started]
+        {
+            started.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        });
+    for (int i = 0; i < 50; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(executed));
+    while (!started.load())
+        std::this_thread::yield();
+
+    // WHEN
+    ThreadPool::ShutdownReport report = tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(executed.load(), 50);
+    EXPECT_TRUE(report.drained);
+    EXPECT_EQ(report.completed, 51u);
+    EXPECT_EQ(report.abandoned, 0u);
+    EXPECT_EQ(tPool.pending(), 0u);
+}
+
+/**
+ * @test Once shutdown() begins, only the pool's own jobs may submit
+ *
+ * @details
+ * GIVEN a 1-thread pool running a job that enqueues a FakeCountingJob once a gate opens
+ * WHEN shutdown() starts on another thread, then the test thread enqueues a
+ *      FakeCountingJob and submits a lambda before opening the gate
+ * THEN only the job's own submission runs and the outside future breaks its promise
+ */
+TEST_F(ThreadPoolTest, ShutdownRefusesOutsideSubmissions)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<bool> gate{false};
+    std::atomic<int>  executed{0};
+    tPool.start(1);
+    tPool.post(
+        [&tPool, &gate, &executed]
+        {
+            while (!gate.load())
+                std::this_thread::yield();
+            tPool.enqueue(std::make_unique<FakeCountingJob>(executed));
+        });
+
+    // WHEN
+    std::thread stopper([&tPool] { tPool.shutdown(); });
+    while (tPool.isRunning())
+        std::this_thread::yield();
+    tPool.enqueue(std::make_unique<FakeCountingJob>(executed));
+    TaskFuture<int> refused = tPool.submit([] { return 1; });
+    gate.store(true);
+    stopper.join();
+
+    // THEN
+    EXPECT_EQ(executed.load(), 1);
+    ASSERT_TRUE(refused.ready());
+    EXPECT_THROW(refused.get(), std::future_error);
+}
+
+/**
+ * @test shutdown(timeout) abandons queued jobs once the deadline expires
+ *
+ * @details
+ * GIVEN a 1-thread pool busy with a 200 ms job and 10 jobs queued behind it
+ * WHEN shutdown(20 ms) is called
+ * THEN the running job completes, the 10 queued ones are abandoned unexecuted,
+ *      and the report says so
+ */
+TEST_F(ThreadPoolTest, ShutdownDeadlineAbandonsQueuedJobs)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<bool> started{false};
+    std::atomic<int>  executed{0};
+    tPool.start(1);
+    tPool.post(
+        [&started]
+        {
+            started.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        });
+    for (int i = 0; i < 10; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(executed));
+    while (!started.load())
+        std::this_thread::yield();
+    EXPECT_EQ(tPool.pending(), 11u);
+
+    // WHEN
+    ThreadPool::ShutdownReport report = tPool.shutdown(std::chrono::milliseconds(20));
+
+    // THEN
+    EXPECT_FALSE(report.drained);
+    EXPECT_EQ(report.completed, 1u);
+    EXPECT_EQ(report.abandoned, 10u);
+    EXPECT_EQ(executed.load(), 0);
+    EXPECT_EQ(tPool.size(), 0);
+}
+
+/**
+ * @test shutdownNow() hands back the queued jobs instead of running them
+ *
+ * @details
+ * GIVEN 1-thread pools (shared-queue and work-stealing) busy with a 100 ms job,
+ *       with 20 IJobs and 20 callables queued behind it
+ * WHEN shutdownNow() is called
+ * THEN the running job completes, none of the 40 queued ones runs, all 40 are
+ *      returned, and they run once enqueued on a standby pool
+ */
+TEST_F(ThreadPoolTest, ShutdownNowReturnsUnexecutedJobs)
+{
+    for (auto scheduling : {ThreadPoolConfig::SchedulingMode::SharedQueue,
+                            ThreadPoolConfig::SchedulingMode::WorkStealing})
+    {
+        // GIVEN
+        ThreadPoolConfig config;
+        config.schedulingMode = scheduling;
+        ThreadPool        tPool(config);
+        std::atomic<bool> started{false};
+        std::atomic<bool> finished{false};
+        std::atomic<int>  executed{0};
+        tPool.start(1);
+        tPool.post(
+            [&started, &finished]
+            {
+                started.store(true);
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                finished.store(true);
+            });
+        for (int i = 0; i < 20; ++i)
+        {
+            tPool.enqueue(std::make_unique<FakeCountingJob>(executed));
+            tPool.post([&executed] { executed.fetch_add(1); });
+        }
+        while (!started.load())
+            std::this_thread::yield();
+
+        // WHEN
+        std::vector<std::unique_ptr<IJob>> unexecuted = tPool.shutdownNow();
+
+        // THEN
+        EXPECT_TRUE(finished.load());
+        EXPECT_EQ(executed.load(), 0);
+        EXPECT_EQ(unexecuted.size(), 40u);
+        EXPECT_EQ(tPool.pending(), 0u);
+        EXPECT_EQ(tPool.size(), 0);
+
+        ThreadPool standby;
+        standby.start(2);
+        for (auto& job : unexecuted)
+            standby.enqueue(std::move(job));
+        standby.shutdown();
+        EXPECT_EQ(executed.load(), 40);
+    }
+}
+
+/**
+ * @test A future whose task is handed back completes where the task runs
+ *
+ * @details
+ * GIVEN a 1-thread pool busy with a 50 ms job and a submitted callable behind it
+ * WHEN shutdownNow() is called and the returned job runs on a standby pool
+ * THEN the future is still pending after shutdownNow() and yields the value afterwards
+ */
+TEST_F(ThreadPoolTest, ShutdownNowKeepsHandedBackFuturesPending)
+{
+    // GIVEN
+    ThreadPool        tPool;
+    std::atomic<bool> started{false};
+    tPool.start(1);
+    tPool.post(
+        [&started]
+        {
+            started.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        });
+    TaskFuture<int> future = tPool.submit([] { return 42; });
+    while (!started.load())
+        std::this_thread::yield();
+
+    // WHEN
+    std::vector<std::unique_ptr<IJob>> unexecuted = tPool.shutdownNow();
+    EXPECT_FALSE(future.ready());
+    ASSERT_EQ(unexecuted.size(), 1u);
+
+    ThreadPool standby;
+    standby.start(1);
+    standby.enqueue(std::move(unexecuted.front()));
+
+    // THEN
+    EXPECT_EQ(future.get(), 42);
+    standby.shutdown();
+}
@@ -0,0 +1,252 @@
+/**
+ * @file        test_timer.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for TimerWheel and the ThreadPool schedule*() API.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a timer wheel (or a pool) and some delayed / periodic jobs
+ *  - WHEN: time passes, timers are cancelled or the pool shuts down
+ *  - THEN: jobs run once their time has come, never earlier, never after cancel
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "i_executor.h"
+#include "logger.h"
+#include "thread_pool.h"
+#include "timer_wheel.h"
+
+/*****************************************************************************/
+
+using Clock = std::chrono::steady_clock;
+using std::chrono::milliseconds;
+
+/**
+ * @brief Runs every dispatched task on the timer thread itself.
+ */
+class InlineExecutor : public IExecutor
+{
+   public:
+    void dispatch(Task task) override { task(); }
+};
+
+class TimerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::WARN); }
+
+    /**
+     * @brief Waits up to 2 s for `counter` to reach `expected`.
+     */
+    static bool waitFor(const std::atomic<int>& counter, int expected)
+    {
+        const auto limit = Clock::now() + std::chrono::seconds(2);
+        while (counter.load() < expected && Clock::now() < limit)
+            std::this_thread::sleep_for(milliseconds(1));
+        return counter.load() >= expected;
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Timers at several wheel levels fire in deadline order, never early
+ *
+ * GIVEN a wheel with a 1 ms tick
+ * WHEN timers are armed at +150 ms, +5 ms and +70 ms (levels 1, 0 and 1)
+ * THEN they fire in the order 5, 70, 150 and each one after its deadline
+ */
+TEST_F(TimerTest, WheelFiresInDeadlineOrder)
+{
+    // GIVEN
+    InlineExecutor   executor;
+    TimerWheel       wheel(executor);
+    std::mutex       firedMtx;
+    std::vector<int> fired;
+    std::atomic<int> count{0};
+    std::atomic<int> early{0};
+    const auto       start = Clock::now();
+
+    auto at = [&](int delayMs)
+    {
+        const auto when = start + milliseconds(delayMs);
+        wheel.scheduleAt(when,
+                         Task(
+                             [&, when, delayMs]
+                             {
+                                 if (Clock::now() < when)
+                                     early.fetch_add(1);
+                                 std::lock_guard<std::mutex> lock(firedMtx);
+                                 fired.push_back(delayMs);
+                                 count.fetch_add(1);
+                             }));
+    };
+
+    // WHEN
+    at(150);
+    at(5);
+    at(70);
+
+    // THEN
+    ASSERT_TRUE(waitFor(count, 3));
+    EXPECT_EQ(fired, (std::vector<int>{5, 70, 150}));
+    EXPECT_EQ(early.load(), 0);
+    EXPECT_EQ(wheel.size(), 0u);
+}
+
+/**
+ * @test Many timers spread over several levels all fire exactly once
+ *
+ * GIVEN a wheel with a 1 ms tick
+ * WHEN 10000 timers are armed with delays from 0 to 299 ms
+ * THEN all 10000 fire and the wheel ends empty
+ */
+TEST_F(TimerTest, WheelHandlesManyTimers)
+{
+    // GIVEN
+    InlineExecutor   executor;
+    TimerWheel       wheel(executor);
+    std::atomic<int> count{0};
+
+    // WHEN
+    const auto start = Clock::now();
+    for (int i = 0; i < 10000; ++i)
+        wheel.scheduleAt(start + milliseconds(i % 300), Task([&count] { count.fetch_add(1); }));
+
+    // THEN
+    ASSERT_TRUE(waitFor(count, 10000));
+    EXPECT_EQ(count.load(), 10000);
+    EXPECT_EQ(wheel.size(), 0u);
+}
+
+/**
+ * @test A cancelled one-shot timer never runs
+ *
+ * GIVEN a wheel with a timer armed 30 ms ahead
+ * WHEN the handle is cancelled right away
+ * THEN the task does not run and the node is reaped
+ */
+TEST_F(TimerTest, CancelledTimerDoesNotRun)
+{
+    // GIVEN
+    InlineExecutor   executor;
+    TimerWheel       wheel(executor);
+    std::atomic<int> count{0};
+    TimerHandle      handle =
+        wheel.scheduleAt(Clock::now() + milliseconds(30), Task([&count] { count.fetch_add(1); }));
+
+    // WHEN
+    handle.cancel();
+    std::this_thread::sleep_for(milliseconds(80));
+
+    // THEN
+    EXPECT_TRUE(handle.cancelled());
+    EXPECT_EQ(count.load(), 0);
+    EXPECT_EQ(wheel.size(), 0u);
+}
+
+/**
+ * @test scheduleAfter() delays a job without occupying a worker
+ *
+ * GIVEN a 1-thread pool
+ * WHEN a job is scheduled 50 ms ahead and another one enqueued right after
+ * THEN the enqueued job runs first and the delayed one not before 50 ms
+ */
+TEST_F(TimerTest, ScheduleAfterDoesNotBlockWorker)
+{
+    // GIVEN
+    ThreadPool       tPool;
+    std::atomic<int> delayed{0};
+    std::atomic<int> immediate{0};
+    tPool.start(1);
+
+    // WHEN
+    const auto  begin  = Clock::now();
+    TimerHandle handle = tPool.scheduleAfter(milliseconds(50),
+                                             std::make_unique<FakeCountingJob>(delayed));
+    tPool.enqueue(std::make_unique<FakeCountingJob>(immediate));
+    ASSERT_TRUE(waitFor(immediate, 1));
+    const int delayedWhenImmediateRan = delayed.load();
+    ASSERT_TRUE(waitFor(delayed, 1));
+    const auto waited = Clock::now() - begin;
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_TRUE(handle.valid());
+    EXPECT_EQ(delayedWhenImmediateRan, 0);
+    EXPECT_GE(waited, milliseconds(50));
+}
+
+/**
+ * @test scheduleEvery() repeats until cancelled
+ *
+ * GIVEN a 2-thread pool and a job scheduled every 10 ms
+ * WHEN it has run 3 times and the handle is cancelled
+ * THEN it runs at most once more (a run already in flight)
+ */
+TEST_F(TimerTest, ScheduleEveryRepeatsUntilCancelled)
+{
+    // GIVEN
+    ThreadPool       tPool;
+    std::atomic<int> runs{0};
+    tPool.start(2);
+
+    // WHEN
+    TimerHandle handle =
+        tPool.scheduleEvery(milliseconds(10), std::make_unique<FakeCountingJob>(runs));
+    ASSERT_TRUE(waitFor(runs, 3));
+    handle.cancel();
+    const int atCancel = runs.load();
+    std::this_thread::sleep_for(milliseconds(60));
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_LE(runs.load(), atCancel + 1);
+}
+
+/**
+ * @test Shutdown discards timers that are not due yet
+ *
+ * GIVEN a pool with a job scheduled 10 s ahead
+ * WHEN the pool shuts down
+ * THEN shutdown returns promptly, the job never runs and new timers are refused
+ */
+TEST_F(TimerTest, ShutdownDiscardsPendingTimers)
+{
+    // GIVEN
+    ThreadPool       tPool;
+    std::atomic<int> count{0};
+    tPool.start(1);
+    tPool.scheduleAfter(std::chrono::seconds(10), std::make_unique<FakeCountingJob>(count));
+
+    // WHEN
+    const auto                       begin  = Clock::now();
+    const ThreadPool::ShutdownReport report = tPool.shutdown();
+    const auto                       took   = Clock::now() - begin;
+    TimerHandle                      late =
+        tPool.scheduleAfter(milliseconds(1), std::make_unique<FakeCountingJob>(count));
+
+    // THEN
+    EXPECT_LT(took, std::chrono::seconds(1));
+    EXPECT_EQ(count.load(), 0);
+    EXPECT_EQ(report.abandoned, 0u);
+    EXPECT_FALSE(late.valid());
+}
@@ -0,0 +1,233 @@
+/**
+ * @file        test_trace.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for job tracing and the Chrome trace-event export.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a pool with (or without) `traceJobs`
+ *  - WHEN: jobs run and the trace is collected or dumped
+ *  - THEN: one event per job, in valid trace-event JSON, nothing lost silently
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+
+/* Project libraries */
+
+#include "fake_counting_job.h"
+#include "job_trace.h"
+#include "logger.h"
+#include "thread_pool.h"
+
+/*****************************************************************************/
+
+class TraceTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::ERROR); }
+
+    /**
+     * @brief Config with tracing on and `capacity` events per worker.
+     */
+    static ThreadPoolConfig tracing(size_t capacity = 1024)
+    {
+        ThreadPoolConfig config;
+        config.traceJobs     = true;
+        config.traceCapacity = capacity;
+        return config;
+    }
+
+    /**
+     * @brief Serializes `trace` to a string.
+     */
+    static std::string json(const JobTrace& trace)
+    {
+        std::ostringstream out;
+        trace.write(out);
+        return out.str();
+    }
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Every job produces one complete event named after its type
+ *
+ * GIVEN a 2-thread pool with tracing on
+ * WHEN 50 FakeCountingJobs run and the trace is collected after shutdown
+ * THEN it holds 50 "X" events named FakeCountingJob, worker track names
+ *      and the queue wait of each job
+ */
+TEST_F(TraceTest, RecordsEveryJob)
+{
+    // GIVEN
+    ThreadPool       tPool(tracing());
+    std::atomic<int> counter{0};
+    tPool.start(2);
+
+    // WHEN
+    for (int i = 0; i < 50; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    tPool.shutdown();
+    const JobTrace    trace = tPool.collectTrace();
+    const std::string text  = json(trace);
+
+    // THEN
+    EXPECT_EQ(trace.size(), 50u);
+    EXPECT_EQ(trace.droppedCount(), 0u);
+    EXPECT_EQ(text.compare(0, 16, "{\"traceEvents\":["), 0);
+    EXPECT_NE(text.find("\"name\":\"FakeCountingJob\""), std::string::npos);
+    EXPECT_NE(text.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(text.find("\"thread_name\""), std::string::npos);
+    EXPECT_NE(text.find("\"queue_wait_us\""), std::string::npos);
+}
+
+/**
+ * @test Collecting drains the buffers
+ *
+ * GIVEN a pool with tracing on that ran 10 jobs
+ * WHEN the trace is collected twice
+ * THEN the first collection has 10 events and the second none
+ */
+TEST_F(TraceTest, CollectDrainsBuffers)
+{
+    // GIVEN
+    ThreadPool       tPool(tracing());
+    std::atomic<int> counter{0};
+    tPool.start(1);
+    for (int i = 0; i < 10; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    tPool.shutdown();
+
+    // WHEN
+    const JobTrace first  = tPool.collectTrace();
+    const JobTrace second = tPool.collectTrace();
+
+    // THEN
+    EXPECT_EQ(first.size(), 10u);
+    EXPECT_EQ(second.size(), 0u);
+}
+
+/**
+ * @test A full buffer drops new events and counts them
+ *
+ * GIVEN a 1-thread pool whose trace buffer holds 4 events
+ * WHEN 10 jobs run before any collection
+ * THEN the trace keeps 4 events and reports 6 dropped
+ */
+TEST_F(TraceTest, FullBufferDropsAndCounts)
+{
+    // GIVEN
+    ThreadPool       tPool(tracing(4));
+    std::atomic<int> counter{0};
+    tPool.start(1);
+
+    // WHEN
+    for (int i = 0; i < 10; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    tPool.shutdown();
+    const JobTrace trace = tPool.collectTrace();
+
+    // THEN
+    EXPECT_EQ(trace.size(), 4u);
+    EXPECT_EQ(trace.droppedCount(), 6u);
+    EXPECT_NE(json(trace).find("\"dropped_events\":6"), std::string::npos);
+}
+
+/**
+ * @test shutdown() writes the trace file when one is configured
+ *
+ * GIVEN a pool with tracing on and `traceFile` set
+ * WHEN 5 jobs run and the pool shuts down
+ * THEN the file exists and holds a trace-event document
+ */
+TEST_F(TraceTest, ShutdownWritesTraceFile)
+{
+    // GIVEN
+    const std::string path   = "test_trace_shutdown.json";
+    ThreadPoolConfig  config = tracing();
+    config.traceFile         = path;
+    ThreadPool       tPool(config);
+    std::atomic<int> counter{0};
+    tPool.start(1);
+
+    // WHEN
+    for (int i = 0; i < 5; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    tPool.shutdown();
+
+    // THEN
+    std::ifstream     file(path);
+    const std::string text((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(path.c_str());
+
+    EXPECT_NE(text.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(text.find("FakeCountingJob"), std::string::npos);
+}
+
+/**
+ * @test Without traceJobs nothing is recorded
+ *
+ * GIVEN a default pool
+ * WHEN jobs run and the trace is collected
+ * THEN the trace is empty
+ */
+TEST_F(TraceTest, DisabledByDefault)
+{
+    // GIVEN
+    ThreadPool       tPool;
+    std::atomic<int> counter{0};
+    tPool.start(1);
+
+    // WHEN
+    for (int i = 0; i < 5; ++i)
+        tPool.enqueue(std::make_unique<FakeCountingJob>(counter));
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(tPool.collectTrace().size(), 0u);
+}
+
+/**
+ * @test Failed jobs and unknown types are written correctly
+ *
+ * GIVEN a JobTrace with one failed event without a type name
+ * WHEN it is written
+ * THEN the event is named "job" and flagged as failed
+ */
+TEST_F(TraceTest, WritesFailedAndUnnamedEvents)
+{
+    // GIVEN
+    JobTrace   trace;
+    TraceEvent event;
+    event.started  = 1000;
+    event.finished = 3000;
+    event.failed   = true;
+    trace.add(3, event);
+
+    // WHEN
+    const std::string text = json(trace);
+
+    // THEN
+    EXPECT_NE(text.find("\"name\":\"job\""), std::string::npos);
+    EXPECT_NE(text.find("\"failed\":true"), std::string::npos);
+    EXPECT_NE(text.find("\"tid\":3"), std::string::npos);
+    EXPECT_EQ(text.find("queue_wait_us"), std::string::npos);
+}
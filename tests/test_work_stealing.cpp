@@ -0,0 +1,284 @@
+/**
+ * @file        test_work_stealing.cpp
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.1.0
+ *
+ * @brief Unit tests for WorkStealingDeque and the work-stealing ThreadPool mode.
+ *
+ * @details
+ * The tests follow the GIVEN / WHEN / THEN documentation pattern:
+ *  - GIVEN: a deque or a pool in WorkStealing mode
+ *  - WHEN: jobs are pushed, popped, stolen or spawned from inside jobs
+ *  - THEN: every job is delivered exactly once (at most once on shutdownNow)
+ */
+
+/* Standard libraries */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Project libraries */
+
+#include "fake_job.h"
+#include "logger.h"
+#include "thread_pool.h"
+#include "work_stealing_deque.h"
+#include "worker_gate.h"
+
+/*****************************************************************************/
+
+class WorkStealingTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override { Logger::set_min_level(Logger::Level::WARN); }
+};
+
+/**
+ * @brief Job that records how many times each node of a binary tree ran and
+ *        spawns its two children through the pool.
+ */
+class TreeJob : public IJob
+{
+   public:
+    TreeJob(ThreadPool& pool, std::vector<std::atomic<int>>& runs, size_t node)
+        : pool(pool), runs(runs), node(node)
+    {
+    }
+
+    void execute() override
+    {
+        runs[node].fetch_add(1, std::memory_order_relaxed);
+
+        for (size_t child = 2 * node + 1; child <= 2 * node + 2; ++child)
+        {
+            if (child < runs.size())
+                pool.enqueue(std::make_unique<TreeJob>(pool, runs, child));
+        }
+    }
+
+   private:
+    ThreadPool&                    pool;
+    std::vector<std::atomic<int>>& runs;
+    size_t                         node;
+};
+
+/**
+ * @brief Builds a pool in WorkStealing mode.
+ */
+static ThreadPoolConfig stealingConfig()
+{
+    ThreadPoolConfig config;
+    config.schedulingMode = ThreadPoolConfig::SchedulingMode::WorkStealing;
+    return config;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @test Owner pops LIFO, thieves steal FIFO
+ *
+ * GIVEN a deque with jobs A, B, C pushed in that order
+ * WHEN a thief steals and the owner pops
+ * THEN the thief gets A (oldest) and the owner gets C (newest)
+ */
+TEST_F(WorkStealingTest, DequeOwnerLifoThiefFifo)
+{
+    // GIVEN
+    WorkStealingDeque deque(2);
+    Task*             a = new Task(std::make_unique<FakeJob>());
+    Task*             b = new Task(std::make_unique<FakeJob>());
+    Task*             c = new Task(std::make_unique<FakeJob>());
+    deque.push(a);
+    deque.push(b);
+    deque.push(c);  // Forces a buffer growth
+
+    // WHEN
+    std::unique_ptr<Task> stolen(deque.steal());
+    std::unique_ptr<Task> popped(deque.pop());
+
+    // THEN
+    EXPECT_EQ(stolen.get(), a);
+    EXPECT_EQ(popped.get(), c);
+    EXPECT_EQ(deque.size(), 1u);
+}
+
+/**
+ * @test A batch push keeps the order of its jobs
+ *
+ * GIVEN a 2-slot deque holding one job
+ * WHEN 9 more jobs are pushed with one call (forcing growth)
+ * THEN thieves get the jobs oldest first and the owner newest first
+ */
+TEST_F(WorkStealingTest, DequeBatchPushKeepsOrder)
+{
+    // GIVEN
+    WorkStealingDeque                  deque(2);
+    std::vector<std::unique_ptr<Task>> jobs;
+    for (int i = 0; i < 10; ++i)
+        jobs.emplace_back(new Task(std::make_unique<FakeJob>()));
+    deque.push(jobs[0].get());
+
+    // WHEN
+    std::vector<Task*> batch;
+    for (size_t i = 1; i < jobs.size(); ++i)
+        batch.push_back(jobs[i].get());
+    deque.push(batch.data(), batch.size());
+
+    // THEN
+    EXPECT_EQ(deque.size(), 10u);
+    for (size_t i = 0; i < 5; ++i)
+        EXPECT_EQ(deque.steal(), jobs[i].get());
+    for (size_t i = jobs.size(); i > 5; --i)
+        EXPECT_EQ(deque.pop(), jobs[i - 1].get());
+    EXPECT_TRUE(deque.empty());
+}
+
+/**
+ * @test Concurrent owner and thieves never duplicate or lose a job
+ *
+ * GIVEN an owner pushing/popping and 3 thieves stealing from the same deque
+ * WHEN 20000 jobs go through it
+ * THEN each job is taken exactly once
+ */
+TEST_F(WorkStealingTest, DequeConcurrentStealExactlyOnce)
+{
+    // GIVEN
+    constexpr int     kJobs = 20000;
+    WorkStealingDeque deque;
+    std::atomic<int>  taken{0};
+    std::atomic<bool> done{false};
+
+    auto take = [&](Task* task)
+    {
+        delete task;
+        taken.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < 3; ++i)
+    {
+        thieves.emplace_back(
+            [&]()
+            {
+                while (!done.load(std::memory_order_acquire))
+                {
+                    if (Task* task = deque.steal())
+                        take(task);
+                }
+            });
+    }
+
+    // WHEN
+    for (int i = 0; i < kJobs; ++i)
+    {
+        deque.push(new Task([] {}));
+        if (i % 3 == 0)
+        {
+            if (Task* task = deque.pop())
+                take(task);
+        }
+    }
+    while (Task* task = deque.pop())
+        take(task);
+
+    while (taken.load() < kJobs && !deque.empty())
+        std::this_thread::yield();
+
+    done.store(true, std::memory_order_release);
+    for (auto& thief : thieves)
+        thief.join();
+
+    // THEN
+    EXPECT_EQ(taken.load(), kJobs);
+}
+
+/**
+ * @test Jobs spawned from inside jobs all run exactly once on shutdown()
+ *
+ * GIVEN a work-stealing pool with 4 workers
+ * WHEN a root job spawns a binary tree of 4095 jobs and shutdown() is called
+ * THEN every node ran exactly once
+ */
+TEST_F(WorkStealingTest, SpawnedJobsRunExactlyOnceOnShutdown)
+{
+    // GIVEN
+    std::vector<std::atomic<int>> runs(4095);
+    for (auto& run : runs)
+        run.store(0);
+
+    ThreadPool tPool(stealingConfig());
+    tPool.start(4);
+
+    // WHEN
+    tPool.enqueue(std::make_unique<TreeJob>(tPool, runs, 0));
+    tPool.shutdown();
+
+    // THEN
+    for (size_t i = 0; i < runs.size(); ++i)
+        ASSERT_EQ(runs[i].load(), 1) << "node " << i;
+    EXPECT_EQ(tPool.size(), 0);
+}
+
+/**
+ * @test shutdownNow() while jobs are being stolen never runs a job twice
+ *
+ * GIVEN a work-stealing pool with 4 workers and several spawning trees in flight
+ * WHEN shutdownNow() is called immediately
+ * THEN every node ran at most once and all threads were joined
+ */
+TEST_F(WorkStealingTest, ShutdownNowRunsEachJobAtMostOnce)
+{
+    // GIVEN
+    std::vector<std::atomic<int>> runs(8191);
+    for (auto& run : runs)
+        run.store(0);
+
+    ThreadPool tPool(stealingConfig());
+    tPool.start(4);
+
+    // WHEN
+    tPool.enqueue(std::make_unique<TreeJob>(tPool, runs, 0));
+    tPool.enqueue(std::make_unique<FakeJob>());
+    tPool.shutdownNow();
+
+    // THEN
+    for (size_t i = 0; i < runs.size(); ++i)
+        ASSERT_LE(runs[i].load(), 1) << "node " << i;
+    EXPECT_EQ(tPool.size(), 0);
+    EXPECT_FALSE(tPool.isRunning());
+}
+
+/**
+ * @test A burst from outside the pool runs in FIFO order
+ *
+ * GIVEN a 1-thread work-stealing pool popping batches of up to 8 tasks, worker held
+ * WHEN jobs 0..5 are posted from the test thread and the worker is released
+ * THEN they run in submission order, although the batch goes through the deque
+ */
+TEST_F(WorkStealingTest, OutsideBurstRunsInQueueOrder)
+{
+    // GIVEN
+    ThreadPoolConfig config = stealingConfig();
+    config.workerBatchSize  = 8;
+    ThreadPool        tPool(config);
+    std::atomic<bool> gate{false};
+    std::vector<int>  order;  // only touched by the single worker
+    tPool.start(1);
+    holdWorker(tPool, gate);
+
+    // WHEN
+    for (int i = 0; i < 6; ++i)
+        tPool.post([&order, i] { order.push_back(i); });
+    gate.store(true);
+    tPool.shutdown();
+
+    // THEN
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
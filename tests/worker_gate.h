@@ -0,0 +1,35 @@
+/*
+ * @file        worker_gate.h
+ * @author      Sergio Guerrero Blanco <sergioguerreroblanco@hotmail.com>
+ * @date        2026-10-16
+ * @version     0.0.0
+ *
+ * @brief Test helper that keeps a pool worker busy until a gate opens.
+ *
+ * @details
+ * Jobs queued while the worker is held stay in the queue, so tests can
+ * arrange its contents before letting the pool run.
+ */
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "thread_pool.h"
+
+/**
+ * @brief Posts a job spinning until `gate` is set and returns once it runs.
+ */
+inline void holdWorker(ThreadPool& pool, std::atomic<bool>& gate)
+{
+    std::atomic<bool> started{false};
+    pool.post(
+        [&started, &gate]
+        {
+            started.store(true);
+            while (!gate.load())
+                std::this_thread::yield();
+        });
+    while (!started.load())
+        std::this_thread::yield();
+}